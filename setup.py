@@ -2,6 +2,7 @@ import imp
 import os
 import subprocess as sub
 import sys
+import tempfile
 from distutils.command.clean import clean
 from glob import glob
 
@@ -14,6 +15,22 @@ VersionPath = os.path.join(os.path.abspath("."), "VERSION")
 VERSION = open(VersionPath, "r").read().split("\n")[0].strip()
 
 
+def has_flag(compiler, flag):
+    """Can the compiler build a C file with `flag`?"""
+    with tempfile.TemporaryDirectory() as tmpdir:
+        src = os.path.join(tmpdir, "flag.c")
+        with open(src, "w") as f:
+            f.write("int main(void) { return 0; }\n")
+        try:
+            objs = compiler.compile([src], output_dir=tmpdir, extra_postargs=[flag])
+            compiler.link_executable(
+                objs, "flag", output_dir=tmpdir, extra_postargs=[flag]
+            )
+        except Exception:
+            return False
+    return True
+
+
 class BuildExt(build_ext):
     """A custom build extension for adding compiler-specific options."""
 
@@ -30,6 +47,12 @@ class BuildExt(build_ext):
                     "-Wno-sign-compare",
                     "-Wno-comment",
                 ]
+                # bAsyncOutput writes on a POSIX thread
+                ext.extra_link_args = ["-lpthread"]
+                # iNumThreads needs OpenMP; without it vplanet runs serially
+                if has_flag(self.compiler, "-fopenmp"):
+                    ext.extra_compile_args += ["-fopenmp"]
+                    ext.extra_link_args += ["-fopenmp"]
         build_ext.build_extensions(self)
 
 
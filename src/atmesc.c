@@ -1415,6 +1415,8 @@ void EnvelopeLost(BODY *body, EVOLVE *evolve, IO *io, UPDATE *update,
   body[iBody].dEnvMassDt                          = 0.0;
   fnUpdate[iBody][update[iBody].iEnvelopeMass][0] = &fndUpdateFunctionTiny;
   fnUpdate[iBody][update[iBody].iMass][0]         = &fndUpdateFunctionTiny;
+  // The mass and radius change below
+  evolve->bFSAL = 0;
 
   // printf("Envelope Lost!");
 
@@ -1499,6 +1501,7 @@ void ForceBehaviorEnvelopeEscape(BODY *body, MODULE *module, EVOLVE *evolve,
                                  IO *io, SYSTEM *system, UPDATE *update,
                                  fnUpdateVariable ***fnUpdate, int iBody,
                                  int iModule) {
+  int iRegime = body[iBody].iHEscapeRegime;
 
   // If time > jeans time, transition to ballistic regime and halt the escape
   if ((body[iBody].dEnvelopeMass > body[iBody].dMinEnvelopeMass) &&
@@ -1636,6 +1639,11 @@ void ForceBehaviorEnvelopeEscape(BODY *body, MODULE *module, EVOLVE *evolve,
       fnUpdate[iBody][update[iBody].iMass][0]         = &fdDEnvelopeMassDt;
     }
   }
+
+  // The derivatives of the other escaping species read the regime
+  if (body[iBody].iHEscapeRegime != iRegime) {
+    evolve->bFSAL = 0;
+  }
 }
 
 /**
@@ -1661,6 +1669,7 @@ void ForceBehaviorWaterEscape(BODY *body, MODULE *module, EVOLVE *evolve,
       (body[iBody].dSurfaceWaterMass > 0.)) {
     // Let's desiccate this planet.
     body[iBody].dSurfaceWaterMass = 0.;
+    evolve->bFSAL                 = 0;
   }
 }
 
@@ -1712,7 +1721,7 @@ void fnPropsAuxAtmEsc(BODY *body, EVOLVE *evolve, IO *io, UPDATE *update,
     if (body[iBody].dMass < 0) {
       fprintf(stderr,"ERROR: %s's mass is %.5e at %.5e
   years.\n",body[iBody].cName, body[iBody].dMass,evolve->dTime/YEARSEC);
-      exit(EXIT_INT);
+      VplanetExit(EXIT_INT);
     }
   #endif
   */
@@ -2232,7 +2241,7 @@ void VerifyAtmEsc(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
       fprintf(stderr, "\tbUseBondiLimited = %d\n",
               body[iBody].bUseBondiLimited);
       fprintf(stderr, "\tbAtmEscAuto = %d\n", body[iBody].bAtmEscAuto);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     } else if (iRegimeCounter == 0) {
       fprintf(stderr, "WARNING: No H envelope escape regime set for body %s!\n",
               body[iBody].cName);
@@ -2271,7 +2280,7 @@ void VerifyAtmEsc(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
               options[OPT_ENVELOPEMASS].cName, options[OPT_MASS].cName,
               files->Infile[iBody + 1].cIn);
     }
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   // Initialize rg duration
@@ -2292,7 +2301,7 @@ void VerifyAtmEsc(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
             "ERROR: More than one module is trying to set dRadius for body %d!",
             iBody);
     }
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   // If envelope mass exists, compute mass of the solid planet
@@ -4503,6 +4512,6 @@ void fvAtmEscRegimeChangeOutput(int iRegimeOld, int iRegimeNew, double dTime) {
   } else {
     fprintf(stderr, "ERROR: unknown initial atmospheric escape regime: %d\n",
             iRegimeOld);
-    exit(1);
+    VplanetExit(1);
   }
 }
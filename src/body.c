@@ -408,7 +408,7 @@ double fdMassToRad(double dMass, int iRelation) {
   /* Whoops! */
   fprintf(stderr, "ERROR: Unknown mass-radius relationship.\n");
   fprintf(stderr, "Mass: %.3e, Relationship: %d\n", dMass, iRelation);
-  exit(EXIT_UNITS);
+  VplanetExit(EXIT_UNITS);
 }
 
 // Assign mass from radius and published relationship
@@ -425,41 +425,25 @@ double fdRadToMass(double dMass, int iRelation) {
   } else {
     /* Whoops! */
     fprintf(stderr, "ERROR: Unknown mass-radius relation.\n");
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
 /**
- Copy the body struct from src to dest
+ Copy the members of the body struct that are fixed once the input has been
+ verified. This is called once before the integration begins, so BodyCopy
+ need only copy the evolving state at every step.
 
  @param dest Struct to receive the src
  @param src Struct that contains original information
+ @param evolve EVOLVE struct
  */
-void BodyCopy(BODY *dest, BODY *src, EVOLVE *evolve) {
-  int iBody, iModule;
-
-  /* This subroutine only includes parameters needed for more than 1 module,
-     Module-specific parameters belong in the fnBodyCopy subroutines. */
+void BodyCopyStatic(BODY *dest, BODY *src, EVOLVE *evolve) {
+  int iBody;
 
   for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
     strcpy(dest[iBody].cName, src[iBody].cName);
-    dest[iBody].iBodyType = src[iBody].iBodyType;
-    dest[iBody].dMass     = src[iBody].dMass;
-    dest[iBody].dRadius   = src[iBody].dRadius;
-    dest[iBody].dRadGyra  = src[iBody].dRadGyra;
-    dest[iBody].dXobl     = src[iBody].dXobl;
-    dest[iBody].dYobl     = src[iBody].dYobl;
-    dest[iBody].dZobl     = src[iBody].dZobl;
-    dest[iBody].dRotRate  = src[iBody].dRotRate;
-    dest[iBody].dAge      = src[iBody].dAge;
-    // iBody=0 could be in galhabit, so dEcc is overloaded
-    // If every run DistOrb w/GalHabit, there could be trouble
-    dest[iBody].dEcc          = src[iBody].dEcc;
-    dest[iBody].dPrecA        = src[iBody].dPrecA;
-    dest[iBody].dObliquity    = src[iBody].dObliquity;
-    dest[iBody].dLostAngMom   = src[iBody].dLostAngMom;
-    dest[iBody].dLostEng      = src[iBody].dLostEng;
-    dest[iBody].dAlbedoGlobal = src[iBody].dAlbedoGlobal;
+    dest[iBody].iBodyType     = src[iBody].iBodyType;
     dest[iBody].bCalcDynEllip = src[iBody].bCalcDynEllip;
 
     dest[iBody].bBinary   = src[iBody].bBinary;
@@ -474,9 +458,46 @@ void BodyCopy(BODY *dest, BODY *src, EVOLVE *evolve) {
     dest[iBody].bRadheat  = src[iBody].bRadheat;
     dest[iBody].bSpiNBody = src[iBody].bSpiNBody;
 
-    dest[iBody].bMantle = src[iBody].bMantle;
-    dest[iBody].bOcean  = src[iBody].bOcean;
-    dest[iBody].bEnv    = src[iBody].bEnv;
+    dest[iBody].bMantle         = src[iBody].bMantle;
+    dest[iBody].bUseOuterTidalQ = src[iBody].bUseOuterTidalQ;
+  }
+}
+
+/**
+ Copy the evolving members of the body struct from src to dest. Members that
+ cannot change during the integration are copied once by BodyCopyStatic.
+
+ @param dest Struct to receive the src
+ @param src Struct that contains original information
+ @param evolve EVOLVE struct
+ */
+void BodyCopy(BODY *dest, BODY *src, EVOLVE *evolve) {
+  int iBody, iModule;
+
+  /* This subroutine only includes parameters needed for more than 1 module,
+     Module-specific parameters belong in the fnBodyCopy subroutines. */
+
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    dest[iBody].dMass    = src[iBody].dMass;
+    dest[iBody].dRadius  = src[iBody].dRadius;
+    dest[iBody].dRadGyra = src[iBody].dRadGyra;
+    dest[iBody].dXobl    = src[iBody].dXobl;
+    dest[iBody].dYobl    = src[iBody].dYobl;
+    dest[iBody].dZobl    = src[iBody].dZobl;
+    dest[iBody].dRotRate = src[iBody].dRotRate;
+    dest[iBody].dAge     = src[iBody].dAge;
+    // iBody=0 could be in galhabit, so dEcc is overloaded
+    // If every run DistOrb w/GalHabit, there could be trouble
+    dest[iBody].dEcc          = src[iBody].dEcc;
+    dest[iBody].dPrecA        = src[iBody].dPrecA;
+    dest[iBody].dObliquity    = src[iBody].dObliquity;
+    dest[iBody].dLostAngMom   = src[iBody].dLostAngMom;
+    dest[iBody].dLostEng      = src[iBody].dLostEng;
+    dest[iBody].dAlbedoGlobal = src[iBody].dAlbedoGlobal;
+
+    // bOcean and bEnv can be switched off by ForceBehavior
+    dest[iBody].bOcean = src[iBody].bOcean;
+    dest[iBody].bEnv   = src[iBody].bEnv;
 
     // dest[iBody].dLXUV = src[iBody].dLXUV;
 
@@ -489,7 +510,6 @@ void BodyCopy(BODY *dest, BODY *src, EVOLVE *evolve) {
     dest[iBody].dShmodUMan       = src[iBody].dShmodUMan;
     dest[iBody].dStiffness       = src[iBody].dStiffness;
     dest[iBody].dImK2ManOrbModel = src[iBody].dImK2ManOrbModel;
-    dest[iBody].bUseOuterTidalQ  = src[iBody].bUseOuterTidalQ;
 
     if (iBody > 0) {
       dest[iBody].dHecc       = src[iBody].dHecc;
@@ -101,6 +101,7 @@ double fdImK2ManThermint(BODY *, int);
 void AssignTidalProperties(BODY *, EVOLVE *, int);
 double fdHflowSecMan(BODY *, EVOLVE *, int);
 
+void BodyCopyStatic(BODY *, BODY *, EVOLVE *);
 void BodyCopy(BODY *, BODY *, EVOLVE *);
 
 void CalcXYZobl(BODY *, int);
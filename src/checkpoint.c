@@ -0,0 +1,798 @@
+/**
+  @file checkpoint.c
+  @brief Write the evolving state to a binary snapshot and resume from it.
+
+  A checkpoint is written right after an output, before the auxiliary
+  properties of the next step are computed, so a restarted run repeats
+  exactly the calls the original run made from that point on. BODY and
+  SYSTEM are saved as raw images; on reading, their pointer members keep the
+  addresses allocated by this process, which is why every pointer member of
+  BODY and SYSTEM must be listed below; test_TideLockCheckpoint compares the
+  lists against vplanet.h. Arrays whose contents evolve are
+  saved by the modules that own them. Function pointers are not saved: a
+  restart rebuilds fnUpdate through VerifyOptions, and the checkpoint records
+  only the equations that ForceBehavior has swapped since. A checkpoint is
+  still only read by the version of VPLanet that wrote it.
+
+  @author Rory Barnes ([RoryBarnes](https://github.com/RoryBarnes/))
+  @date Oct 16 2026
+*/
+
+#include "vplanet.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Pointer members of BODY and SYSTEM */
+static const size_t iaBodyPointer[] = {
+      offsetof(BODY, dDistance3),
+      offsetof(BODY, dDistanceX),
+      offsetof(BODY, dDistanceY),
+      offsetof(BODY, dDistanceZ),
+      offsetof(BODY, dHCartPos),
+      offsetof(BODY, dHCartVel),
+      offsetof(BODY, dBCartPos),
+      offsetof(BODY, dBCartVel),
+      offsetof(BODY, daCartPos),
+      offsetof(BODY, daCartVel),
+      offsetof(BODY, iaGravPerts),
+      offsetof(BODY, iaEigFreqs),
+      offsetof(BODY, daLOrb),
+      offsetof(BODY, daLOrbTmp),
+      offsetof(BODY, daLRot),
+      offsetof(BODY, daLRotTmp),
+      offsetof(BODY, daTimeSeries),
+      offsetof(BODY, daSemiSeries),
+      offsetof(BODY, daEccSeries),
+      offsetof(BODY, daIncSeries),
+      offsetof(BODY, daArgPSeries),
+      offsetof(BODY, daLongASeries),
+      offsetof(BODY, daMeanASeries),
+      offsetof(BODY, daHeccSeries),
+      offsetof(BODY, daKeccSeries),
+      offsetof(BODY, daPincSeries),
+      offsetof(BODY, daQincSeries),
+      offsetof(BODY, iaTidePerts),
+      offsetof(BODY, dTidalZ),
+      offsetof(BODY, dTidalChi),
+      offsetof(BODY, dTidalF),
+      offsetof(BODY, dTidalBeta),
+      offsetof(BODY, iTidalEpsilon),
+      offsetof(BODY, daDoblDtEqtide),
+      offsetof(BODY, daOblSeries),
+      offsetof(BODY, daPrecASeries),
+      offsetof(BODY, daAnnualInsol),
+      offsetof(BODY, daDivFlux),
+      offsetof(BODY, daDMidPt),
+      offsetof(BODY, daInsol),
+      offsetof(BODY, daFlux),
+      offsetof(BODY, daFluxIn),
+      offsetof(BODY, daFluxOut),
+      offsetof(BODY, daLats),
+      offsetof(BODY, daSinLat),
+      offsetof(BODY, daCosLat),
+      offsetof(BODY, daTanLat),
+      offsetof(BODY, daPeakInsol),
+      offsetof(BODY, daTGrad),
+      offsetof(BODY, daAlbedoAnn),
+      offsetof(BODY, daDiffusionAnn),
+      offsetof(BODY, daMEulerAnn),
+      offsetof(BODY, daMBandAnn),
+      offsetof(BODY, daMLowerAnn),
+      offsetof(BODY, daLambdaAnn),
+      offsetof(BODY, daMClim),
+      offsetof(BODY, daMDiffAnn),
+      offsetof(BODY, daPlanckAAnn),
+      offsetof(BODY, daPlanckBAnn),
+      offsetof(BODY, iaRowswapAnn),
+      offsetof(BODY, daSourceF),
+      offsetof(BODY, daTempAnn),
+      offsetof(BODY, daTempTerms),
+      offsetof(BODY, daTmpTempAnn),
+      offsetof(BODY, daTmpTempTerms),
+      offsetof(BODY, daAlbedoAvg),
+      offsetof(BODY, daAlbedoAvgL),
+      offsetof(BODY, daAlbedoAvgW),
+      offsetof(BODY, daAlbedoLand),
+      offsetof(BODY, daAlbedoLW),
+      offsetof(BODY, daAlbedoWater),
+      offsetof(BODY, daBasalFlow),
+      offsetof(BODY, daBasalFlowMid),
+      offsetof(BODY, daBasalVel),
+      offsetof(BODY, daBedrockH),
+      offsetof(BODY, daBedrockHEq),
+      offsetof(BODY, daDeclination),
+      offsetof(BODY, daDeltaTempL),
+      offsetof(BODY, daDeltaTempW),
+      offsetof(BODY, daDIceHeightDy),
+      offsetof(BODY, daDiffusionSea),
+      offsetof(BODY, daDivFluxAvg),
+      offsetof(BODY, daDivFluxDaily),
+      offsetof(BODY, daEnergyResL),
+      offsetof(BODY, daEnergyResW),
+      offsetof(BODY, daEnerResLAnn),
+      offsetof(BODY, daEnerResWAnn),
+      offsetof(BODY, daFluxAvg),
+      offsetof(BODY, daFluxOutAvg),
+      offsetof(BODY, daFluxDaily),
+      offsetof(BODY, daFluxInAvg),
+      offsetof(BODY, daFluxInDaily),
+      offsetof(BODY, daFluxInLand),
+      offsetof(BODY, daFluxInWater),
+      offsetof(BODY, daFluxOutDaily),
+      offsetof(BODY, daFluxOutLand),
+      offsetof(BODY, daFluxOutWater),
+      offsetof(BODY, daFluxSeaIce),
+      offsetof(BODY, daIceBalance),
+      offsetof(BODY, daIceAblateTot),
+      offsetof(BODY, daIceAccumTot),
+      offsetof(BODY, daIceBalanceAnnual),
+      offsetof(BODY, daIceBalanceAvg),
+      offsetof(BODY, daIceBalanceTmp),
+      offsetof(BODY, daIceFlow),
+      offsetof(BODY, daIceFlowAvg),
+      offsetof(BODY, daIceFlowMid),
+      offsetof(BODY, daIceGamTmp),
+      offsetof(BODY, daIceHeight),
+      offsetof(BODY, daIceMass),
+      offsetof(BODY, daIceMassTmp),
+      offsetof(BODY, daIcePropsTmp),
+      offsetof(BODY, daIceSheetDiff),
+      offsetof(BODY, daIceSheetMat),
+      offsetof(BODY, daLambdaSea),
+      offsetof(BODY, daLandFrac),
+      offsetof(BODY, daMDiffSea),
+      offsetof(BODY, daMBandSea),
+      offsetof(BODY, daMEulerSea),
+      offsetof(BODY, daMInit),
+      offsetof(BODY, daMLand),
+      offsetof(BODY, daMLowerSea),
+      offsetof(BODY, daMWater),
+      offsetof(BODY, daPlanckASea),
+      offsetof(BODY, daPlanckBSea),
+      offsetof(BODY, daPlanckBDaily),
+      offsetof(BODY, daPlanckBAvg),
+      offsetof(BODY, iaRowswapSea),
+      offsetof(BODY, daSeaIceHeight),
+      offsetof(BODY, daSeaIceK),
+      offsetof(BODY, daSedShear),
+      offsetof(BODY, daSourceL),
+      offsetof(BODY, daSourceLW),
+      offsetof(BODY, daSourceW),
+      offsetof(BODY, daTempAvg),
+      offsetof(BODY, daTempAvgL),
+      offsetof(BODY, daTempAvgW),
+      offsetof(BODY, daTempPrevL),
+      offsetof(BODY, daTempPrevW),
+      offsetof(BODY, daTempDaily),
+      offsetof(BODY, daTempLand),
+      offsetof(BODY, daTempLW),
+      offsetof(BODY, daTempMaxLW),
+      offsetof(BODY, daTempMaxLand),
+      offsetof(BODY, daTempMaxWater),
+      offsetof(BODY, daTempMinLW),
+      offsetof(BODY, daTempWater),
+      offsetof(BODY, daTmpTempSea),
+      offsetof(BODY, daWaterFrac),
+      offsetof(BODY, daXBoundary),
+      offsetof(BODY, daYBoundary),
+      offsetof(BODY, daEnergyERG),
+      offsetof(BODY, daEnergyJOU),
+      offsetof(BODY, daLogEner),
+      offsetof(BODY, daEnerJOU),
+      offsetof(BODY, daEnergyJOUXUV),
+      offsetof(BODY, daEnergyERGXUV),
+      offsetof(BODY, daLogEnerXUV),
+      offsetof(BODY, daFFD),
+      offsetof(BODY, daLXUVFlare),
+      offsetof(BODY, daRelativeImpact),
+      offsetof(BODY, daRelativeVel),
+};
+
+static const size_t iaSystemPointer[] = {
+      offsetof(SYSTEM, fnLaplaceF),
+      offsetof(SYSTEM, fnLaplaceDeriv),
+      offsetof(SYSTEM, daLaplaceC),
+      offsetof(SYSTEM, daLaplaceD),
+      offsetof(SYSTEM, daAlpha0),
+      offsetof(SYSTEM, iaLaplaceN),
+      offsetof(SYSTEM, daEigenValEcc),
+      offsetof(SYSTEM, daEigenValInc),
+      offsetof(SYSTEM, daEigenVecEcc),
+      offsetof(SYSTEM, daEigenVecInc),
+      offsetof(SYSTEM, daEigenPhase),
+      offsetof(SYSTEM, daA),
+      offsetof(SYSTEM, daB),
+      offsetof(SYSTEM, daAsoln),
+      offsetof(SYSTEM, daBsoln),
+      offsetof(SYSTEM, daetmp),
+      offsetof(SYSTEM, daitmp),
+      offsetof(SYSTEM, dah0),
+      offsetof(SYSTEM, dak0),
+      offsetof(SYSTEM, dap0),
+      offsetof(SYSTEM, daq0),
+      offsetof(SYSTEM, daS),
+      offsetof(SYSTEM, daT),
+      offsetof(SYSTEM, iaRowswap),
+      offsetof(SYSTEM, daAcopy),
+      offsetof(SYSTEM, daScale),
+      offsetof(SYSTEM, daLOrb),
+      offsetof(SYSTEM, daPassingStarR),
+      offsetof(SYSTEM, daPassingStarV),
+      offsetof(SYSTEM, daPassingStarImpact),
+      offsetof(SYSTEM, daHostApexVel),
+      offsetof(SYSTEM, daRelativeVel),
+      offsetof(SYSTEM, daRelativePos),
+      offsetof(SYSTEM, daGSNumberDens),
+      offsetof(SYSTEM, daGSBinMag),
+      offsetof(SYSTEM, daEncounterRateMV),
+      offsetof(SYSTEM, iaResIndex),
+      offsetof(SYSTEM, iaResOrder),
+      offsetof(SYSTEM, daLibrFreq2),
+      offsetof(SYSTEM, daCircFreq),
+      offsetof(SYSTEM, daDistCos),
+      offsetof(SYSTEM, daDistSin),
+      offsetof(SYSTEM, daDistSec),
+};
+
+#define NUMBODYPOINTERS (sizeof(iaBodyPointer) / sizeof(size_t))
+#define NUMSYSTEMPOINTERS (sizeof(iaSystemPointer) / sizeof(size_t))
+
+/**
+Write or read iNum elements of size iSize.
+
+@param fp Checkpoint file
+@param pData First element
+@param iSize Size of one element
+@param iNum Number of elements
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointData(FILE *fp, void *pData, size_t iSize, size_t iNum,
+                    int bWrite) {
+  size_t iDone;
+
+  if (iNum == 0) {
+    return;
+  }
+  if (bWrite) {
+    iDone = fwrite(pData, iSize, iNum, fp);
+  } else {
+    iDone = fread(pData, iSize, iNum, fp);
+  }
+  if (iDone != iNum) {
+    if (bWrite) {
+      fprintf(stderr, "ERROR: Unable to write checkpoint.\n");
+      VplanetExit(EXIT_WRITE);
+    }
+    fprintf(stderr, "ERROR: Checkpoint is truncated.\n");
+    VplanetExit(EXIT_INPUT);
+  }
+}
+
+/**
+Write or read the raw image of a struct. When reading, the pointer members
+listed in iaPointer keep their current values.
+
+@param fp Checkpoint file
+@param pStruct The struct
+@param iSize Size of the struct
+@param iaPointer Offsets of the pointer members
+@param iNumPointers Number of pointer members
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointStruct(FILE *fp, void *pStruct, size_t iSize,
+                      const size_t iaPointer[], int iNumPointers, int bWrite) {
+  char *cImage;
+  int iPointer;
+
+  if (bWrite) {
+    CheckpointData(fp, pStruct, iSize, 1, 1);
+    return;
+  }
+
+  cImage = malloc(iSize);
+  CheckpointData(fp, cImage, iSize, 1, 0);
+  for (iPointer = 0; iPointer < iNumPointers; iPointer++) {
+    memcpy(cImage + iaPointer[iPointer],
+           (char *)pStruct + iaPointer[iPointer], sizeof(void *));
+  }
+  memcpy(pStruct, cImage, iSize);
+  free(cImage);
+}
+
+/* Every function ForceBehavior may swap into fnUpdate. A checkpoint stores an
+   index into this list, so new functions must be appended. */
+static fnUpdateVariable fnaSwapTarget[] = {
+      &fndUpdateFunctionTiny,
+      &fdDEnvelopeMassDt,
+      &fdDEnvelopeMassDtRRLimited,
+      &fdDEnvelopeMassDtBondiLimited,
+};
+
+#define NUMSWAPTARGETS (sizeof(fnaSwapTarget) / sizeof(fnUpdateVariable))
+
+/**
+Copy fnUpdate as VerifyOptions built it. Function addresses change from
+build to build, so a checkpoint records only where ForceBehavior has since
+swapped a function, and a restart applies those swaps to the functions its
+own VerifyOptions built.
+
+@param control Control struct
+@param update Update struct
+@param fnUpdate Function pointers to the derivatives
+*/
+void InitializeCheckpoint(CONTROL *control, UPDATE *update,
+                          fnUpdateVariable ***fnUpdate) {
+  int iBody, iVar, iEqn;
+  EVOLVE *evolve = &control->Evolve;
+
+  evolve->fnVerifyUpdate =
+        malloc(evolve->iNumBodies * sizeof(fnUpdateVariable **));
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    evolve->fnVerifyUpdate[iBody] =
+          malloc(update[iBody].iNumVars * sizeof(fnUpdateVariable *));
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      evolve->fnVerifyUpdate[iBody][iVar] =
+            malloc(update[iBody].iNumEqns[iVar] * sizeof(fnUpdateVariable));
+      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+        evolve->fnVerifyUpdate[iBody][iVar][iEqn] =
+              fnUpdate[iBody][iVar][iEqn];
+      }
+    }
+  }
+}
+
+/**
+Write or read a function pointer array with the shape of the UPDATE matrix.
+Only the equations whose function differs from the one VerifyOptions built
+are recorded, as their body, variable and equation indices and the index of
+the new function in fnaSwapTarget.
+
+@param fp Checkpoint file
+@param fnArray Function pointers, [iBody][iVar][iEqn]
+@param control Control struct
+@param update UPDATE struct
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointFunctions(FILE *fp, fnUpdateVariable ***fnArray,
+                         CONTROL *control, UPDATE *update, int bWrite) {
+  int iBody, iVar, iEqn, iNumSwaps, iSwap;
+  int iaSwap[4];
+  fnUpdateVariable ***fnVerify = control->Evolve.fnVerifyUpdate;
+
+  if (bWrite) {
+    iNumSwaps = 0;
+    for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+      for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+        for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+          iNumSwaps += fnArray[iBody][iVar][iEqn] != fnVerify[iBody][iVar][iEqn];
+        }
+      }
+    }
+    CheckpointData(fp, &iNumSwaps, sizeof(int), 1, 1);
+    for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+      for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+        for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+          if (fnArray[iBody][iVar][iEqn] == fnVerify[iBody][iVar][iEqn]) {
+            continue;
+          }
+          for (iSwap = 0; iSwap < (int)NUMSWAPTARGETS; iSwap++) {
+            if (fnArray[iBody][iVar][iEqn] == fnaSwapTarget[iSwap]) {
+              break;
+            }
+          }
+          if (iSwap == (int)NUMSWAPTARGETS) {
+            fprintf(stderr,
+                    "ERROR: Unable to checkpoint equation %d of variable %d "
+                    "of body %d, whose function is not in fnaSwapTarget.\n",
+                    iEqn, iVar, iBody);
+            VplanetExit(EXIT_WRITE);
+          }
+          iaSwap[0] = iBody;
+          iaSwap[1] = iVar;
+          iaSwap[2] = iEqn;
+          iaSwap[3] = iSwap;
+          CheckpointData(fp, iaSwap, sizeof(int), 4, 1);
+        }
+      }
+    }
+    return;
+  }
+
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+        fnArray[iBody][iVar][iEqn] = fnVerify[iBody][iVar][iEqn];
+      }
+    }
+  }
+  CheckpointData(fp, &iNumSwaps, sizeof(int), 1, 0);
+  for (; iNumSwaps > 0; iNumSwaps--) {
+    CheckpointData(fp, iaSwap, sizeof(int), 4, 0);
+    if (iaSwap[0] < 0 || iaSwap[0] >= control->Evolve.iNumBodies ||
+        iaSwap[1] < 0 || iaSwap[1] >= update[iaSwap[0]].iNumVars ||
+        iaSwap[2] < 0 || iaSwap[2] >= update[iaSwap[0]].iNumEqns[iaSwap[1]] ||
+        iaSwap[3] < 0 || iaSwap[3] >= (int)NUMSWAPTARGETS) {
+      fprintf(stderr, "ERROR: Checkpoint does not match the input files.\n");
+      VplanetExit(EXIT_INPUT);
+    }
+    fnArray[iaSwap[0]][iaSwap[1]][iaSwap[2]] = fnaSwapTarget[iaSwap[3]];
+  }
+}
+
+/**
+Write or read a matrix stored as an array of rows.
+
+@param fp Checkpoint file
+@param daMatrix The matrix
+@param iNumRows Number of rows
+@param iNumCols Number of columns
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointMatrix(FILE *fp, double **daMatrix, int iNumRows, int iNumCols,
+                      int bWrite) {
+  int iRow;
+
+  for (iRow = 0; iRow < iNumRows; iRow++) {
+    CheckpointData(fp, daMatrix[iRow], sizeof(double), iNumCols, bWrite);
+  }
+}
+
+/**
+Write or read the header, which identifies the executable and the shape of
+the state. A checkpoint written by another build or for other input files is
+rejected.
+
+@param fp Checkpoint file
+@param control Control struct
+@param cFile Name of the checkpoint
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointHeader(FILE *fp, CONTROL *control, char cFile[], int bWrite) {
+  char cMagic[CHECKPOINTMAGICLEN], cVersion[64];
+  int iaShape[8], iaSaved[8], iShape, iPointer;
+  unsigned int iLayout;
+
+  iaShape[0] = (int)sizeof(BODY);
+  iaShape[1] = (int)sizeof(SYSTEM);
+  iaShape[2] = (int)sizeof(EVOLVE);
+  iaShape[3] = control->Evolve.iNumBodies;
+  iaShape[4] = control->Evolve.iOneStep;
+  iaShape[5] = 0;
+  iaShape[6] = 0;
+  if (control->Evolve.iOneStep != EULER) {
+    iaShape[5] = control->Evolve.iNumState;
+    iaShape[6] = control->Evolve.iNumStateProc;
+  }
+  /* The layout of BODY and SYSTEM, which builds without a version share */
+  iLayout = 0;
+  for (iPointer = 0; iPointer < (int)NUMBODYPOINTERS; iPointer++) {
+    iLayout = 31 * iLayout + (unsigned int)iaBodyPointer[iPointer];
+  }
+  for (iPointer = 0; iPointer < (int)NUMSYSTEMPOINTERS; iPointer++) {
+    iLayout = 31 * iLayout + (unsigned int)iaSystemPointer[iPointer];
+  }
+  iaShape[7] = (int)(iLayout & 0x7fffffff);
+
+  if (bWrite) {
+    memset(cMagic, '\0', CHECKPOINTMAGICLEN);
+    strcpy(cMagic, CHECKPOINTMAGIC);
+    CheckpointData(fp, cMagic, 1, CHECKPOINTMAGICLEN, 1);
+    CheckpointData(fp, control->sGitVersion, 1, 64, 1);
+    CheckpointData(fp, iaShape, sizeof(int), 8, 1);
+    return;
+  }
+
+  CheckpointData(fp, cMagic, 1, CHECKPOINTMAGICLEN, 0);
+  if (memcmp(cMagic, CHECKPOINTMAGIC, strlen(CHECKPOINTMAGIC)) != 0) {
+    fprintf(stderr, "ERROR: %s is not a VPLanet checkpoint.\n", cFile);
+    VplanetExit(EXIT_INPUT);
+  }
+  CheckpointData(fp, cVersion, 1, 64, 0);
+  CheckpointData(fp, iaSaved, sizeof(int), 8, 0);
+  for (iShape = 0; iShape < 8; iShape++) {
+    if (iaSaved[iShape] != iaShape[iShape]) {
+      fprintf(stderr,
+              "ERROR: %s was written for different input files or by a "
+              "different build of VPLanet.\n",
+              cFile);
+      VplanetExit(EXIT_INPUT);
+    }
+  }
+  if (strncmp(cVersion, control->sGitVersion, 64) != 0) {
+    fprintf(stderr,
+            "ERROR: %s was written by VPLanet version %s, but this is "
+            "version %s.\n",
+            cFile, cVersion, control->sGitVersion);
+    VplanetExit(EXIT_INPUT);
+  }
+}
+
+/**
+Write or read everything that evolves: the integrator's state, BODY,
+SYSTEM, the derivatives and the module arrays. Writing and reading share
+this function, so the two cannot get out of step.
+
+@param body Body struct
+@param control Control struct
+@param system System struct
+@param update Update struct
+@param fnUpdate Function pointers to the derivatives
+@param dDt Timestep of the evolution loop
+@param fp Checkpoint file
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointState(BODY *body, CONTROL *control, SYSTEM *system,
+                     UPDATE *update, fnUpdateVariable ***fnUpdate, double *dDt,
+                     FILE *fp, int bWrite) {
+  int iBody, iVar, iNumBodies;
+  EVOLVE *evolve = &control->Evolve;
+  IO *io         = &control->Io;
+
+  iNumBodies = evolve->iNumBodies;
+
+  /* Integration */
+  CheckpointData(fp, dDt, sizeof(double), 1, bWrite);
+  CheckpointData(fp, &evolve->dTime, sizeof(double), 1, bWrite);
+  CheckpointData(fp, &evolve->nSteps, sizeof(int), 1, bWrite);
+  CheckpointData(fp, &evolve->bFirstStep, sizeof(int), 1, bWrite);
+  CheckpointData(fp, &evolve->dCurrentDt, sizeof(double), 1, bWrite);
+  CheckpointData(fp, &evolve->iStateVersion, sizeof(int), 1, bWrite);
+  CheckpointData(fp, &evolve->iDerivVersion, sizeof(int), 1, bWrite);
+  CheckpointData(fp, &evolve->bAuxDerivs, sizeof(int), 1, bWrite);
+  CheckpointData(fp, &evolve->bUsingDistOrb, sizeof(int), 1, bWrite);
+  CheckpointData(fp, &evolve->bUsingSpiNBody, sizeof(int), 1, bWrite);
+  CheckpointData(fp, &evolve->bSpiNBodyDistOrb, sizeof(int), 1, bWrite);
+
+  if (evolve->iOneStep != EULER) {
+    /* RK45 reuses the last stage as the next first stage */
+    CheckpointData(fp, evolve->daStateDeriv[0], sizeof(double),
+                   NUMSTAGES * evolve->iNumState, bWrite);
+    CheckpointData(fp, evolve->daStateProc[0], sizeof(double),
+                   NUMSTAGES * evolve->iNumStateProc, bWrite);
+  }
+  if (evolve->iOneStep == RK45) {
+    CheckpointData(fp, &evolve->dProposedDt, sizeof(double), 1, bWrite);
+    CheckpointData(fp, &evolve->iNumRejected, sizeof(int), 1, bWrite);
+    CheckpointData(fp, &evolve->bFSAL, sizeof(int), 1, bWrite);
+    CheckpointData(fp, evolve->daFSALState, sizeof(double), evolve->iNumState,
+                   bWrite);
+    CheckpointFunctions(fp, evolve->fnFSALUpdate, control, update, bWrite);
+  } else if (evolve->iOneStep == ROSENBROCK) {
+    CheckpointData(fp, &evolve->dProposedDt, sizeof(double), 1, bWrite);
+    CheckpointData(fp, &evolve->iNumRejected, sizeof(int), 1, bWrite);
+    CheckpointMatrix(fp, evolve->daJacobian, evolve->iNumStiffVars,
+                     evolve->iNumStiffVars, bWrite);
+    CheckpointMatrix(fp, evolve->daStiffMatrix, evolve->iNumStiffVars,
+                     evolve->iNumStiffVars, bWrite);
+    CheckpointMatrix(fp, evolve->daStiffLU, evolve->iNumStiffVars,
+                     evolve->iNumStiffVars, bWrite);
+    CheckpointData(fp, evolve->daStiffScale, sizeof(double),
+                   evolve->iNumStiffVars, bWrite);
+    CheckpointData(fp, evolve->iaStiffRowswap, sizeof(int),
+                   evolve->iNumStiffVars, bWrite);
+    CheckpointData(fp, &evolve->dStiffLUDt, sizeof(double), 1, bWrite);
+    CheckpointData(fp, &evolve->dStiffFirstDt, sizeof(double), 1, bWrite);
+    CheckpointData(fp, evolve->daStiffDfDt, sizeof(double),
+                   evolve->iNumStiffVars, bWrite);
+    CheckpointData(fp, &evolve->iJacobianAge, sizeof(int), 1, bWrite);
+    CheckpointData(fp, &evolve->bJacobianValid, sizeof(int), 1, bWrite);
+  }
+
+  /* Output */
+  CheckpointData(fp, &io->dNextOutput, sizeof(double), 1, bWrite);
+  CheckpointData(fp, &io->dNextCheckpoint, sizeof(double), 1, bWrite);
+  CheckpointData(fp, &io->bDeltaTimeMessage, sizeof(int), 1, bWrite);
+  CheckpointData(fp, &io->bMutualIncMessage, sizeof(int), 1, bWrite);
+  CheckpointData(fp, io->baRocheMessage, sizeof(int), iNumBodies, bWrite);
+  CheckpointData(fp, io->baCassiniOneMessage, sizeof(int), iNumBodies, bWrite);
+  CheckpointData(fp, io->baCassiniTwoMessage, sizeof(int), iNumBodies, bWrite);
+  CheckpointData(fp, io->baEnterHZMessage, sizeof(int), iNumBodies, bWrite);
+
+  /* Bodies and system */
+  for (iBody = 0; iBody < iNumBodies; iBody++) {
+    CheckpointStruct(fp, &body[iBody], sizeof(BODY), iaBodyPointer,
+                     NUMBODYPOINTERS, bWrite);
+  }
+  CheckpointStruct(fp, system, sizeof(SYSTEM), iaSystemPointer,
+                   NUMSYSTEMPOINTERS, bWrite);
+
+  /* Primary variables, some of which live in module arrays, derivatives,
+     and the functions ForceBehavior may have swapped */
+  for (iBody = 0; iBody < iNumBodies; iBody++) {
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      CheckpointData(fp, update[iBody].pdVar[iVar], sizeof(double), 1, bWrite);
+    }
+    CheckpointData(fp, update[iBody].daDeriv, sizeof(double),
+                   update[iBody].iNumVars, bWrite);
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      CheckpointData(fp, update[iBody].daDerivProc[iVar], sizeof(double),
+                     update[iBody].iNumEqns[iVar], bWrite);
+    }
+  }
+  CheckpointFunctions(fp, fnUpdate, control, update, bWrite);
+}
+
+/**
+Write or read the arrays that modules evolve outside the primary variables.
+
+@param body Body struct
+@param control Control struct
+@param system System struct
+@param fp Checkpoint file
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointModules(BODY *body, CONTROL *control, SYSTEM *system, FILE *fp,
+                       int bWrite) {
+  int iBody;
+
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    if (body[iBody].bEqtide) {
+      CheckpointEqtide(control, iBody, fp, bWrite);
+    }
+    if (body[iBody].bPoise) {
+      CheckpointPoise(body, iBody, fp, bWrite);
+    }
+    if (body[iBody].bGalHabit && iBody > 0) {
+      CheckpointGalHabit(body, system, iBody, fp, bWrite);
+    }
+  }
+  if (control->Evolve.iNumBodies > 1 && body[1].bDistOrb) {
+    CheckpointDistOrb(body, control, system, fp, bWrite);
+  }
+}
+
+/**
+Record the size of every output file, or truncate them to the recorded
+sizes, so a restarted run appends exactly where the checkpoint was taken.
+
+@param body Body struct
+@param control Control struct
+@param files Files struct
+@param system System struct
+@param fp Checkpoint file
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointOutputFiles(BODY *body, CONTROL *control, FILES *files,
+                           SYSTEM *system, FILE *fp, int bWrite) {
+  char(*saFile)[NAMELEN];
+  int iFile, iNumFiles = 0, iBody, jBody, iNumBodies;
+  int64_t iSize;
+  struct stat st;
+
+  iNumBodies = control->Evolve.iNumBodies;
+  saFile     = malloc((4 + 2 * iNumBodies + iNumBodies * iNumBodies) *
+                      sizeof(*saFile));
+
+  if (bWrite) {
+    // The sizes must include the rows still in the output buffers
+    FlushOutputFiles(control, files);
+    // A streamed run sends its log and container through the stream
+    if (control->Io.bLog && !control->Io.bStream) {
+      strcpy(saFile[iNumFiles++], files->cLog);
+    }
+    if (control->Io.iOutputFormat == OUTPUTCONTAINER && !control->Io.bStream) {
+      strcpy(saFile[iNumFiles++], control->Io.cContainer);
+    }
+    for (iBody = 0; iBody < iNumBodies; iBody++) {
+      strcpy(saFile[iNumFiles++], files->Outfile[iBody].cOut);
+      if (body[iBody].bPoise) {
+        sprintf(saFile[iNumFiles++], "%s.%s.Climate", system->cName,
+                body[iBody].cName);
+      }
+      if (body[iBody].bDistOrb && control->bOutputLapl) {
+        for (jBody = iBody + 1; jBody < iNumBodies; jBody++) {
+          sprintf(saFile[iNumFiles++], "%s.%s.Laplace", body[iBody].cName,
+                  body[jBody].cName);
+        }
+      }
+    }
+    if (iNumBodies > 1 && body[1].bDistOrb && control->bOutputEigen) {
+      sprintf(saFile[iNumFiles++], "%s.Ecc.Eigen", system->cName);
+      sprintf(saFile[iNumFiles++], "%s.Inc.Eigen", system->cName);
+    }
+  }
+
+  CheckpointData(fp, &iNumFiles, sizeof(int), 1, bWrite);
+  for (iFile = 0; iFile < iNumFiles; iFile++) {
+    CheckpointData(fp, saFile[iFile], 1, NAMELEN, bWrite);
+    if (bWrite) {
+      iSize = -1;
+      if (stat(saFile[iFile], &st) == 0) {
+        iSize = (int64_t)st.st_size;
+      }
+    }
+    CheckpointData(fp, &iSize, sizeof(int64_t), 1, bWrite);
+    if (!bWrite && iSize >= 0) {
+#ifdef VPLANET_ON_WINDOWS
+      fprintf(stderr, "ERROR: Restarting is not supported on Windows.\n");
+      VplanetExit(EXIT_EXE);
+#else
+      if (truncate(saFile[iFile], (off_t)iSize) != 0) {
+        fprintf(stderr,
+                "ERROR: Unable to restore %s, which must be unchanged since "
+                "the checkpoint was written.\n",
+                saFile[iFile]);
+        VplanetExit(EXIT_INPUT);
+      }
+#endif
+    }
+  }
+  free(saFile);
+}
+
+/**
+Write the checkpoint <sSystemName>.checkpoint. It is written to a temporary
+file first, so a run killed while writing leaves the previous one intact.
+
+@param body Body struct
+@param control Control struct
+@param files Files struct
+@param system System struct
+@param update Update struct
+@param fnUpdate Function pointers to the derivatives
+@param dDt Timestep of the evolution loop
+*/
+void WriteCheckpoint(BODY *body, CONTROL *control, FILES *files,
+                     SYSTEM *system, UPDATE *update,
+                     fnUpdateVariable ***fnUpdate, double *dDt) {
+  char cFile[2 * NAMELEN], cTmp[2 * NAMELEN + 4];
+  FILE *fp;
+
+  sprintf(cFile, "%s.checkpoint", system->cName);
+  sprintf(cTmp, "%s.tmp", cFile);
+  fp = fopen(cTmp, "wb");
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to open %s.\n", cTmp);
+    VplanetExit(EXIT_WRITE);
+  }
+
+  CheckpointHeader(fp, control, cFile, 1);
+  CheckpointState(body, control, system, update, fnUpdate, dDt, fp, 1);
+  CheckpointModules(body, control, system, fp, 1);
+  CheckpointOutputFiles(body, control, files, system, fp, 1);
+
+  if (fclose(fp) != 0 || rename(cTmp, cFile) != 0) {
+    fprintf(stderr, "ERROR: Unable to write %s.\n", cFile);
+    VplanetExit(EXIT_WRITE);
+  }
+  if (control->Io.iVerbose >= VERBPROG) {
+    printf("Checkpoint written at t = %.6e years.\n",
+           control->Evolve.dTime / YEARSEC);
+  }
+}
+
+/**
+Restore the state from <sSystemName>.checkpoint and truncate the output
+files to where they were when it was written.
+
+@param body Body struct
+@param control Control struct
+@param files Files struct
+@param system System struct
+@param update Update struct
+@param fnUpdate Function pointers to the derivatives
+@param dDt Timestep of the evolution loop
+*/
+void ReadCheckpoint(BODY *body, CONTROL *control, FILES *files, SYSTEM *system,
+                    UPDATE *update, fnUpdateVariable ***fnUpdate, double *dDt) {
+  char cFile[2 * NAMELEN];
+  FILE *fp;
+
+  sprintf(cFile, "%s.checkpoint", system->cName);
+  fp = fopen(cFile, "rb");
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to open checkpoint %s.\n", cFile);
+    VplanetExit(EXIT_INPUT);
+  }
+
+  CheckpointHeader(fp, control, cFile, 0);
+  CheckpointState(body, control, system, update, fnUpdate, dDt, fp, 0);
+  CheckpointModules(body, control, system, fp, 0);
+  CheckpointOutputFiles(body, control, files, system, fp, 0);
+  fclose(fp);
+
+  if (control->Io.iVerbose >= VERBPROG) {
+    printf("Restarting from %s at t = %.6e years.\n", cFile,
+           control->Evolve.dTime / YEARSEC);
+  }
+}
@@ -0,0 +1,26 @@
+/**
+  @file checkpoint.h
+  @brief Write the evolving state to a binary snapshot and resume from it.
+  @author Rory Barnes ([RoryBarnes](https://github.com/RoryBarnes/))
+  @date Oct 16 2026
+*/
+
+/* First bytes of every checkpoint */
+#define CHECKPOINTMAGIC "VPLCKPT2"
+#define CHECKPOINTMAGICLEN 16
+
+void CheckpointData(FILE *, void *, size_t, size_t, int);
+void CheckpointStruct(FILE *, void *, size_t, const size_t[], int, int);
+void InitializeCheckpoint(CONTROL *, UPDATE *, fnUpdateVariable ***);
+void CheckpointFunctions(FILE *, fnUpdateVariable ***, CONTROL *, UPDATE *,
+                         int);
+void CheckpointMatrix(FILE *, double **, int, int, int);
+void CheckpointHeader(FILE *, CONTROL *, char[], int);
+void CheckpointState(BODY *, CONTROL *, SYSTEM *, UPDATE *,
+                     fnUpdateVariable ***, double *, FILE *, int);
+void CheckpointModules(BODY *, CONTROL *, SYSTEM *, FILE *, int);
+void CheckpointOutputFiles(BODY *, CONTROL *, FILES *, SYSTEM *, FILE *, int);
+void WriteCheckpoint(BODY *, CONTROL *, FILES *, SYSTEM *, UPDATE *,
+                     fnUpdateVariable ***, double *);
+void ReadCheckpoint(BODY *, CONTROL *, FILES *, SYSTEM *, UPDATE *,
+                    fnUpdateVariable ***, double *);
@@ -10,6 +10,12 @@
 */
 
 #include "vplanet.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifndef VPLANET_ON_WINDOWS
+#include <pthread.h>
+#endif
 
 void BodyCopyNULL(BODY *dest, BODY *src, int foo, int iNumBodies, int iBody) {
   // Nothing
@@ -176,14 +182,11 @@ void InitializeControlEvolve(BODY *body, CONTROL *control, MODULE *module,
     }
   }
 
-  /* Currently this only matters for RK4 integration. This should
-     be generalized for any integration method. */
-  if (control->Evolve.iOneStep == RUNGEKUTTA) {
-    control->Evolve.daDeriv = malloc(4 * sizeof(double **));
-    control->Evolve.daDerivProc = malloc(4 * sizeof(double ***));
-    for (iSubStep = 0; iSubStep < 4; iSubStep++) {
-      control->Evolve.daDeriv[iSubStep] =
-            malloc(control->Evolve.iNumBodies * sizeof(double *));
+  /* Storage for the intermediate stages of the Runge-Kutta methods. RK4
+     uses the first 4 stages, RK45 all NUMSTAGES. */
+  if (control->Evolve.iOneStep != EULER) {
+    control->Evolve.daDerivProc = malloc(NUMSTAGES * sizeof(double ***));
+    for (iSubStep = 0; iSubStep < NUMSTAGES; iSubStep++) {
       control->Evolve.daDerivProc[iSubStep] =
             malloc(control->Evolve.iNumBodies * sizeof(double **));
     }
@@ -464,7 +467,7 @@ void WriteHelpOption(OPTIONS *options, int bLong) {
       } else {
         fprintf(stderr, "ERROR: Unknown value for typestr in "
                         "control.c:WriteHelpOption.\n");
-        exit(EXIT_UNITS);
+        VplanetExit(EXIT_UNITS);
       }
       printf("| Type            || %s", typestr);
       for (typelen = 0; typelen < (iMaxChars - strlen(typestr)); typelen++) {
@@ -734,16 +737,281 @@ void Help(OPTIONS *options, OUTPUT *output, char exe[], int bLong) {
          options[OPT_OUTPUTORDER].cName);
   HelpOutput(output, bLong);
 
-  exit(0);
+  VplanetExit(0);
+}
+
+/*
+ * Runs
+ */
+
+/* The run in progress on this thread, i.e. where VplanetExit returns to and
+   the list its allocations are recorded in. Each thread has its own, so the
+   OpenMP threads and the output writer are never in a run. */
+static THREADLOCAL CONTROL *controlRun = NULL;
+
+#ifndef VPLANET_ON_WINDOWS
+/* An allocation can be freed by another thread than the one that made it, so
+   the lists are only changed under this lock */
+static pthread_mutex_t mutexRunAllocs = PTHREAD_MUTEX_INITIALIZER;
+#define LOCKRUNALLOCS() pthread_mutex_lock(&mutexRunAllocs)
+#define UNLOCKRUNALLOCS() pthread_mutex_unlock(&mutexRunAllocs)
+#else
+#define LOCKRUNALLOCS()
+#define UNLOCKRUNALLOCS()
+#endif
+
+/**
+Make control the run in progress on this thread. Its pjmpErrorReturn is where
+VplanetExit returns to.
+
+@param control Control struct of the run, or NULL if none is in progress
+@return The previous run, to be restored when this one returns
+*/
+CONTROL *SetRunControl(CONTROL *control) {
+  CONTROL *controlPrevious;
+
+  controlPrevious = controlRun;
+  controlRun      = control;
+  return controlPrevious;
+}
+
+/**
+Can VplanetExit jump to the return point of the run? A jump out of an OpenMP
+parallel region, e.g. in EvaluateDerivativesParallel, is undefined, so there
+the process ends instead. Other threads, e.g. the output writer, are not in a
+run.
+
+@param control Control struct of the run on this thread, or NULL
+@return 1 if the return point may be jumped to, else 0
+*/
+int fbCanJumpToErrorReturn(CONTROL *control) {
+  if (control == NULL || control->pjmpErrorReturn == NULL) {
+    return 0;
+  }
+#ifdef _OPENMP
+  if (omp_get_level() > 0) {
+    return 0;
+  }
+#endif
+  return 1;
+}
+
+/**
+End the current run. Errors anywhere in the code end here, and return to
+the caller of the run, e.g. the Python interpreter, with iCode in the run's
+iErrorCode, or else end the process with iCode. Never returns.
+
+@param iCode Exit code, EXIT_* or 0
+*/
+NORETURN void VplanetExit(int iCode) {
+  CONTROL *control = controlRun;
+
+  if (fbCanJumpToErrorReturn(control)) {
+    control->iErrorCode = iCode;
+    longjmp(*control->pjmpErrorReturn, 1);
+  }
+  exit(iCode);
+}
+
+/* Memory. Every malloc, calloc, realloc and free goes through these, see the
+   end of vplanet.h. An allocation made during a run is recorded in the run's
+   list, and FreeRunAllocs frees what the run did not, on success or error, so
+   a process can run many times. New memory is zeroed, so a run does not
+   depend on what earlier runs left in the heap. */
+
+/**
+Put an allocation on a list.
+
+@param alloc Header of the allocation
+@param phead List, or NULL to keep the allocation off any list
+*/
+void LinkRunAlloc(RUNALLOC *alloc, RUNALLOC **phead) {
+  alloc->link.phead = phead;
+  alloc->link.prev  = NULL;
+  alloc->link.next  = NULL;
+  if (phead == NULL) {
+    return;
+  }
+  LOCKRUNALLOCS();
+  alloc->link.next = *phead;
+  if (*phead != NULL) {
+    (*phead)->link.prev = alloc;
+  }
+  *phead = alloc;
+  UNLOCKRUNALLOCS();
+}
+
+/**
+Take an allocation off its list, if it is on one.
+
+@param alloc Header of the allocation
+*/
+void UnlinkRunAlloc(RUNALLOC *alloc) {
+  if (alloc->link.phead == NULL) {
+    return;
+  }
+  LOCKRUNALLOCS();
+  if (alloc->link.prev != NULL) {
+    alloc->link.prev->link.next = alloc->link.next;
+  } else {
+    *alloc->link.phead = alloc->link.next;
+  }
+  if (alloc->link.next != NULL) {
+    alloc->link.next->link.prev = alloc->link.prev;
+  }
+  UNLOCKRUNALLOCS();
+}
+
+/**
+The list that new allocations on this thread go on.
+
+@return List of the run in progress, or NULL if none is recording
+*/
+RUNALLOC **RunAllocsOfThread(void) {
+  if (controlRun != NULL && controlRun->bRunAllocs) {
+    return &controlRun->allocs;
+  }
+  return NULL;
+}
+
+/**
+Allocate zeroed memory with a header, on a list.
+
+@param iSize Size in bytes
+@param phead List, or NULL
+@return The memory, or NULL if it cannot be allocated
+*/
+void *fvAllocOnList(size_t iSize, RUNALLOC **phead) {
+  RUNALLOC *alloc;
+
+  alloc = (calloc)(1, sizeof(RUNALLOC) + iSize);
+  if (alloc == NULL) {
+    return NULL;
+  }
+  alloc->link.iSize = iSize;
+  LinkRunAlloc(alloc, phead);
+  return alloc + 1;
+}
+
+/**
+Allocate zeroed memory, freed at the end of the run in progress if it is not
+freed before.
+
+@param iSize Size in bytes
+@return The memory, or NULL if it cannot be allocated
+*/
+void *fvRunMalloc(size_t iSize) {
+  return fvAllocOnList(iSize, RunAllocsOfThread());
+}
+
+/**
+Allocate iNum zeroed elements, as fvRunMalloc.
+
+@param iNum Number of elements
+@param iSize Size of each element in bytes
+@return The memory, or NULL if it cannot be allocated
+*/
+void *fvRunCalloc(size_t iNum, size_t iSize) {
+  return fvAllocOnList(iNum * iSize, RunAllocsOfThread());
+}
+
+/**
+Allocate memory that outlives the run in progress, e.g. what the options of
+every run share. It must be freed explicitly.
+
+@param iSize Size in bytes
+@return The memory
+*/
+void *fvMallocOutsideRun(size_t iSize) {
+  return fvAllocOnList(iSize, NULL);
+}
+
+/**
+Resize an allocation. It stays on the list it was on, and the added memory is
+zeroed.
+
+@param pv Allocation, or NULL to allocate
+@param iSize New size in bytes
+@return The memory, or NULL if it cannot be allocated
+*/
+void *fvRunRealloc(void *pv, size_t iSize) {
+  RUNALLOC *alloc, *allocNew, **phead;
+  size_t iOldSize;
+
+  if (pv == NULL) {
+    return fvRunMalloc(iSize);
+  }
+  alloc    = (RUNALLOC *)pv - 1;
+  phead    = alloc->link.phead;
+  iOldSize = alloc->link.iSize;
+  UnlinkRunAlloc(alloc);
+  allocNew = (realloc)(alloc, sizeof(RUNALLOC) + iSize);
+  if (allocNew == NULL) {
+    LinkRunAlloc(alloc, phead);
+    return NULL;
+  }
+  if (iSize > iOldSize) {
+    memset((char *)(allocNew + 1) + iOldSize, 0, iSize - iOldSize);
+  }
+  allocNew->link.iSize = iSize;
+  LinkRunAlloc(allocNew, phead);
+  return allocNew + 1;
+}
+
+/**
+Free an allocation, and take it off its list.
+
+@param pv Allocation, or NULL
+*/
+void RunFree(void *pv) {
+  RUNALLOC *alloc;
+
+  if (pv == NULL) {
+    return;
+  }
+  alloc = (RUNALLOC *)pv - 1;
+  UnlinkRunAlloc(alloc);
+  (free)(alloc);
+}
+
+/**
+Record the allocations made on this thread from now on in control, which must
+be the run in progress.
+
+@param control Control struct of the run
+*/
+void BeginRunAllocs(CONTROL *control) {
+  control->allocs     = NULL;
+  control->bRunAllocs = 1;
+}
+
+/**
+Free every allocation the run made and did not free, and stop recording.
+
+@param control Control struct of the run
+*/
+void FreeRunAllocs(CONTROL *control) {
+  RUNALLOC *alloc, *allocNext;
+
+  control->bRunAllocs = 0;
+  LOCKRUNALLOCS();
+  alloc           = control->allocs;
+  control->allocs = NULL;
+  UNLOCKRUNALLOCS();
+  while (alloc != NULL) {
+    allocNext = alloc->link.next;
+    (free)(alloc);
+    alloc = allocNext;
+  }
 }
 
 /*
  * I/O
  */
 
-void LineExit(char cFile[], int iLine) {
+NORETURN void LineExit(char cFile[], int iLine) {
   fprintf(stderr, "\t%s: Line %d\n", cFile, iLine + 1);
-  exit(EXIT_INPUT);
+  VplanetExit(EXIT_INPUT);
 }
 
 char *sLower(char cString[]) {
@@ -889,7 +1157,7 @@ double fdUnitsLength(int iType) {
     return AUM;
   } else {
     fprintf(stderr, "ERROR: Unknown iUnitLength %d.\n", iType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
@@ -910,7 +1178,7 @@ void fsUnitsLength(int iType, char cUnit[]) {
     sprintf(cUnit, "au");
   } else {
     fprintf(stderr, "ERROR: Unknown iUnitLength %d.\n", iType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
@@ -928,7 +1196,7 @@ double fdUnitsTime(int iType) {
     return 1e9 * YEARSEC;
   } else {
     fprintf(stderr, "ERROR: Unknown iUnitTime: %d.\n", iType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
@@ -945,7 +1213,7 @@ void fsUnitsTime(int iType, char cUnit[]) {
     sprintf(cUnit, "Gyr");
   } else {
     fprintf(stderr, "ERROR: Unknown iUnitTime: %d.\n", iType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
@@ -964,7 +1232,7 @@ double fdUnitsMass(int iType) {
     return MNEP;
   } else {
     fprintf(stderr, "ERROR: Unknown iUnitMass: %d.\n", iType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
@@ -984,7 +1252,7 @@ void fsUnitsMass(int iType, char cUnit[]) {
 
   } else {
     fprintf(stderr, "ERROR: Unknown iUnitMass: %d.\n", iType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
@@ -995,7 +1263,7 @@ double fdUnitsAngle(int iType) {
     return DEGRAD;
   } else {
     fprintf(stderr, "ERROR: Unknown Angle type %d\n.", iType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
@@ -1006,7 +1274,7 @@ void fsUnitsAngle(int iType, char cUnit[]) {
     sprintf(cUnit, "deg");
   } else {
     fprintf(stderr, "ERROR: Unknown Angle type %d\n.", iType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
@@ -1140,7 +1408,7 @@ double fdUnitsTemp(double dTemp, int iOldType, int iNewType) {
       return dTemp;
     } else {
       fprintf(stderr, "ERROR: Unknown Temperature type %d.\n", iNewType);
-      exit(EXIT_UNITS);
+      VplanetExit(EXIT_UNITS);
     }
   } else if (iOldType == U_CELSIUS) {
     if (iNewType == U_KELVIN) {
@@ -1153,7 +1421,7 @@ double fdUnitsTemp(double dTemp, int iOldType, int iNewType) {
       return dTemp;
     } else {
       fprintf(stderr, "ERROR: Unknown Temperature type %d.\n", iNewType);
-      exit(EXIT_UNITS);
+      VplanetExit(EXIT_UNITS);
     }
   } else if (iOldType == U_FARENHEIT) {
     if (iNewType == U_KELVIN) {
@@ -1166,11 +1434,11 @@ double fdUnitsTemp(double dTemp, int iOldType, int iNewType) {
       return dTemp;
     } else {
       fprintf(stderr, "ERROR: Unknown Temperature type %d.\n", iNewType);
-      exit(EXIT_UNITS);
+      VplanetExit(EXIT_UNITS);
     }
   } else {
     fprintf(stderr, "ERROR: Unknown Temperature type %d.\n", iOldType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
@@ -1183,7 +1451,7 @@ void fsUnitsTemp(int iType, char cUnit[]) {
     sprintf(cUnit, "F");
   } else {
     fprintf(stderr, "ERROR: Unknown iUnitTemp %d.\n", iType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
@@ -1197,7 +1465,7 @@ void fsUnitsTempRate(int iType, char cUnit[]) {
     sprintf(cUnit, "F/s");
   } else {
     fprintf(stderr, "ERROR: Unknown iUnitTempRate %d.\n", iType);
-    exit(EXIT_UNITS);
+    VplanetExit(EXIT_UNITS);
   }
 }
 
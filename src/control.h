@@ -23,7 +23,21 @@ void HelpOptions(OPTIONS *, int);
 void HelpOutput(OUTPUT *, int);
 void Help(OPTIONS *, OUTPUT *, char[], int);
 
-void LineExit(char[], int);
+CONTROL *SetRunControl(CONTROL *);
+int fbCanJumpToErrorReturn(CONTROL *);
+void LinkRunAlloc(RUNALLOC *, RUNALLOC **);
+void UnlinkRunAlloc(RUNALLOC *);
+RUNALLOC **RunAllocsOfThread(void);
+void *fvAllocOnList(size_t, RUNALLOC **);
+void *fvRunMalloc(size_t);
+void *fvRunCalloc(size_t, size_t);
+void *fvRunRealloc(void *, size_t);
+void *fvMallocOutsideRun(size_t);
+void RunFree(void *);
+void BeginRunAllocs(CONTROL *);
+void FreeRunAllocs(CONTROL *);
+NORETURN void VplanetExit(int);
+NORETURN void LineExit(char[], int);
 char *sLower(char[]);
 void fprintd(FILE *, double, int, int);
 
@@ -495,7 +495,7 @@ void VerifyOrbitModel(CONTROL *control, FILES *files, OPTIONS *options) {
         }
       }
     }
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   if (iFound == 0) {
@@ -542,7 +542,7 @@ void VerifyPericenter(BODY *body, CONTROL *control, OPTIONS *options,
               options[OPT_LONGA].cName, options[OPT_LONGP].cName,
               options[OPT_ARGP].cName, cFile);
     }
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   /* At least 2 must be set */
@@ -557,7 +557,7 @@ void VerifyPericenter(BODY *body, CONTROL *control, OPTIONS *options,
               options[OPT_LONGA].cName, options[OPT_LONGP].cName,
               options[OPT_ARGP].cName, cFile);
     }
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   /* Were all set? */
@@ -569,7 +569,7 @@ void VerifyPericenter(BODY *body, CONTROL *control, OPTIONS *options,
                      options[OPT_LONGA].iLine[iBody + 1],
                      options[OPT_LONGP].iLine[iBody + 1],
                      options[OPT_ARGP].iLine[iBody + 1], cFile, iVerbose);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   /* Was LONGA set? */
@@ -751,7 +751,7 @@ void VerifyPerturbersDistOrbRD4(BODY *body, int iNumBodies, int iBody) {
     if (j != iBody) {
       if (body[j].bDistOrb == 0) {
         fprintf(stderr, "ERROR: DistOrb must be the called for all planets\n");
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
       body[iBody].iaGravPerts[iPert] = j;
       iPert++;
@@ -868,7 +868,7 @@ void VerifyPerturbersDistOrbLL2(BODY *body, int iNumBodies, int iBody) {
   for (j = 1; j < iNumBodies; j++) {
     if (body[j].bDistOrb == 0) {
       fprintf(stderr, "ERROR: DistOrb must be the called for all planets\n");
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
     body[iBody].iaGravPerts[iPert] = j;
     iPert++;
@@ -882,7 +882,7 @@ void VerifyGRCorrLL2(BODY *body, int iNumBodies) {
     if (body[iBody].bGRCorr != body[1].bGRCorr) {
       fprintf(stderr, "ERROR: bGRCorr must be the same for all planets in "
                       "DistOrb LL2 model\n");
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
   }
 }
@@ -2269,6 +2269,50 @@ void LogBodyDistOrb(BODY *body, CONTROL *control, OUTPUT *output,
   }
 }
 
+/************ DISTORB Checkpoint Functions **************/
+
+/**
+Write or read the Laplace coefficients and eigensolution, which are only
+recalculated once the semi-major axes have drifted far enough.
+
+@param body Body struct
+@param control Control struct
+@param system System struct
+@param fp Checkpoint file
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointDistOrb(BODY *body, CONTROL *control, SYSTEM *system, FILE *fp,
+                       int bWrite) {
+  int iPair, iNumPairs, iNumPlanets;
+
+  iNumPlanets = control->Evolve.iNumBodies - 1;
+  iNumPairs   = fniNchoosek(iNumPlanets, 2);
+
+  if (control->Evolve.iDistOrbModel == RD4) {
+    for (iPair = 0; iPair < iNumPairs; iPair++) {
+      CheckpointData(fp, system->daLaplaceC[0][iPair], sizeof(double), LAPLNUM,
+                     bWrite);
+      CheckpointData(fp, system->daLaplaceD[0][iPair], sizeof(double), LAPLNUM,
+                     bWrite);
+      CheckpointData(fp, system->daAlpha0[0][iPair], sizeof(double), LAPLNUM,
+                     bWrite);
+    }
+  } else if (control->Evolve.iDistOrbModel == LL2 && !body[1].bEigenSet) {
+    for (iPair = 0; iPair < iNumPairs; iPair++) {
+      CheckpointData(fp, system->daLaplaceD[0][iPair], sizeof(double), 2,
+                     bWrite);
+      CheckpointData(fp, system->daAlpha0[0][iPair], sizeof(double), 1, bWrite);
+    }
+    CheckpointMatrix(fp, system->daEigenValEcc, 2, iNumPlanets, bWrite);
+    CheckpointMatrix(fp, system->daEigenValInc, 2, iNumPlanets, bWrite);
+    CheckpointMatrix(fp, system->daEigenPhase, 2, iNumPlanets, bWrite);
+    CheckpointMatrix(fp, system->daEigenVecEcc, iNumPlanets, iNumPlanets,
+                     bWrite);
+    CheckpointMatrix(fp, system->daEigenVecInc, iNumPlanets, iNumPlanets,
+                     bWrite);
+  }
+}
+
 /************* MODULE Functions ***********/
 
 void AddModuleDistOrb(CONTROL *control, MODULE *module, int iBody,
@@ -2386,7 +2430,7 @@ double fndABmatrix(BODY *body, int j, int jBody, int kBody) {
     fprintf(stderr,
             "ERROR: Body %s and body %s have the same semi-major axis.\n",
             body[kBody].cName, body[jBody].cName);
-    exit(EXIT_INT);
+    VplanetExit(EXIT_INT);
   }
 
   n = KGAUSS * sqrt((body[0].dMass + body[jBody].dMass) / MSUN /
@@ -2503,7 +2547,7 @@ void HessEigen(double **amat, int origsize, double real[], double imag[]) {
         } else {
           if (iterations == 30) {
             fprintf(stderr, "Too many iterations in HessEigen routine\n");
-            exit(EXIT_INPUT);
+            VplanetExit(EXIT_INPUT);
           }
           if (iterations == 10 || iterations == 20) {
             exshift += lrcorner;
@@ -2740,7 +2784,7 @@ void LUDecomp(double **amat, double **copy, double *scale, int *rowswap,
     }
     if (scale[i] == 0.0) {
       fprintf(stderr, "Singular matrix in routine LUDecomp");
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
     for (j = 0; j < size; j++) {
       copy[i][j] = amat[i][j];
@@ -2828,6 +2872,120 @@ void LUSolve(double **lumat, double *soln, int *swap, int size) {
   }
 }
 
+/**
+Decomposes a band matrix to LU form with partial pivoting. On entry row i of
+band holds the elements of columns i-lower to i+upper, so band[i][lower] is
+the diagonal. On exit band holds U, whose rows grow to lower+upper+1
+elements as rows are swapped, and lmat the multipliers of L.
+
+@param band Band of the matrix, size x (lower+upper+1), overwritten with U
+@param lmat Multipliers of L, size x lower
+@param rowswap Indices of swapped rows
+@param size Size of matrix (square)
+@param lower Number of subdiagonals
+@param upper Number of superdiagonals
+*/
+void BandLUDecomp(double **band, double **lmat, int *rowswap, int size,
+                  int lower, int upper) {
+  double dummy;
+  int i, j, k, last, width;
+
+  width = lower + upper + 1;
+
+  // Shift the first rows left so that each row starts at its diagonal
+  last = lower;
+  for (i = 0; i < lower; i++) {
+    for (j = lower - i; j < width; j++) {
+      band[i][j - last] = band[i][j];
+    }
+    last--;
+    for (j = width - last - 1; j < width; j++) {
+      band[i][j] = 0.0;
+    }
+  }
+
+  last = lower;
+  for (k = 0; k < size; k++) {
+    dummy = band[k][0];
+    i     = k;
+    if (last < size) {
+      last++;
+    }
+    for (j = k + 1; j < last; j++) {
+      if (fabs(band[j][0]) > fabs(dummy)) {
+        dummy = band[j][0];
+        i     = j;
+      }
+    }
+    rowswap[k] = i;
+    if (dummy == 0.0) {
+      band[k][0] = TEENY;
+    }
+    if (i != k) {
+      for (j = 0; j < width; j++) {
+        dummy      = band[k][j];
+        band[k][j] = band[i][j];
+        band[i][j] = dummy;
+      }
+    }
+    for (i = k + 1; i < last; i++) {
+      dummy              = band[i][0] / band[k][0];
+      lmat[k][i - k - 1] = dummy;
+      for (j = 1; j < width; j++) {
+        band[i][j - 1] = band[i][j] - dummy * band[k][j];
+      }
+      band[i][width - 1] = 0.0;
+    }
+  }
+}
+
+/**
+Solves system of equations involving a band LU matrix from BandLUDecomp
+
+@param band U matrix
+@param lmat Multipliers of L
+@param soln Vector containing right-hand side on entry, solution on exit
+@param rowswap Indices of swapped rows
+@param size Size of matrix (square)
+@param lower Number of subdiagonals
+@param upper Number of superdiagonals
+*/
+void BandLUSolve(double **band, double **lmat, double *soln, int *rowswap,
+                 int size, int lower, int upper) {
+  int i, k, last, width;
+  double dummy;
+
+  width = lower + upper + 1;
+
+  last = lower;
+  for (k = 0; k < size; k++) {
+    i = rowswap[k];
+    if (i != k) {
+      dummy   = soln[k];
+      soln[k] = soln[i];
+      soln[i] = dummy;
+    }
+    if (last < size) {
+      last++;
+    }
+    for (i = k + 1; i < last; i++) {
+      soln[i] -= lmat[k][i - k - 1] * soln[k];
+    }
+  }
+
+  last = 1;
+  for (i = size - 1; i >= 0; i--) {
+    dummy = soln[i];
+    for (k = 1; k < last; k++) {
+      dummy -= band[i][k] * soln[k + i];
+    }
+    soln[i] = dummy / band[i][0];
+    if (last < width) {
+      last++;
+    }
+  }
+}
+
 /**
 Find eccentricity eigenvectors for LL2 solution
 
@@ -3058,6 +3216,8 @@ void RecalcLaplace(BODY *body, EVOLVE *evolve, SYSTEM *system, int iVerbose) {
                 system->fnLaplaceDeriv[j][0](alpha1, 0);
 
           system->daAlpha0[0][system->iaLaplaceN[iBody][jBody]][j] = alpha1;
+          // The derivatives at the end of the last step are now stale
+          evolve->bFSAL = 0;
           // if (iVerbose > VERBPROG)
           // //     printf("Laplace function %d recalculated for bodies (%d, %d)
           // at %f years\n",j+1,iBody,jBody,evolve->dTime/YEARSEC);
@@ -3098,6 +3258,8 @@ void RecalcEigenVals(BODY *body, EVOLVE *evolve, SYSTEM *system) {
   }
 
   if (dalpha > system->dDfcrit) {
+    // The derivatives at the end of the last step are now stale
+    evolve->bFSAL = 0;
     SolveEigenVal(body, evolve, system);
     ScaleEigenVec(body, evolve, system);
     for (iBody = 1; iBody < evolve->iNumBodies - 1; iBody++) {
@@ -85,6 +85,7 @@
 
 void AddModuleDistOrb(CONTROL *, MODULE *, int, int);
 void BodyCopyDistOrb(BODY *, BODY *, int, int, int);
+void CheckpointDistOrb(BODY *, CONTROL *, SYSTEM *, FILE *, int);
 void InitializeBodyDistOrb(BODY *, CONTROL *, UPDATE *, int, int);
 void InitializeUpdateTmpBodyDistOrb(BODY *, CONTROL *, UPDATE *, int);
 
@@ -181,6 +182,8 @@ void ludcmp(double **, int, int *, float *);
 void LUDecomp(double **, double **, double *, int *, int);
 
 void LUSolve(double **, double *, int *, int);
+void BandLUDecomp(double **, double **, int *, int, int, int);
+void BandLUSolve(double **, double **, double *, int *, int, int, int);
 void BalanceMatrix(double **, int);
 void lubksb(double **, int, int *, double[]);
 void FindEigenVecEcc(SYSTEM *, int, int);
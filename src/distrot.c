@@ -25,16 +25,16 @@ void BodyCopyDistRot(BODY *dest, BODY *src, int iTideModel, int iNumBodies,
   dest[iBody].dYobl           = src[iBody].dYobl;
   dest[iBody].dZobl           = src[iBody].dZobl;
   dest[iBody].dDynEllip       = src[iBody].dDynEllip;
-  dest[iBody].bForcePrecRate  = src[iBody].bForcePrecRate;
   dest[iBody].dPrecRate       = src[iBody].dPrecRate;
   dest[iBody].iCurrentStep    = src[iBody].iCurrentStep;
-  dest[iBody].bReadOrbitData  = src[iBody].bReadOrbitData;
-  dest[iBody].bCalcDynEllip   = src[iBody].bCalcDynEllip;
   dest[iBody].dSpecMomInertia = src[iBody].dSpecMomInertia;
 }
 
 void InitializeUpdateTmpBodyDistRot(BODY *body, CONTROL *control,
                                     UPDATE *update, int iBody) {
+  control->Evolve.tmpBody[iBody].bForcePrecRate = body[iBody].bForcePrecRate;
+  control->Evolve.tmpBody[iBody].bReadOrbitData = body[iBody].bReadOrbitData;
+
   if (body[iBody].bReadOrbitData) {
     int iLine;
 
@@ -411,12 +411,12 @@ void VerifyOrbitData(BODY *body, CONTROL *control, OPTIONS *options,
       fprintf(stderr, "ERROR: Must set %s if using %s for file %s\n",
               options[OPT_FILEORBITDATA].cName,
               options[OPT_READORBITDATA].cName, body[iBody].cName);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     } else {
       fileorb = fopen(body[iBody].cFileOrbitData, "r");
       if (fileorb == NULL) {
         printf("ERROR: File %s not found.\n", body[iBody].cFileOrbitData);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
       // Check file has exactly 7 columns
       fgets(cLine, LINE, fileorb);
@@ -429,7 +429,7 @@ void VerifyOrbitData(BODY *body, CONTROL *control, OPTIONS *options,
                   iNumColsFound, options[OPT_READORBITDATA].cName,
                   body[iBody].cFileOrbitData, iNumCols);
         }
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
 
 
@@ -498,7 +498,7 @@ void VerifyOrbitData(BODY *body, CONTROL *control, OPTIONS *options,
       fprintf(stderr,
               "ERROR: Cannot use variable time step (%s = 1) if %s = 1\n",
               options[OPT_VARDT].cName, options[OPT_READORBITDATA].cName);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
     if (control->Evolve.bDoForward) {
       if (body[iBody].daTimeSeries[1] != control->Evolve.dTimeStep) {
@@ -508,7 +508,7 @@ void VerifyOrbitData(BODY *body, CONTROL *control, OPTIONS *options,
                 "(%lf) if %s = 1\n",
                 options[OPT_TIMESTEP].cName, control->Evolve.dTimeStep,
                 body[iBody].daTimeSeries[1], options[OPT_READORBITDATA].cName);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
     } else if (control->Evolve.bDoBackward) {
       if (body[iBody].daTimeSeries[1] != -1 * control->Evolve.dTimeStep) {
@@ -518,7 +518,7 @@ void VerifyOrbitData(BODY *body, CONTROL *control, OPTIONS *options,
                 "(%lf) if %s = 1\n",
                 options[OPT_TIMESTEP].cName, control->Evolve.dTimeStep,
                 body[iBody].daTimeSeries[1], options[OPT_READORBITDATA].cName);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
     }
     if (iNLines < (control->Evolve.dStopTime / control->Evolve.dTimeStep + 1)) {
@@ -526,7 +526,7 @@ void VerifyOrbitData(BODY *body, CONTROL *control, OPTIONS *options,
               "ERROR: Final time in %s is less than %s; simulation cannot be "
               "completed.\n",
               options[OPT_FILEORBITDATA].cName, options[OPT_STOPTIME].cName);
-      exit(EXIT_INPUT); // Should really be a DoubleLineExit
+      VplanetExit(EXIT_INPUT); // Should really be a DoubleLineExit
     }
   }
 }
@@ -1709,7 +1709,7 @@ void PropsAuxDistRot(BODY *body, EVOLVE *evolve, IO *io, UPDATE *update,
       fprintf(stderr, "\tYobl: %.6e\n", body[iBody].dYobl);
       fprintf(stderr, "\tZobl: %.6e\n", body[iBody].dZobl);
     }
-    exit(EXIT_INT);
+    VplanetExit(EXIT_INT);
   }
 
   body[iBody].dObliquity = atan2(sqrt(body[iBody].dXobl * body[iBody].dXobl +
@@ -1723,6 +1723,8 @@ void ForceBehaviorDistRot(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
                           int iModule) {
   if (body[iBody].bReadOrbitData) {
     body[iBody].iCurrentStep++;
+    // The derivatives read the orbit at the new step
+    evolve->bFSAL = 0;
   }
 }
 
@@ -0,0 +1,1399 @@
+/**
+  @file ensemble.c
+  @brief Run many members of one template system in a single process.
+
+  An ensemble is a template input (the primary file and its body files) plus
+  a parameter table. The first valid line of the table names the overridden
+  options as file:option, e.g. "earth.in:dSemi", and every following line is
+  one member system. The options and outputs are initialized once, and each
+  member is integrated in a child process that inherits them, so a member
+  costs a fork instead of a full start-up. A member's input files are built
+  in memory and its outputs are written in a directory of its own. Members
+  are independent: one that fails on an input error does not stop the
+  others.
+
+  With -l each child integrates a block of up to ENSEMBLELANES members in
+  lockstep. The members that use the 4th order Runge-Kutta integrator and
+  share one layout of equations become the lanes of one step: the state and
+  stage derivatives of all lanes are stored variable by variable, the stage
+  updates are vector loops across the lanes, and derivatives that have a
+  lane kernel, see fnLaneKernel, are evaluated for all lanes at once. Each
+  lane keeps its own timestep, outputs and halts, and a lane that halts or
+  fails is masked out of the rest of the step. Members that cannot join the
+  lanes are integrated one after another by Evolve.
+
+  @author Rory Barnes ([RoryBarnes](https://github.com/RoryBarnes/))
+  @date Oct 16 2026
+*/
+
+#include "vplanet.h"
+#include <errno.h>
+#ifndef VPLANET_ON_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#endif
+
+/**
+Number of members to run at once. A positive request is used as is, otherwise
+the environment variable VPLANET_NUM_THREADS, and then the number of online
+processors.
+
+@param iRequest Number of jobs from the -j flag, 0 if not set
+@return Number of members to run at once
+*/
+int fiNumEnsembleJobs(int iRequest) {
+  char *cEnv;
+  int iNumJobs = 1;
+
+  if (iRequest > 0) {
+    return iRequest;
+  }
+  cEnv = getenv("VPLANET_NUM_THREADS");
+  if (cEnv != NULL && atoi(cEnv) > 0) {
+    return atoi(cEnv);
+  }
+#ifdef _SC_NPROCESSORS_ONLN
+  iNumJobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+  if (iNumJobs < 1) {
+    iNumJobs = 1;
+  }
+  return iNumJobs;
+}
+
+/**
+Collect the template input files: the primary file and its saBodyFiles.
+Members are written into their own directories, so the files must sit in the
+current directory.
+
+@param ensemble Ensemble struct
+@param cInfile Primary input file
+@param iVerbose Verbosity level
+*/
+void ReadEnsembleTemplate(ENSEMBLE *ensemble, char cInfile[], int iVerbose) {
+  char saTmp[MAXARRAY][OPTLEN];
+  int iFile, iNumIndices = 0, iNumLines = 0, *iLine;
+
+  iLine = malloc(MAXLINES * sizeof(int));
+  AddOptionStringArray(cInfile, "saBodyFiles", saTmp, &iNumIndices,
+                       &iNumLines, iLine, iVerbose);
+  free(iLine);
+  /* The lookup cached the template's primary file; each member must read its
+     own, with the member's overrides applied. */
+  FreeInputTables();
+
+  if (iNumIndices == 0) {
+    fprintf(stderr, "ERROR: Option saBodyFiles not found in %s.\n", cInfile);
+    VplanetExit(EXIT_INPUT);
+  }
+  if (iNumIndices + 1 > MAXFILES) {
+    fprintf(stderr, "ERROR: Ensemble template has more than %d files.\n",
+            MAXFILES);
+    VplanetExit(EXIT_INPUT);
+  }
+
+  ensemble->iNumFiles = iNumIndices + 1;
+  strcpy(ensemble->saFile[0], cInfile);
+  for (iFile = 0; iFile < iNumIndices; iFile++) {
+    strcpy(ensemble->saFile[iFile + 1], saTmp[iFile]);
+  }
+  for (iFile = 0; iFile < ensemble->iNumFiles; iFile++) {
+    if (strchr(ensemble->saFile[iFile], '/') != NULL) {
+      fprintf(stderr,
+              "ERROR: Ensemble input file %s must be in the current "
+              "directory.\n",
+              ensemble->saFile[iFile]);
+      VplanetExit(EXIT_INPUT);
+    }
+  }
+}
+
+/**
+Read the parameter table. Blank lines and lines starting with # are skipped.
+
+@param ensemble Ensemble struct, with the template files already read
+@param cTable Name of the parameter table
+@param iVerbose Verbosity level
+*/
+void ReadEnsembleTable(ENSEMBLE *ensemble, char cTable[], int iVerbose) {
+  FILE *fp;
+  char cLine[LINE], *cWord, *cColon, *cDot;
+  int iCol, iFile, iLineNum = 0, iMaxMembers = 64;
+
+  fp = fopen(cTable, "r");
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to open ensemble table %s.\n", cTable);
+    VplanetExit(EXIT_INPUT);
+  }
+  strcpy(ensemble->cTable, cTable);
+
+  /* Members go in <table stem>_ensemble/ */
+  strcpy(ensemble->cDir, cTable);
+  cDot = strrchr(ensemble->cDir, '.');
+  if (cDot != NULL && strchr(cDot, '/') == NULL) {
+    *cDot = '\0';
+  }
+  if (strlen(ensemble->cDir) + strlen(ENSEMBLEDIR) >= NAMELEN) {
+    fprintf(stderr, "ERROR: Ensemble table name %s is too long.\n", cTable);
+    VplanetExit(EXIT_INPUT);
+  }
+  strcat(ensemble->cDir, ENSEMBLEDIR);
+
+  ensemble->iNumCols    = 0;
+  ensemble->iNumMembers = 0;
+  ensemble->saaValue    = malloc(iMaxMembers * sizeof(char **));
+
+  while (fgets(cLine, LINE, fp) != NULL) {
+    iLineNum++;
+    cWord = strtok(cLine, " \t\r\n");
+    if (cWord == NULL || cWord[0] == '#') {
+      continue;
+    }
+
+    if (ensemble->iNumCols == 0) {
+      /* Header: file:option for every column */
+      ensemble->iaColFile   = malloc(MAXARRAY * sizeof(int));
+      ensemble->saColOption = malloc(MAXARRAY * sizeof(char *));
+      while (cWord != NULL) {
+        if (ensemble->iNumCols == MAXARRAY) {
+          fprintf(stderr, "ERROR: Ensemble table %s has more than %d columns.\n",
+                  cTable, MAXARRAY);
+          VplanetExit(EXIT_INPUT);
+        }
+        cColon = strchr(cWord, ':');
+        if (cColon == NULL) {
+          fprintf(stderr,
+                  "ERROR: Ensemble column %s must have the form file:option. "
+                  "File: %s, Line: %d.\n",
+                  cWord, cTable, iLineNum);
+          VplanetExit(EXIT_INPUT);
+        }
+        *cColon = '\0';
+        iCol    = ensemble->iNumCols;
+        ensemble->iaColFile[iCol] = -1;
+        for (iFile = 0; iFile < ensemble->iNumFiles; iFile++) {
+          if (strcmp(cWord, ensemble->saFile[iFile]) == 0) {
+            ensemble->iaColFile[iCol] = iFile;
+          }
+        }
+        if (ensemble->iaColFile[iCol] == -1) {
+          fprintf(stderr,
+                  "ERROR: Ensemble column file %s is not an input file of "
+                  "%s. File: %s, Line: %d.\n",
+                  cWord, ensemble->saFile[0], cTable, iLineNum);
+          VplanetExit(EXIT_INPUT);
+        }
+        ensemble->saColOption[iCol] = malloc(OPTLEN * sizeof(char));
+        strncpy(ensemble->saColOption[iCol], cColon + 1, OPTLEN - 1);
+        ensemble->saColOption[iCol][OPTLEN - 1] = '\0';
+        ensemble->iNumCols++;
+        cWord = strtok(NULL, " \t\r\n");
+      }
+      continue;
+    }
+
+    /* Member row */
+    if (ensemble->iNumMembers == iMaxMembers) {
+      iMaxMembers *= 2;
+      ensemble->saaValue =
+            realloc(ensemble->saaValue, iMaxMembers * sizeof(char **));
+    }
+    ensemble->saaValue[ensemble->iNumMembers] =
+          malloc(ensemble->iNumCols * sizeof(char *));
+    for (iCol = 0; iCol < ensemble->iNumCols; iCol++) {
+      if (cWord == NULL) {
+        fprintf(stderr,
+                "ERROR: Ensemble table row has %d values, but %d columns. "
+                "File: %s, Line: %d.\n",
+                iCol, ensemble->iNumCols, cTable, iLineNum);
+        VplanetExit(EXIT_INPUT);
+      }
+      ensemble->saaValue[ensemble->iNumMembers][iCol] =
+            malloc(OPTLEN * sizeof(char));
+      strncpy(ensemble->saaValue[ensemble->iNumMembers][iCol], cWord,
+              OPTLEN - 1);
+      ensemble->saaValue[ensemble->iNumMembers][iCol][OPTLEN - 1] = '\0';
+      cWord = strtok(NULL, " \t\r\n");
+    }
+    if (cWord != NULL) {
+      fprintf(stderr,
+              "ERROR: Ensemble table row has more values than columns. "
+              "File: %s, Line: %d.\n",
+              cTable, iLineNum);
+      VplanetExit(EXIT_INPUT);
+    }
+    ensemble->iNumMembers++;
+  }
+  fclose(fp);
+
+  if (ensemble->iNumMembers == 0) {
+    fprintf(stderr, "ERROR: Ensemble table %s has no members.\n", cTable);
+    VplanetExit(EXIT_INPUT);
+  }
+  if (iVerbose >= VERBINPUT) {
+    printf("Ensemble table %s read: %d members, %d options.\n", cTable,
+           ensemble->iNumMembers, ensemble->iNumCols);
+  }
+}
+
+/**
+Does an input line continue onto the next valid line? As in GetWords, the
+last word before any comment must end in $.
+
+@param cLine Line of an input file
+@return 1 if the line continues, 0 otherwise
+*/
+int fbEnsembleLineContinues(char cLine[]) {
+  int iPos, iEnd;
+
+  iEnd = strlen(cLine);
+  for (iPos = 0; iPos < iEnd; iPos++) {
+    if (cLine[iPos] == '#') {
+      iEnd = iPos;
+    }
+  }
+  while (iEnd > 0 && isspace(cLine[iEnd - 1])) {
+    iEnd--;
+  }
+  return iEnd > 0 && cLine[iEnd - 1] == '$';
+}
+
+/**
+Register the texts of a member's input files with AddInputText, so the member
+reads them from memory. A line whose first word is an overridden option is
+replaced by the member's value, together with any lines it continues onto
+with $; options that do not appear in the template are appended to the end
+of the file.
+
+@param ensemble Ensemble struct
+@param iMember Index of the member
+*/
+void AddEnsembleMember(ENSEMBLE *ensemble, int iMember) {
+#ifndef VPLANET_ON_WINDOWS
+  FILE *fpIn, *fpOut;
+  char cLine[LINE], cWord[LINE], *cText;
+  size_t iSize;
+  int iFile, iCol, bReplaced, bContinued, *bUsed;
+
+  bUsed = calloc(ensemble->iNumCols, sizeof(int));
+
+  for (iFile = 0; iFile < ensemble->iNumFiles; iFile++) {
+    fpIn = fopen(ensemble->saFile[iFile], "r");
+    if (fpIn == NULL) {
+      fprintf(stderr, "ERROR: Unable to open %s.\n", ensemble->saFile[iFile]);
+      VplanetExit(EXIT_INPUT);
+    }
+    fpOut = open_memstream(&cText, &iSize);
+    if (fpOut == NULL) {
+      fprintf(stderr, "ERROR: Unable to build the input of member %d.\n",
+              iMember);
+      VplanetExit(EXIT_EXE);
+    }
+
+    bContinued = 0;
+    while (fgets(cLine, LINE, fpIn) != NULL) {
+      bReplaced = 0;
+      cWord[0]  = '\0';
+      sscanf(cLine, "%s", cWord);
+      if (bContinued) {
+        /* The rest of a replaced array; blank and comment lines, which
+           GetNextValidLine skips, are kept. */
+        if (cWord[0] != '\0' && cWord[0] != '#' && cWord[0] != '$') {
+          bContinued = fbEnsembleLineContinues(cLine);
+          continue;
+        }
+        fputs(cLine, fpOut);
+        continue;
+      }
+      for (iCol = 0; iCol < ensemble->iNumCols; iCol++) {
+        if (ensemble->iaColFile[iCol] == iFile &&
+            strcmp(cWord, ensemble->saColOption[iCol]) == 0) {
+          fprintf(fpOut, "%s %s\n", ensemble->saColOption[iCol],
+                  ensemble->saaValue[iMember][iCol]);
+          bUsed[iCol] = 1;
+          bReplaced   = 1;
+          bContinued  = fbEnsembleLineContinues(cLine);
+        }
+      }
+      if (!bReplaced) {
+        fputs(cLine, fpOut);
+      }
+    }
+    for (iCol = 0; iCol < ensemble->iNumCols; iCol++) {
+      if (ensemble->iaColFile[iCol] == iFile && !bUsed[iCol]) {
+        fprintf(fpOut, "\n%s %s\n", ensemble->saColOption[iCol],
+                ensemble->saaValue[iMember][iCol]);
+      }
+    }
+    fclose(fpIn);
+    fclose(fpOut);
+    AddInputText(ensemble->saFile[iFile], cText);
+    // Allocated by the C library, not recorded by the run
+    (free)(cText);
+  }
+  free(bUsed);
+#endif
+}
+
+/**
+Name of a member's output directory, <table stem>_ensemble/<i>.
+
+@param ensemble Ensemble struct
+@param iMember Index of the member
+@param cDir The name, at least 2*NAMELEN+1 characters
+*/
+void EnsembleMemberDir(ENSEMBLE *ensemble, int iMember, char cDir[]) {
+  if (snprintf(cDir, 2 * NAMELEN + 1, "%s/%0*d", ensemble->cDir,
+               ensemble->iWidth, iMember) >= 2 * NAMELEN + 1) {
+    fprintf(stderr, "ERROR: Ensemble member directory %s/%0*d is too long.\n",
+            ensemble->cDir, ensemble->iWidth, iMember);
+    VplanetExit(EXIT_WRITE);
+  }
+}
+
+/**
+Create a member's output directory, if it does not exist yet.
+
+@param cDir Name of the directory
+*/
+void MakeEnsembleMemberDir(char cDir[]) {
+#ifndef VPLANET_ON_WINDOWS
+  if (mkdir(cDir, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "ERROR: Unable to create %s: %s.\n", cDir,
+            strerror(errno));
+    VplanetExit(EXIT_WRITE);
+  }
+#endif
+}
+
+/**
+Report a member if it failed.
+
+@param ensemble Ensemble struct
+@param iMember Index of the member
+@return 1 if the member failed, 0 otherwise
+*/
+int fbReportEnsembleMember(ENSEMBLE *ensemble, int iMember) {
+  if (ensemble->iaStatus[iMember] != 0) {
+    fprintf(stderr, "ERROR: Ensemble member %d failed with status %d.\n",
+            iMember, ensemble->iaStatus[iMember]);
+    return 1;
+  }
+  return 0;
+}
+
+/**
+Record how a member process ended, and report it if it failed.
+
+@param ensemble Ensemble struct
+@param iMember Index of the member
+@param iStatus Status from waitpid, or -1 if waitpid failed
+@return 1 if the member failed, 0 otherwise
+*/
+int fbEnsembleMemberDone(ENSEMBLE *ensemble, int iMember, int iStatus) {
+#ifndef VPLANET_ON_WINDOWS
+  if (iStatus != -1 && WIFEXITED(iStatus)) {
+    ensemble->iaStatus[iMember] = WEXITSTATUS(iStatus);
+  } else {
+    ensemble->iaStatus[iMember] = EXIT_INT;
+  }
+#endif
+  return fbReportEnsembleMember(ensemble, iMember);
+}
+
+/**
+Report the members of a lockstep block once its process ended. The block
+records the status of every member it ends; the members it did not end
+failed with the process.
+
+@param ensemble Ensemble struct
+@param iFirst Index of the block's first member
+@param iNumMembers Members in the block
+@param iStatus Status from waitpid, or -1 if waitpid failed
+@return Number of members that failed
+*/
+int fiEnsembleBlockDone(ENSEMBLE *ensemble, int iFirst, int iNumMembers,
+                        int iStatus) {
+  int iMember, iCode = EXIT_INT, iNumFailed = 0;
+
+#ifndef VPLANET_ON_WINDOWS
+  if (iStatus != -1 && WIFEXITED(iStatus) && WEXITSTATUS(iStatus) != 0) {
+    iCode = WEXITSTATUS(iStatus);
+  }
+#endif
+  for (iMember = iFirst; iMember < iFirst + iNumMembers; iMember++) {
+    if (ensemble->iaStatus[iMember] == -1) {
+      ensemble->iaStatus[iMember] = iCode;
+    }
+    iNumFailed += fbReportEnsembleMember(ensemble, iMember);
+  }
+  return iNumFailed;
+}
+
+/*
+ * Lockstep blocks
+ */
+
+/* The derivatives with a lane kernel, and their kernels */
+#define NUMLANEKERNELS 2
+static fnUpdateVariable fnaLaneScalar[] = {&fdCPLDsemiDt, &fdCPLDrotrateDt};
+static fnUpdateLanes fnaLaneVector[]    = {&fvCPLDsemiDtLanes,
+                                           &fvCPLDrotrateDtLanes};
+
+/**
+Lane kernel of a derivative.
+
+@param fnUpdate Derivative
+@return The kernel, or NULL if the derivative has none
+*/
+fnUpdateLanes fnLaneKernel(fnUpdateVariable fnUpdate) {
+  int iKernel;
+
+  for (iKernel = 0; iKernel < NUMLANEKERNELS; iKernel++) {
+    if (fnUpdate == fnaLaneScalar[iKernel]) {
+      return fnaLaneVector[iKernel];
+    }
+  }
+  return NULL;
+}
+
+/**
+Make a member the run in progress, so that its allocations are recorded in
+its list and its errors end only the member.
+
+@param lockstep Lockstep struct
+@param iSlot Member in the block
+*/
+void EnterEnsembleMember(LOCKSTEP *lockstep, int iSlot) {
+  lockstep->iCurrent = iSlot;
+  SetRunControl(&lockstep->member[iSlot].control);
+}
+
+/**
+Return to the block's working directory.
+
+@param lockstep Lockstep struct
+*/
+void LeaveEnsembleMemberDir(LOCKSTEP *lockstep) {
+  if (fchdir(lockstep->iBaseFd) != 0) {
+    fprintf(stderr, "ERROR: Unable to return to the ensemble directory.\n");
+    exit(EXIT_WRITE);
+  }
+}
+
+/**
+Prepare a member's files to be written: enter its directory, where the output
+files are opened, and give the outputs the member's negative units.
+
+@param lockstep Lockstep struct
+@param iSlot Member in the block
+*/
+void EnterEnsembleMemberDir(LOCKSTEP *lockstep, int iSlot) {
+  MEMBER *member = &lockstep->member[iSlot];
+  int iOut, iBody, iNumBodies = member->control.Evolve.iNumBodies;
+
+  // The directory is relative to the block's
+  LeaveEnsembleMemberDir(lockstep);
+  if (chdir(member->cDir) != 0) {
+    fprintf(stderr, "ERROR: Unable to enter %s.\n", member->cDir);
+    VplanetExit(EXIT_WRITE);
+  }
+  if (member->iaDoNeg != NULL) {
+    for (iOut = 0; iOut < MODULEOUTEND; iOut++) {
+      for (iBody = 0; iBody < iNumBodies; iBody++) {
+        lockstep->output[iOut].bDoNeg[iBody] =
+              member->iaDoNeg[iOut * iNumBodies + iBody];
+      }
+    }
+  }
+}
+
+/**
+End a member: record its status, mask its lane and free everything its run
+allocated.
+
+@param lockstep Lockstep struct
+@param iSlot Member in the block
+@param iStatus Exit status of the member
+*/
+void EndEnsembleMember(LOCKSTEP *lockstep, int iSlot, int iStatus) {
+  MEMBER *member = &lockstep->member[iSlot];
+  int iLane;
+
+  for (iLane = 0; iLane < lockstep->iNumLanes; iLane++) {
+    if (lockstep->iaLane[iLane] == iSlot) {
+      lockstep->iaLane[iLane] = -1;
+    }
+  }
+  lockstep->ensemble->iaStatus[member->iMember] = iStatus;
+
+  // An error may have come before the member's input was read
+  FreeInputTexts();
+  EndRun(&member->control);
+  LeaveEnsembleMemberDir(lockstep);
+  SetRunControl(lockstep->controlBase);
+}
+
+/**
+Close the files of a member that completed, as RunVplanet does, and end it.
+
+@param lockstep Lockstep struct
+@param iSlot Member in the block
+*/
+void FinishEnsembleMember(LOCKSTEP *lockstep, int iSlot) {
+  MEMBER *member = &lockstep->member[iSlot];
+
+  EnterEnsembleMember(lockstep, iSlot);
+  EnterEnsembleMemberDir(lockstep, iSlot);
+  FinishRun(&member->control, &member->files, lockstep->options,
+            lockstep->output, lockstep->fnWrite, member->body,
+            &member->module, &member->system, member->update,
+            member->fnUpdate);
+  EndEnsembleMember(lockstep, iSlot, 0);
+}
+
+/**
+Do two members have the same primary variables and equations, so that their
+states line up in the lanes?
+
+@param member First member
+@param memberOther Second member
+@return 1 if the layouts are the same, 0 otherwise
+*/
+int fbSameLayout(MEMBER *member, MEMBER *memberOther) {
+  int iBody, iVar, iEqn;
+  UPDATE *update = member->update, *updateOther = memberOther->update;
+
+  if (member->control.Evolve.iNumBodies !=
+      memberOther->control.Evolve.iNumBodies) {
+    return 0;
+  }
+  for (iBody = 0; iBody < member->control.Evolve.iNumBodies; iBody++) {
+    if (update[iBody].iNumVars != updateOther[iBody].iNumVars) {
+      return 0;
+    }
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      if (update[iBody].iNumEqns[iVar] != updateOther[iBody].iNumEqns[iVar]) {
+        return 0;
+      }
+      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+        if (update[iBody].iaType[iVar][iEqn] !=
+            updateOther[iBody].iaType[iVar][iEqn]) {
+          return 0;
+        }
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+Can a member be integrated in the lanes? It must take plain 4th order
+Runge-Kutta steps, with no dense output, checkpoints or writer thread, which
+the lanes do not keep for each member, and no GalHabit, whose random numbers
+are shared by the process. Its layout must match the lanes'.
+
+@param lockstep Lockstep struct
+@param member Member, read and verified
+@return 1 if the member can join the lanes, 0 otherwise
+*/
+int fbLockstepMember(LOCKSTEP *lockstep, MEMBER *member) {
+  int iBody;
+
+  if (member->fnOneStep != &RungeKutta4Step ||
+      member->control.Io.bDenseOutput ||
+      member->control.Io.dCheckpointTime > 0 ||
+      member->control.Io.bAsyncOutput ||
+      lockstep->iNumLanes == ENSEMBLELANES) {
+    return 0;
+  }
+  for (iBody = 0; iBody < member->control.Evolve.iNumBodies; iBody++) {
+    if (member->body[iBody].bGalHabit) {
+      return 0;
+    }
+  }
+  // Members are only set up before the first step, so no lane has ended
+  if (lockstep->iNumLanes > 0 &&
+      !fbSameLayout(&lockstep->member[lockstep->iaLane[0]], member)) {
+    return 0;
+  }
+  return 1;
+}
+
+/**
+Add a member to the lanes. The first lane sets the layout.
+
+@param lockstep Lockstep struct
+@param iSlot Member in the block
+*/
+void AddLockstepLane(LOCKSTEP *lockstep, int iSlot) {
+  EVOLVE *evolve = &lockstep->member[iSlot].control.Evolve;
+  int iState, iStage, iSize;
+
+  if (lockstep->iNumLanes == 0) {
+    // The lanes outlive their first member
+    SetRunControl(lockstep->controlBase);
+    lockstep->iNumState  = evolve->iNumState;
+    iSize                = evolve->iNumState * ENSEMBLELANES;
+    lockstep->baExplicit = malloc(evolve->iNumState * sizeof(int));
+    lockstep->daStart    = malloc(iSize * sizeof(double));
+    lockstep->daStage    = malloc(iSize * sizeof(double));
+    lockstep->daDeriv    = malloc(iSize * sizeof(double));
+    for (iStage = 0; iStage < 4; iStage++) {
+      lockstep->daaDeriv[iStage] = malloc(iSize * sizeof(double));
+    }
+    for (iState = 0; iState < evolve->iNumState; iState++) {
+      lockstep->baExplicit[iState] = evolve->baStateExplicit[iState];
+    }
+    SetRunControl(&lockstep->member[iSlot].control);
+  }
+  lockstep->iaLane[lockstep->iNumLanes] = iSlot;
+  lockstep->iNumLanes++;
+}
+
+/**
+Read a member of the block, in its own directory, and start its integration.
+A member that joins the lanes has written its initial output; any other is
+integrated and ended here.
+
+@param lockstep Lockstep struct
+@param iSlot Member in the block
+*/
+void SetUpEnsembleMember(LOCKSTEP *lockstep, int iSlot) {
+  MEMBER *member = &lockstep->member[iSlot];
+  CONTROL *control = &member->control;
+  int iOut, iBody, iNumBodies;
+
+  // The members start from the command line, as a forked member does
+  *control                 = *lockstep->controlBase;
+  control->pjmpErrorReturn = &lockstep->jmpError;
+  control->iErrorCode      = 0;
+  control->bRunAllocs      = 0;
+  control->allocs          = NULL;
+  member->files            = *lockstep->filesBase;
+  member->files.Outfile    = NULL;
+  member->iaDoNeg          = NULL;
+  member->bEnding          = 0;
+  member->nSteps           = 0;
+
+  EnterEnsembleMember(lockstep, iSlot);
+  BeginRunAllocs(control);
+  ResetOptions(lockstep->options);
+  EnsembleMemberDir(lockstep->ensemble, member->iMember, member->cDir);
+  AddEnsembleMember(lockstep->ensemble, member->iMember);
+  MakeEnsembleMemberDir(member->cDir);
+  EnterEnsembleMemberDir(lockstep, iSlot);
+
+  InitializeRun(control, &member->files, lockstep->options, lockstep->output,
+                lockstep->fnRead, lockstep->fnWrite, lockstep->cInfile,
+                &member->body, &member->module, &member->system,
+                &member->update, &member->fnUpdate, &member->fnOneStep);
+  // The next member reads its own input
+  FreeInputTexts();
+  FreeInputTables();
+
+  iNumBodies      = control->Evolve.iNumBodies;
+  member->iaDoNeg = malloc(MODULEOUTEND * iNumBodies * sizeof(int));
+  for (iOut = 0; iOut < MODULEOUTEND; iOut++) {
+    for (iBody = 0; iBody < iNumBodies; iBody++) {
+      member->iaDoNeg[iOut * iNumBodies + iBody] =
+            lockstep->output[iOut].bDoNeg[iBody];
+    }
+  }
+
+  if (!control->Evolve.bDoForward && !control->Evolve.bDoBackward) {
+    FinishEnsembleMember(lockstep, iSlot);
+    return;
+  }
+  if (!fbLockstepMember(lockstep, member)) {
+    Evolve(member->body, control, &member->files, &member->module,
+           lockstep->output, &member->system, member->update,
+           member->fnUpdate, lockstep->fnWrite, member->fnOneStep);
+    FinishEnsembleMember(lockstep, iSlot);
+    return;
+  }
+
+  member->iDir = fiBeginEvolve(member->body, control, &member->files,
+                               lockstep->output, &member->system,
+                               member->update, member->fnUpdate,
+                               lockstep->fnWrite, &member->dDt);
+  if (control->Evolve.dTime >= control->Evolve.dStopTime) {
+    if (control->Io.iVerbose >= VERBPROG) {
+      printf("Evolution completed.\n");
+    }
+    FinishEnsembleMember(lockstep, iSlot);
+    return;
+  }
+  AddLockstepLane(lockstep, iSlot);
+  LeaveEnsembleMemberDir(lockstep);
+  SetRunControl(lockstep->controlBase);
+}
+
+/**
+Evaluate a lane's derivatives that have no lane kernel into its tmpUpdate,
+as EvaluateDerivatives does. The kernels only read the bodies, as the
+couplings of EvaluateDerivativesParallel, so they can follow.
+
+@param member Member of the lane
+@param body Bodies at which to evaluate
+@param bTimeStep Skip the equations fdGetTimeStep skips?
+*/
+void EvaluateLaneDerivatives(MEMBER *member, BODY *body, int bTimeStep) {
+  int iBody, iVar, iEqn;
+  CONTROL *control = &member->control;
+  UPDATE *update   = control->Evolve.tmpUpdate;
+
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+        if ((bTimeStep &&
+             fbTimeStepSkipsDerivative(control, update, iBody, iVar, iEqn)) ||
+            fnLaneKernel(member->fnUpdate[iBody][iVar][iEqn]) != NULL) {
+          continue;
+        }
+        update[iBody].daDerivProc[iVar][iEqn] =
+              member->fnUpdate[iBody][iVar][iEqn](
+                    body, &member->system, update[iBody].iaBody[iVar][iEqn]);
+      }
+    }
+  }
+}
+
+/**
+Evaluate the derivatives that have a lane kernel, each for all the lanes that
+use it at once.
+
+@param lockstep Lockstep struct, with pbody set for every lane
+*/
+void EvaluateLaneKernels(LOCKSTEP *lockstep) {
+  int iBody, iVar, iEqn, iKernel, iLane, iNum, iRef = -1;
+  int iaGroup[ENSEMBLELANES], *paiBody[ENSEMBLELANES];
+  BODY *pbody[ENSEMBLELANES];
+  double daDeriv[ENSEMBLELANES];
+  MEMBER *member;
+  UPDATE *update;
+
+  for (iLane = 0; iLane < lockstep->iNumLanes && iRef < 0; iLane++) {
+    iRef = lockstep->iaLane[iLane];
+  }
+  if (iRef < 0) {
+    return;
+  }
+  // The lanes share one layout, so the reference's equations are theirs
+  update = lockstep->member[iRef].update;
+
+  for (iBody = 0; iBody < lockstep->member[iRef].control.Evolve.iNumBodies;
+       iBody++) {
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+        /* Tidal locking swaps a lane's derivative, so the lanes of one
+           equation can need different kernels, or none */
+        for (iKernel = 0; iKernel < NUMLANEKERNELS; iKernel++) {
+          iNum = 0;
+          for (iLane = 0; iLane < lockstep->iNumLanes; iLane++) {
+            if (lockstep->iaLane[iLane] < 0) {
+              continue;
+            }
+            member = &lockstep->member[lockstep->iaLane[iLane]];
+            if (member->fnUpdate[iBody][iVar][iEqn] !=
+                      fnaLaneScalar[iKernel] ||
+                (lockstep->iStage == 0 &&
+                 fbTimeStepSkipsDerivative(&member->control,
+                                           member->control.Evolve.tmpUpdate,
+                                           iBody, iVar, iEqn))) {
+              continue;
+            }
+            iaGroup[iNum] = lockstep->iaLane[iLane];
+            pbody[iNum]   = lockstep->pbody[iLane];
+            paiBody[iNum] =
+                  member->control.Evolve.tmpUpdate[iBody].iaBody[iVar][iEqn];
+            iNum++;
+          }
+          if (iNum == 0) {
+            continue;
+          }
+          fnaLaneVector[iKernel](pbody, paiBody, iNum, daDeriv);
+          for (iLane = 0; iLane < iNum; iLane++) {
+            member = &lockstep->member[iaGroup[iLane]];
+            member->control.Evolve.tmpUpdate[iBody].daDerivProc[iVar][iEqn] =
+                  daDeriv[iLane];
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+Move a lane to the state of the stage in progress, as RungeKutta4Stage does,
+and evaluate its derivatives that have no lane kernel. Stage 0 is the start
+of the step.
+
+@param lockstep Lockstep struct
+@param iLane Lane
+*/
+void BeginLaneStage(LOCKSTEP *lockstep, int iLane) {
+  MEMBER *member = &lockstep->member[lockstep->iaLane[iLane]];
+  EVOLVE *evolve = &member->control.Evolve;
+  int iState;
+
+  EnterEnsembleMember(lockstep, lockstep->iaLane[iLane]);
+  if (lockstep->iStage == 0) {
+    BodyCopy(evolve->tmpBody, member->body, evolve);
+    lockstep->pbody[iLane] = member->body;
+  } else {
+    for (iState = 0; iState < evolve->iNumState; iState++) {
+      *(evolve->pdStateTmpVar[iState]) =
+            lockstep->daStage[iState * ENSEMBLELANES + iLane];
+    }
+    PropertiesAuxiliary(evolve->tmpBody, &member->control, &member->system,
+                        member->update);
+    lockstep->pbody[iLane] = evolve->tmpBody;
+  }
+  EvaluateLaneDerivatives(member, lockstep->pbody[iLane],
+                          lockstep->iStage == 0);
+}
+
+/**
+Store a lane's derivatives of the stage in progress in the lanes. At the
+start of the step the lane also chooses its timestep, as RungeKutta4Step does,
+and stores its state.
+
+@param lockstep Lockstep struct
+@param iLane Lane
+*/
+void EndLaneStage(LOCKSTEP *lockstep, int iLane) {
+  MEMBER *member   = &lockstep->member[lockstep->iaLane[iLane]];
+  CONTROL *control = &member->control;
+  EVOLVE *evolve   = &control->Evolve;
+  int iState, iStage = lockstep->iStage;
+
+  EnterEnsembleMember(lockstep, lockstep->iaLane[iLane]);
+  if (iStage == 0) {
+    member->dDt = fdTimeStepOfDerivatives(member->body, control,
+                                          evolve->tmpUpdate);
+    if (evolve->bVarDt) {
+      member->dDt = AssignDt(member->dDt, fdTimeToStepLimit(control),
+                             evolve->dEta);
+    } else {
+      member->dDt = evolve->dTimeStep;
+    }
+    evolve->dCurrentDt    = member->dDt;
+    lockstep->daDt[iLane] = member->dDt;
+    for (iState = 0; iState < evolve->iNumState; iState++) {
+      lockstep->daStart[iState * ENSEMBLELANES + iLane] =
+            *(evolve->pdStateVar[iState]);
+    }
+  }
+
+  // Explicit variables are not averaged in the last stage
+  if (iStage == 3) {
+    StoreStageDerivatives(control, iStage, member->iDir, 0);
+  } else {
+    StoreStageDerivatives(control, iStage, member->iDir, member->iDir);
+  }
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    lockstep->daaDeriv[iStage][iState * ENSEMBLELANES + iLane] =
+          evolve->daStateDeriv[iStage][iState];
+  }
+}
+
+/**
+State of every lane at the next stage: half a step along the derivatives of
+stages 0 and 1, a full step along those of stage 2.
+
+@param lockstep Lockstep struct
+*/
+void AdvanceLaneStage(LOCKSTEP *lockstep) {
+  int iState, iLane, iNumLanes = lockstep->iNumLanes;
+  double dFrac, *daStart, *daStage, *daDeriv, *daDt = lockstep->daDt;
+
+  if (lockstep->iStage == 2) {
+    dFrac = 1;
+  } else {
+    dFrac = 0.5;
+  }
+  for (iState = 0; iState < lockstep->iNumState; iState++) {
+    daStart = lockstep->daStart + iState * ENSEMBLELANES;
+    daStage = lockstep->daStage + iState * ENSEMBLELANES;
+    daDeriv = lockstep->daaDeriv[lockstep->iStage] + iState * ENSEMBLELANES;
+    if (lockstep->baExplicit[iState]) {
+      memcpy(daStage, daDeriv, iNumLanes * sizeof(double));
+      continue;
+    }
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (iLane = 0; iLane < iNumLanes; iLane++) {
+      daStage[iLane] = daStart[iLane] + (dFrac * daDt[iLane]) * daDeriv[iLane];
+    }
+  }
+}
+
+/**
+Take the step of every lane: average the stage derivatives, as
+RungeKutta4Step does, and update the state.
+
+@param lockstep Lockstep struct
+*/
+void CombineLaneStages(LOCKSTEP *lockstep) {
+  int iState, iLane, iBody, iVar, iEqn, iProc, iNumLanes = lockstep->iNumLanes;
+  double *daStart, *daStage, *daDeriv, *daD0, *daD1, *daD2, *daD3;
+  double *daDt = lockstep->daDt, **daProc;
+  MEMBER *member;
+  EVOLVE *evolve;
+
+  for (iState = 0; iState < lockstep->iNumState; iState++) {
+    daStart = lockstep->daStart + iState * ENSEMBLELANES;
+    daStage = lockstep->daStage + iState * ENSEMBLELANES;
+    daDeriv = lockstep->daDeriv + iState * ENSEMBLELANES;
+    daD0    = lockstep->daaDeriv[0] + iState * ENSEMBLELANES;
+    daD1    = lockstep->daaDeriv[1] + iState * ENSEMBLELANES;
+    daD2    = lockstep->daaDeriv[2] + iState * ENSEMBLELANES;
+    daD3    = lockstep->daaDeriv[3] + iState * ENSEMBLELANES;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (iLane = 0; iLane < iNumLanes; iLane++) {
+      daDeriv[iLane] = 1. / 6 *
+                       (daD0[iLane] + 2 * daD1[iLane] + 2 * daD2[iLane] +
+                        daD3[iLane]);
+    }
+    if (lockstep->baExplicit[iState]) {
+      // The VALUE of the variable, as in RungeKutta4Step
+      memcpy(daStage, daD0, iNumLanes * sizeof(double));
+      continue;
+    }
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (iLane = 0; iLane < iNumLanes; iLane++) {
+      daStage[iLane] = daStart[iLane] + daDeriv[iLane] * daDt[iLane];
+    }
+  }
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    if (lockstep->iaLane[iLane] < 0) {
+      continue;
+    }
+    member = &lockstep->member[lockstep->iaLane[iLane]];
+    evolve = &member->control.Evolve;
+    daProc = evolve->daStateProc;
+    for (iState = 0; iState < evolve->iNumState; iState++) {
+      iBody = evolve->iaStateBody[iState];
+      iVar  = evolve->iaStateVar[iState];
+      member->update[iBody].daDeriv[iVar] =
+            lockstep->daDeriv[iState * ENSEMBLELANES + iLane];
+      iProc = evolve->iaStateProcOffset[iState];
+      for (iEqn = 0; iEqn < member->update[iBody].iNumEqns[iVar];
+           iEqn++, iProc++) {
+        member->update[iBody].daDerivProc[iVar][iEqn] =
+              1. / 6 *
+              (daProc[0][iProc] + 2 * daProc[1][iProc] +
+               2 * daProc[2][iProc] + daProc[3][iProc]);
+      }
+      *(evolve->pdStateVar[iState]) =
+            lockstep->daStage[iState * ENSEMBLELANES + iLane];
+    }
+  }
+}
+
+/**
+Take one 4th order Runge-Kutta step of every lane, as RungeKutta4Step takes
+one of a system. An error in a lane ends its member and returns to
+RunEnsembleBlock, which calls again to finish the step of the other lanes
+from where it stopped.
+
+@param lockstep Lockstep struct
+*/
+void RungeKutta4Lockstep(LOCKSTEP *lockstep) {
+  while (lockstep->iStage < 4) {
+    if (lockstep->iPhase == 0) {
+      for (; lockstep->iLane < lockstep->iNumLanes; lockstep->iLane++) {
+        if (lockstep->iaLane[lockstep->iLane] >= 0) {
+          BeginLaneStage(lockstep, lockstep->iLane);
+        }
+      }
+      SetRunControl(lockstep->controlBase);
+      EvaluateLaneKernels(lockstep);
+      lockstep->iPhase = 1;
+      lockstep->iLane  = 0;
+    }
+    for (; lockstep->iLane < lockstep->iNumLanes; lockstep->iLane++) {
+      if (lockstep->iaLane[lockstep->iLane] >= 0) {
+        EndLaneStage(lockstep, lockstep->iLane);
+      }
+    }
+    SetRunControl(lockstep->controlBase);
+    if (lockstep->iStage < 3) {
+      AdvanceLaneStage(lockstep);
+    } else {
+      CombineLaneStages(lockstep);
+    }
+    lockstep->iPhase = 0;
+    lockstep->iLane  = 0;
+    lockstep->iStage++;
+  }
+}
+
+/**
+The rest of Evolve's loop for a lane that took its step: halt, write the
+outputs that are due, and end the member once it reaches the stop time.
+
+@param lockstep Lockstep struct
+@param iLane Lane
+*/
+void EndLaneStep(LOCKSTEP *lockstep, int iLane) {
+  int iSlot        = lockstep->iaLane[iLane];
+  MEMBER *member   = &lockstep->member[iSlot];
+  CONTROL *control = &member->control;
+
+  EnterEnsembleMember(lockstep, iSlot);
+  if (fbEndStepHalts(member->body, control, &member->module, &member->system,
+                     member->update, member->fnUpdate, member->dDt)) {
+    EnterEnsembleMemberDir(lockstep, iSlot);
+    WriteHaltOutput(member->body, control, &member->files, lockstep->output,
+                    &member->system, member->update, member->fnUpdate,
+                    lockstep->fnWrite);
+    FinishEnsembleMember(lockstep, iSlot);
+    return;
+  }
+
+  if (fbAdvanceTime(member->body, control, member->dDt, member->iDir,
+                    &member->nSteps)) {
+    EnterEnsembleMemberDir(lockstep, iSlot);
+    WriteEvolveOutput(member->body, control, &member->files, lockstep->output,
+                      &member->system, member->update, member->fnUpdate,
+                      lockstep->fnWrite, &member->dDt, member->iDir,
+                      &member->nSteps);
+    LeaveEnsembleMemberDir(lockstep);
+  }
+
+  PrepareNextStep(member->body, control, &member->system, member->update);
+
+  if (control->Evolve.dTime >= control->Evolve.dStopTime) {
+    if (control->Io.iVerbose >= VERBPROG) {
+      printf("Evolution completed.\n");
+    }
+    FinishEnsembleMember(lockstep, iSlot);
+  }
+}
+
+/**
+Take one step of every lane, and drop the lanes whose members ended. Can be
+called again after an error, as RungeKutta4Lockstep.
+
+@param lockstep Lockstep struct
+*/
+void StepLockstep(LOCKSTEP *lockstep) {
+  int iLane, iNumLanes;
+
+  RungeKutta4Lockstep(lockstep);
+  for (; lockstep->iLane < lockstep->iNumLanes; lockstep->iLane++) {
+    if (lockstep->iaLane[lockstep->iLane] >= 0) {
+      EndLaneStep(lockstep, lockstep->iLane);
+    }
+  }
+  SetRunControl(lockstep->controlBase);
+
+  // The next step gathers every lane's state again, so lanes can move
+  iNumLanes = 0;
+  for (iLane = 0; iLane < lockstep->iNumLanes; iLane++) {
+    if (lockstep->iaLane[iLane] >= 0) {
+      lockstep->iaLane[iNumLanes] = lockstep->iaLane[iLane];
+      iNumLanes++;
+    }
+  }
+  lockstep->iNumLanes = iNumLanes;
+  lockstep->iStage    = 0;
+  lockstep->iPhase    = 0;
+  lockstep->iLane     = 0;
+}
+
+/**
+Integrate a block of members in one process, in lockstep where they can be.
+The status of every member is recorded in ensemble->iaStatus, which the
+parent shares.
+
+@param ensemble Ensemble struct
+@param control Control struct, with the command line flags set
+@param files Files struct
+@param options Options struct, already initialized
+@param output Output struct, already initialized
+@param fnRead Array of functions that read the options
+@param fnWrite Array of functions that write the outputs
+@param cInfile Primary input file of the template
+@param iFirst Index of the block's first member
+@param iNumMembers Members in the block
+@return 0
+*/
+int RunEnsembleBlock(ENSEMBLE *ensemble, CONTROL *control, FILES *files,
+                     OPTIONS *options, OUTPUT *output, fnReadOption fnRead[],
+                     fnWriteOutput fnWrite[], char cInfile[], int iFirst,
+                     int iNumMembers) {
+#ifdef VPLANET_ON_WINDOWS
+  return EXIT_EXE;
+#else
+  LOCKSTEP *lockstep;
+  MEMBER *member;
+  int iSlot, iStage;
+
+  // On the heap, so that it is intact when an error returns to the setjmp
+  lockstep              = calloc(1, sizeof(LOCKSTEP));
+  lockstep->ensemble    = ensemble;
+  lockstep->controlBase = control;
+  lockstep->filesBase   = files;
+  lockstep->options     = options;
+  lockstep->output      = output;
+  lockstep->fnRead      = fnRead;
+  lockstep->fnWrite     = fnWrite;
+  lockstep->cInfile     = cInfile;
+  lockstep->iNumMembers = iNumMembers;
+  lockstep->member      = calloc(iNumMembers, sizeof(MEMBER));
+  for (iSlot = 0; iSlot < iNumMembers; iSlot++) {
+    lockstep->member[iSlot].iMember = iFirst + iSlot;
+  }
+  lockstep->iBaseFd = open(".", O_RDONLY);
+  if (lockstep->iBaseFd < 0) {
+    fprintf(stderr, "ERROR: Unable to open the ensemble directory.\n");
+    VplanetExit(EXIT_WRITE);
+  }
+
+  if (setjmp(lockstep->jmpError) != 0) {
+    member = &lockstep->member[lockstep->iCurrent];
+    // An error while closing must not close again
+    if (!member->bEnding) {
+      member->bEnding = 1;
+      CloseOutputFiles(&member->control, &member->files);
+    }
+    EndEnsembleMember(lockstep, lockstep->iCurrent,
+                      member->control.iErrorCode);
+  }
+
+  while (lockstep->iNumSetUp < lockstep->iNumMembers) {
+    iSlot = lockstep->iNumSetUp;
+    lockstep->iNumSetUp++;
+    SetUpEnsembleMember(lockstep, iSlot);
+  }
+
+  while (lockstep->iNumLanes > 0) {
+    StepLockstep(lockstep);
+  }
+
+  close(lockstep->iBaseFd);
+  if (lockstep->baExplicit != NULL) {
+    free(lockstep->baExplicit);
+    free(lockstep->daStart);
+    free(lockstep->daStage);
+    free(lockstep->daDeriv);
+    for (iStage = 0; iStage < 4; iStage++) {
+      free(lockstep->daaDeriv[iStage]);
+    }
+  }
+  free(lockstep->member);
+  free(lockstep);
+  return 0;
+#endif
+}
+
+/**
+Integrate every member of an ensemble. Member i reads its input from memory
+and writes its output in <table stem>_ensemble/<i>, with at most iNumJobs
+processes running at once: one per member, or with bLockstep one per block of
+members.
+
+@param control Control struct, with the command line flags set
+@param files Files struct
+@param options Options struct, already initialized
+@param output Output struct, already initialized
+@param fnRead Array of functions that read the options
+@param fnWrite Array of functions that write the outputs
+@param cInfile Primary input file of the template
+@param cTable Name of the parameter table
+@param iNumJobs Number of jobs from the -j flag, 0 if not set
+@param bLockstep Integrate blocks of members in lockstep?
+@return 0, or EXIT_INT if any member failed
+*/
+int RunEnsemble(CONTROL *control, FILES *files, OPTIONS *options,
+                OUTPUT *output, fnReadOption fnRead[], fnWriteOutput fnWrite[],
+                char cInfile[], char cTable[], int iNumJobs, int bLockstep) {
+#ifdef VPLANET_ON_WINDOWS
+  fprintf(stderr, "ERROR: Ensembles are not supported on Windows.\n");
+  VplanetExit(EXIT_EXE);
+  return EXIT_EXE;
+#else
+  ENSEMBLE ensemble;
+  char cMemberDir[2 * NAMELEN + 1];
+  int iMember, iRunning = 0, iJob, iNumFailed = 0, iStatus, bReaped, iBlock;
+  pid_t *iaPid, pid;
+  int *iaMember, *iaBlock;
+
+  ReadEnsembleTemplate(&ensemble, cInfile, control->Io.iVerbose);
+  ReadEnsembleTable(&ensemble, cTable, control->Io.iVerbose);
+  ensemble.iNumJobs = fiNumEnsembleJobs(iNumJobs);
+  if (ensemble.iNumJobs > ensemble.iNumMembers) {
+    ensemble.iNumJobs = ensemble.iNumMembers;
+  }
+
+  /* Blocks spread the members evenly over the jobs, but are no larger than
+     the lanes */
+  ensemble.bLockstep  = bLockstep;
+  ensemble.iBlockSize = 1;
+  if (bLockstep) {
+    ensemble.iBlockSize =
+          (ensemble.iNumMembers + ensemble.iNumJobs - 1) / ensemble.iNumJobs;
+    if (ensemble.iBlockSize > ENSEMBLELANES) {
+      ensemble.iBlockSize = ENSEMBLELANES;
+    }
+  }
+
+  if (mkdir(ensemble.cDir, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "ERROR: Unable to create ensemble directory %s: %s.\n",
+            ensemble.cDir, strerror(errno));
+    VplanetExit(EXIT_WRITE);
+  }
+  ensemble.iWidth =
+        (int)log10(ensemble.iNumMembers > 1 ? ensemble.iNumMembers - 1 : 1) +
+        1;
+
+  /* The running jobs, in the first iRunning entries */
+  iaPid    = malloc(ensemble.iNumJobs * sizeof(pid_t));
+  iaMember = malloc(ensemble.iNumJobs * sizeof(int));
+  iaBlock  = malloc(ensemble.iNumJobs * sizeof(int));
+  if (bLockstep) {
+    // Shared, so the blocks can record the status of each of their members
+    ensemble.iaStatus = mmap(NULL, ensemble.iNumMembers * sizeof(int),
+                             PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS,
+                             -1, 0);
+    if (ensemble.iaStatus == MAP_FAILED) {
+      fprintf(stderr, "ERROR: Unable to share the ensemble statuses.\n");
+      VplanetExit(EXIT_EXE);
+    }
+    for (iMember = 0; iMember < ensemble.iNumMembers; iMember++) {
+      ensemble.iaStatus[iMember] = -1;
+    }
+  } else {
+    ensemble.iaStatus = malloc(ensemble.iNumMembers * sizeof(int));
+  }
+
+  if (control->Io.iVerbose >= VERBPROG) {
+    printf("Running %d members of %s on %d jobs in %s.\n",
+           ensemble.iNumMembers, cInfile, ensemble.iNumJobs, ensemble.cDir);
+  }
+
+  for (iMember = 0; iMember <= ensemble.iNumMembers;
+       iMember += ensemble.iBlockSize) {
+    if (iMember > ensemble.iNumMembers) {
+      iMember = ensemble.iNumMembers;
+    }
+    /* Reap finished jobs until a job is free, or all when done */
+    while (iRunning > 0 && (iRunning >= ensemble.iNumJobs ||
+                            iMember == ensemble.iNumMembers)) {
+      /* Only our jobs are reaped, so children of the caller, e.g. of the
+         Python wrapper, are left alone. */
+      bReaped = 0;
+      for (iJob = 0; iJob < iRunning;) {
+        pid = waitpid(iaPid[iJob], &iStatus, WNOHANG);
+        if (pid == 0 || (pid < 0 && errno == EINTR)) {
+          iJob++;
+          continue;
+        }
+        if (bLockstep) {
+          iNumFailed += fiEnsembleBlockDone(&ensemble, iaMember[iJob],
+                                            iaBlock[iJob],
+                                            pid < 0 ? -1 : iStatus);
+        } else {
+          iNumFailed += fbEnsembleMemberDone(&ensemble, iaMember[iJob],
+                                             pid < 0 ? -1 : iStatus);
+        }
+        // The last running job takes the freed job
+        iRunning--;
+        iaPid[iJob]    = iaPid[iRunning];
+        iaMember[iJob] = iaMember[iRunning];
+        iaBlock[iJob]  = iaBlock[iRunning];
+        bReaped        = 1;
+      }
+      if (!bReaped) {
+        usleep(ENSEMBLEPOLL);
+      }
+    }
+    if (iMember == ensemble.iNumMembers) {
+      break;
+    }
+
+    iBlock = ensemble.iBlockSize;
+    if (iMember + iBlock > ensemble.iNumMembers) {
+      iBlock = ensemble.iNumMembers - iMember;
+    }
+    EnsembleMemberDir(&ensemble, iMember, cMemberDir);
+    /* Children inherit unflushed buffers, so empty them first */
+    fflush(NULL);
+    pid = fork();
+    if (pid < 0) {
+      fprintf(stderr, "ERROR: Unable to start ensemble member %d.\n", iMember);
+      VplanetExit(EXIT_EXE);
+    }
+    if (pid == 0) {
+      // A member must end its own process, not return to the caller's run
+      control->pjmpErrorReturn = NULL;
+      if (bLockstep) {
+        exit(RunEnsembleBlock(&ensemble, control, files, options, output,
+                              fnRead, fnWrite, cInfile, iMember, iBlock));
+      }
+      AddEnsembleMember(&ensemble, iMember);
+      MakeEnsembleMemberDir(cMemberDir);
+      if (chdir(cMemberDir) != 0) {
+        fprintf(stderr, "ERROR: Unable to enter %s.\n", cMemberDir);
+        exit(EXIT_WRITE);
+      }
+      exit(RunVplanet(control, files, options, output, fnRead, fnWrite,
+                      cInfile));
+    }
+    iaPid[iRunning]    = pid;
+    iaMember[iRunning] = iMember;
+    iaBlock[iRunning]  = iBlock;
+    iRunning++;
+  }
+
+  if (control->Io.iVerbose >= VERBPROG) {
+    printf("Ensemble completed: %d of %d members succeeded.\n",
+           ensemble.iNumMembers - iNumFailed, ensemble.iNumMembers);
+  }
+
+  free(iaPid);
+  free(iaMember);
+  free(iaBlock);
+  FreeEnsemble(&ensemble);
+  if (iNumFailed > 0) {
+    return EXIT_INT;
+  }
+  return 0;
+#endif
+}
+
+void FreeEnsemble(ENSEMBLE *ensemble) {
+  int iMember, iCol;
+
+  for (iMember = 0; iMember < ensemble->iNumMembers; iMember++) {
+    for (iCol = 0; iCol < ensemble->iNumCols; iCol++) {
+      free(ensemble->saaValue[iMember][iCol]);
+    }
+    free(ensemble->saaValue[iMember]);
+  }
+  free(ensemble->saaValue);
+  for (iCol = 0; iCol < ensemble->iNumCols; iCol++) {
+    free(ensemble->saColOption[iCol]);
+  }
+  if (ensemble->iNumCols > 0) {
+    free(ensemble->iaColFile);
+    free(ensemble->saColOption);
+  }
+#ifndef VPLANET_ON_WINDOWS
+  if (ensemble->bLockstep) {
+    munmap(ensemble->iaStatus, ensemble->iNumMembers * sizeof(int));
+    return;
+  }
+#endif
+  free(ensemble->iaStatus);
+}
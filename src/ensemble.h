@@ -0,0 +1,56 @@
+/**
+  @file ensemble.h
+  @brief Run many members of one template system in a single process.
+  @author Rory Barnes ([RoryBarnes](https://github.com/RoryBarnes/))
+  @date Oct 16 2026
+*/
+
+/* Suffix of the directory that holds the member directories */
+#define ENSEMBLEDIR "_ensemble"
+/* Microseconds to wait between checks for a finished member */
+#define ENSEMBLEPOLL 1000
+
+int RunVplanet(CONTROL *, FILES *, OPTIONS *, OUTPUT *, fnReadOption[],
+               fnWriteOutput[], char[]);
+void InitializeRun(CONTROL *, FILES *, OPTIONS *, OUTPUT *, fnReadOption[],
+                   fnWriteOutput[], char[], BODY **, MODULE *, SYSTEM *,
+                   UPDATE **, fnUpdateVariable ****, fnIntegrate *);
+void FinishRun(CONTROL *, FILES *, OPTIONS *, OUTPUT *, fnWriteOutput[],
+               BODY *, MODULE *, SYSTEM *, UPDATE *, fnUpdateVariable ***);
+void EndRun(CONTROL *);
+
+int fiNumEnsembleJobs(int);
+void ReadEnsembleTable(ENSEMBLE *, char[], int);
+void ReadEnsembleTemplate(ENSEMBLE *, char[], int);
+int fbEnsembleLineContinues(char[]);
+void AddEnsembleMember(ENSEMBLE *, int);
+void EnsembleMemberDir(ENSEMBLE *, int, char[]);
+void MakeEnsembleMemberDir(char[]);
+int fbReportEnsembleMember(ENSEMBLE *, int);
+int fbEnsembleMemberDone(ENSEMBLE *, int, int);
+int fiEnsembleBlockDone(ENSEMBLE *, int, int, int);
+
+fnUpdateLanes fnLaneKernel(fnUpdateVariable);
+void EnterEnsembleMember(LOCKSTEP *, int);
+void LeaveEnsembleMemberDir(LOCKSTEP *);
+void EnterEnsembleMemberDir(LOCKSTEP *, int);
+void EndEnsembleMember(LOCKSTEP *, int, int);
+void FinishEnsembleMember(LOCKSTEP *, int);
+int fbSameLayout(MEMBER *, MEMBER *);
+int fbLockstepMember(LOCKSTEP *, MEMBER *);
+void AddLockstepLane(LOCKSTEP *, int);
+void SetUpEnsembleMember(LOCKSTEP *, int);
+void EvaluateLaneDerivatives(MEMBER *, BODY *, int);
+void EvaluateLaneKernels(LOCKSTEP *);
+void BeginLaneStage(LOCKSTEP *, int);
+void EndLaneStage(LOCKSTEP *, int);
+void AdvanceLaneStage(LOCKSTEP *);
+void CombineLaneStages(LOCKSTEP *);
+void RungeKutta4Lockstep(LOCKSTEP *);
+void EndLaneStep(LOCKSTEP *, int);
+void StepLockstep(LOCKSTEP *);
+int RunEnsembleBlock(ENSEMBLE *, CONTROL *, FILES *, OPTIONS *, OUTPUT *,
+                     fnReadOption[], fnWriteOutput[], char[], int, int);
+int RunEnsemble(CONTROL *, FILES *, OPTIONS *, OUTPUT *, fnReadOption[],
+                fnWriteOutput[], char[], char[], int, int);
+void FreeEnsemble(ENSEMBLE *);
@@ -36,8 +36,6 @@ void BodyCopyEqtide(BODY *dest, BODY *src, int iTideModel, int iNumBodies,
 
   dest[iBody].dTidalPowMan = src[iBody].dTidalPowMan;
 
-  dest[iBody].iTidePerts = src[iBody].iTidePerts;
-
   dest[iBody].dImK2      = src[iBody].dImK2;
   dest[iBody].dImK2Man   = src[iBody].dImK2Man;
   dest[iBody].dImK2Ocean = src[iBody].dImK2Ocean;
@@ -50,10 +48,8 @@ void BodyCopyEqtide(BODY *dest, BODY *src, int iTideModel, int iNumBodies,
 
   dest[iBody].dObliquity      = src[iBody].dObliquity;
   dest[iBody].dPrecA          = src[iBody].dPrecA;
-  dest[iBody].bUseTidalRadius = src[iBody].bUseTidalRadius;
   dest[iBody].dTidalRadius    = src[iBody].dTidalRadius;
   dest[iBody].bTideLock       = src[iBody].bTideLock;
-  dest[iBody].bEqtide         = src[iBody].bEqtide;
 
   if (iBody > 0) {
     dest[iBody].dEccSq        = src[iBody].dEccSq;
@@ -74,10 +70,6 @@ void BodyCopyEqtide(BODY *dest, BODY *src, int iTideModel, int iNumBodies,
     dest[iBody].dTidalBeta = src[iBody].dTidalBeta;
   }
 
-  for (iPert = 0; iPert < src[iBody].iTidePerts; iPert++) {
-    dest[iBody].iaTidePerts[iPert] = src[iBody].iaTidePerts[iPert];
-  }
-
   for (iPert = 0; iPert < iNumBodies; iPert++) {
     dest[iBody].daDoblDtEqtide[iPert] = src[iBody].daDoblDtEqtide[iPert];
     if (iTideModel == CPL) {
@@ -112,8 +104,15 @@ void InitializeUpdateTmpBodyEqtide(BODY *body, CONTROL *control, UPDATE *update,
   control->Evolve.tmpBody[iBody].dTidalZ =
         malloc(control->Evolve.iNumBodies * sizeof(double));
 
+  /* The tidal perturbers are fixed, so copy them here, not in BodyCopy */
+  control->Evolve.tmpBody[iBody].bUseTidalRadius = body[iBody].bUseTidalRadius;
+  control->Evolve.tmpBody[iBody].iTidePerts      = body[iBody].iTidePerts;
   control->Evolve.tmpBody[iBody].iaTidePerts =
         malloc(body[iBody].iTidePerts * sizeof(int));
+  for (iPert = 0; iPert < body[iBody].iTidePerts; iPert++) {
+    control->Evolve.tmpBody[iBody].iaTidePerts[iPert] =
+          body[iBody].iaTidePerts[iPert];
+  }
   control->Evolve.tmpBody[iBody].daDoblDtEqtide =
         malloc(control->Evolve.iNumBodies * sizeof(double));
 
@@ -1285,7 +1284,7 @@ void VerifyCTL(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
                 "%s.\n",
                 options[OPT_TIDALQ].cName, files->Infile[iBody + 1].cIn);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
   }
 
@@ -1505,7 +1504,7 @@ void VerifyCPL(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
                 "%s.\n",
                 options[OPT_TIDALTAU].cName, files->Infile[iBody + 1].cIn);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
 
     /* Verify output contains no CTL-specific parameters */
@@ -1669,7 +1668,7 @@ void VerifyPerturbersEqtide(BODY *body, FILES *files, OPTIONS *options,
       }
 
       if (!ok) {
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
     }
   }
@@ -1704,7 +1703,7 @@ void VerifyPerturbersEqtide(BODY *body, FILES *files, OPTIONS *options,
           fprintf(stderr, "\tFile: %s, Line: %d\n",
                   files->Infile[body[iBody].iaTidePerts[iPert] + 1].cIn,
                   options[OPT_TIDEPERTS].iLine[iPert + 1]);
-          exit(EXIT_INPUT);
+          VplanetExit(EXIT_INPUT);
         }
       }
     }
@@ -1746,7 +1745,7 @@ int fiGetModuleIntEqtide(MODULE *module, int iBody) {
   }
 
   fprintf(stderr, "ERROR: Eqtide not found for body #%d.\n", iBody);
-  exit(1);
+  VplanetExit(1);
 }
 
 void VerifyTideModel(CONTROL *control, FILES *files, OPTIONS *options) {
@@ -1770,7 +1769,7 @@ void VerifyTideModel(CONTROL *control, FILES *files, OPTIONS *options) {
         }
       }
     }
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   if (iFound == 0) {
@@ -1806,7 +1805,7 @@ void AssignEqtideDerivatives(BODY *body, EVOLVE *evolve, UPDATE *update,
           &fndUpdateFunctionTiny;
   } else {
     fprintf(stderr, "ERROR: Must choose CPL, CTL of DB15 tidal model!\n");
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   for (iPert = 0; iPert < body[iBody].iTidePerts; iPert++) {
@@ -2225,7 +2224,7 @@ void VerifyHaltEqtide(BODY *body, CONTROL *control, OPTIONS *options, int iBody,
                      options[OPT_HALTDBLSYNC].cFile[iBody + 1],
                      options[OPT_BODYFILES].iLine[0],
                      options[OPT_HALTDBLSYNC].iLine[iBody + 1]);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     } else {
       control->fnHalt[iBody][(*iHalt)++] = &HaltDblSync;
     }
@@ -2240,7 +2239,7 @@ void VerifyHaltEqtide(BODY *body, CONTROL *control, OPTIONS *options, int iBody,
                      options[OPT_HALTTIDELOCK].cFile[iBody + 1],
                      options[OPT_BODYFILES].iLine[0],
                      options[OPT_HALTTIDELOCK].iLine[iBody + 1]);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     } else {
       control->fnHalt[iBody][(*iHalt)++] = &HaltTideLock;
     }
@@ -2255,7 +2254,7 @@ void VerifyHaltEqtide(BODY *body, CONTROL *control, OPTIONS *options, int iBody,
                      options[OPT_HALTSYNCROT].cFile[iBody + 1],
                      options[OPT_BODYFILES].iLine[0],
                      options[OPT_HALTSYNCROT].iLine[iBody + 1]);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     } else {
       control->fnHalt[iBody][(*iHalt)++] = &HaltSyncRot;
     }
@@ -3448,6 +3447,23 @@ void LogBodyEqtide(BODY *body, CONTROL *control, OUTPUT *output, SYSTEM *system,
   fprintf(fp, "\n");
 }
 
+/************ EQTIDE Checkpoint Functions **************/
+
+/**
+Write or read whether a body's rotation has been locked by ForceBehavior.
+
+@param control Control struct
+@param iBody Index of body
+@param fp Checkpoint file
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointEqtide(CONTROL *control, int iBody, FILE *fp, int bWrite) {
+  CheckpointData(fp, &control->Evolve.bForceEqSpin[iBody], sizeof(int), 1,
+                 bWrite);
+  CheckpointData(fp, &control->Evolve.bFixOrbit[iBody], sizeof(int), 1,
+                 bWrite);
+}
+
 /************* MODULE Functions ***********/
 
 void AddModuleEqtide(CONTROL *control, MODULE *module, int iBody, int iModule) {
@@ -3847,6 +3863,8 @@ void ForceBehaviorEqtide(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
                          SYSTEM *system, UPDATE *update,
                          fnUpdateVariable ***fnUpdate, int iBody, int iModule) {
   int iOrbiter;
+  double dRotRate;
+
   if (body[iBody].iTidePerts == 1) {
     /* Don't check for tidal locking if more than 1 tidal perturber. Maybe
        change this later so the dominant perturber can lock it? */
@@ -3869,9 +3887,13 @@ void ForceBehaviorEqtide(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
 
     /* If tidally locked, assign equilibrium rotational frequency? */
     if (evolve->bForceEqSpin[iBody]) {
+      dRotRate             = body[iBody].dRotRate;
       body[iBody].dRotRate = fdEqRotRate(
             body, iBody, body[iOrbiter].dMeanMotion, body[iOrbiter].dEccSq,
             evolve->iEqtideModel, evolve->bDiscreteRot);
+      if (body[iBody].dRotRate != dRotRate) {
+        evolve->bFSAL = 0;
+      }
     }
     /* Tidally Locked? */
     else {
@@ -3884,6 +3906,7 @@ void ForceBehaviorEqtide(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
       if (evolve->bForceEqSpin[iBody]) {
         SetDerivTiny(fnUpdate, iBody, update[iBody].iRot,
                      update[iBody].iaRotEqtide[0]);
+        evolve->bFSAL = 0;
       }
     }
   }
@@ -3892,9 +3915,11 @@ void ForceBehaviorEqtide(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
   /* Generalize! fnPropsAuxMinMax? */
   // XXX Move this to ForceBehavior General?
   if (evolve->dMinValue > 0) {
-    if (body[iBody].dEcc < evolve->dMinValue) {
+    if (body[iBody].dEcc < evolve->dMinValue &&
+        (body[iBody].dHecc != 0 || body[iBody].dKecc != 0)) {
       body[iBody].dHecc = 0;
       body[iBody].dKecc = 0;
+      evolve->bFSAL     = 0;
     }
     /* XXX Need to sort out what Xobl, Yobl and Zobl should be
     if (body[iBody].dObliquity < control->Evolve.dMinValue)
@@ -4295,6 +4320,145 @@ double fdCPLDrotrateDt(BODY *body, SYSTEM *system, int *iaBody) {
                  body[iB0].iTidalEpsilon[iB1][9]));
 }
 
+/* Lockstep versions of the derivatives above, for the ensembles of
+   ensemble.c. Each gathers its inputs from the bodies of iNumLanes systems
+   into arrays, so that the arithmetic is one vector loop. The expressions
+   are those of the scalar functions, term for term, so the results are
+   identical. */
+
+void fvCPLDsemiDtLanes(BODY **pbody, int **paiBody, int iNumLanes,
+                       double *daDeriv) {
+  int iB0, iB1, iLane;
+  int iaLock0[ENSEMBLELANES], iaLock1[ENSEMBLELANES];
+  double daSemi[ENSEMBLELANES], daMass0[ENSEMBLELANES],
+        daMass1[ENSEMBLELANES], daEccSq[ENSEMBLELANES], daZ0[ENSEMBLELANES],
+        daZ1[ENSEMBLELANES], daSin0[ENSEMBLELANES], daSin1[ENSEMBLELANES];
+  // Phase lag signs 0, 1, 2, 5 and 8 of each body
+  double daaEps0[5][ENSEMBLELANES], daaEps1[5][ENSEMBLELANES];
+  double dSum, dA, dB, dC, dD, dE, dF;
+  BODY *body;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    body             = pbody[iLane];
+    iB0              = paiBody[iLane][0];
+    iB1              = paiBody[iLane][1];
+    iaLock0[iLane]   = body[iB0].bTideLock;
+    iaLock1[iLane]   = body[iB1].bTideLock;
+    daSemi[iLane]    = body[iB0].dSemi;
+    daMass0[iLane]   = body[iB0].dMass;
+    daMass1[iLane]   = body[iB1].dMass;
+    daEccSq[iLane]   = body[iB0].dEccSq;
+    daZ0[iLane]      = body[iB0].dTidalZ[iB1];
+    daZ1[iLane]      = body[iB1].dTidalZ[iB0];
+    daSin0[iLane]    = sin(body[iB0].dObliquity);
+    daSin1[iLane]    = sin(body[iB1].dObliquity);
+    daaEps0[0][iLane] = body[iB0].iTidalEpsilon[iB1][0];
+    daaEps0[1][iLane] = body[iB0].iTidalEpsilon[iB1][1];
+    daaEps0[2][iLane] = body[iB0].iTidalEpsilon[iB1][2];
+    daaEps0[3][iLane] = body[iB0].iTidalEpsilon[iB1][5];
+    daaEps0[4][iLane] = body[iB0].iTidalEpsilon[iB1][8];
+    daaEps1[0][iLane] = body[iB1].iTidalEpsilon[iB0][0];
+    daaEps1[1][iLane] = body[iB1].iTidalEpsilon[iB0][1];
+    daaEps1[2][iLane] = body[iB1].iTidalEpsilon[iB0][2];
+    daaEps1[3][iLane] = body[iB1].iTidalEpsilon[iB0][5];
+    daaEps1[4][iLane] = body[iB1].iTidalEpsilon[iB0][8];
+  }
+
+#ifdef _OPENMP
+#pragma omp simd private(dSum, dA, dB, dC, dD, dE, dF)
+#endif
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    // Unlocked terms of the orbiter and central body
+    dA = 4 * daaEps0[0][iLane] +
+         daEccSq[iLane] *
+               (-20 * daaEps0[0][iLane] + 147. / 2 * daaEps0[1][iLane] +
+                0.5 * daaEps0[2][iLane] - 3 * daaEps0[3][iLane]) -
+         4 * daSin0[iLane] * daSin0[iLane] *
+               (daaEps0[0][iLane] - daaEps0[4][iLane]);
+    dB = 4 * daaEps1[0][iLane] +
+         daEccSq[iLane] *
+               (-20 * daaEps1[0][iLane] + 147. / 2 * daaEps1[1][iLane] +
+                0.5 * daaEps1[2][iLane] - 3 * daaEps1[3][iLane]) -
+         4 * daSin1[iLane] * daSin1[iLane] *
+               (daaEps1[0][iLane] - daaEps1[4][iLane]);
+    // Locked terms
+    dC = 7.0 * daEccSq[iLane] + daSin0[iLane] * daSin0[iLane];
+    dD = 7.0 * daEccSq[iLane] + daSin1[iLane] * daSin1[iLane];
+    // Prefactors
+    dE = daSemi[iLane] * daSemi[iLane] /
+         (4 * BIGG * daMass0[iLane] * daMass1[iLane]);
+    dF = -daSemi[iLane] * daSemi[iLane] /
+         (BIGG * daMass0[iLane] * daMass1[iLane]);
+
+    if (!iaLock0[iLane] && iaLock1[iLane]) {
+      dSum = 0.0;
+      dSum += dE * daZ0[iLane] * dA;
+      dSum += dF * daZ1[iLane] * dD * daaEps1[2][iLane];
+    } else if (iaLock0[iLane] && !iaLock1[iLane]) {
+      dSum = 0.0;
+      dSum += dF * daZ0[iLane] * dC * daaEps0[2][iLane];
+      dSum += dE * daZ1[iLane] * dB;
+    } else if (iaLock0[iLane] && iaLock1[iLane]) {
+      dSum = 0.0;
+      dSum += daZ0[iLane] * dC * daaEps0[2][iLane];
+      dSum += daZ1[iLane] * dD * daaEps1[2][iLane];
+      dSum = dF * dSum;
+    } else {
+      dSum = 0.0;
+      dSum += daZ0[iLane] * dA;
+      dSum += daZ1[iLane] * dB;
+      dSum = dE * dSum;
+    }
+    daDeriv[iLane] = dSum;
+  }
+}
+
+void fvCPLDrotrateDtLanes(BODY **pbody, int **paiBody, int iNumLanes,
+                          double *daDeriv) {
+  int iB0, iB1, iLane, iOrbiter;
+  double daZ[ENSEMBLELANES], daDenom[ENSEMBLELANES], daEccSq[ENSEMBLELANES],
+        daSin[ENSEMBLELANES];
+  // Phase lag signs 0, 1, 2, 8 and 9
+  double daaEps[5][ENSEMBLELANES];
+  BODY *body;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    body = pbody[iLane];
+    iB0  = paiBody[iLane][0];
+    iB1  = paiBody[iLane][1];
+    if (bPrimary(body, iB0)) {
+      iOrbiter = iB1;
+    } else {
+      iOrbiter = iB0;
+    }
+    daZ[iLane]       = body[iB0].dTidalZ[iB1];
+    daDenom[iLane]   = 8 * body[iB0].dMass * body[iB0].dRadGyra *
+                     body[iB0].dRadGyra * body[iB0].dTidalRadius *
+                     body[iB0].dTidalRadius * body[iOrbiter].dMeanMotion;
+    daEccSq[iLane]   = body[iOrbiter].dEccSq;
+    daSin[iLane]     = sin(body[iB0].dObliquity);
+    daaEps[0][iLane] = body[iB0].iTidalEpsilon[iB1][0];
+    daaEps[1][iLane] = body[iB0].iTidalEpsilon[iB1][1];
+    daaEps[2][iLane] = body[iB0].iTidalEpsilon[iB1][2];
+    daaEps[3][iLane] = body[iB0].iTidalEpsilon[iB1][8];
+    daaEps[4][iLane] = body[iB0].iTidalEpsilon[iB1][9];
+  }
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daDeriv[iLane] =
+          -daZ[iLane] / daDenom[iLane] *
+          (4 * daaEps[0][iLane] +
+           daEccSq[iLane] * (-20 * daaEps[0][iLane] + 49 * daaEps[1][iLane] +
+                             daaEps[2][iLane]) +
+           2 * daSin[iLane] * daSin[iLane] *
+                 (-2 * daaEps[0][iLane] + daaEps[3][iLane] +
+                  daaEps[4][iLane]));
+  }
+}
+
 double fdCPLDoblDt(BODY *body, int *iaBody) {
   int iOrbiter, iB0 = iaBody[0], iB1 = iaBody[1];
   double foo;
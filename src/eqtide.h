@@ -113,6 +113,7 @@
 void InitializeControlEqtide(CONTROL *, int);
 void AddModuleEqtide(CONTROL *, MODULE *, int, int);
 void BodyCopyEqtide(BODY *, BODY *, int, int, int);
+void CheckpointEqtide(CONTROL *, int, FILE *, int);
 void InitializeBodyEqtide(BODY *, CONTROL *, UPDATE *, int, int);
 void InitializeUpdateTmpBodyEqtide(BODY *, CONTROL *, UPDATE *, int);
 int fiGetModuleIntEqtide(MODULE *, int);
@@ -309,6 +310,8 @@ double fdCPLDsemiDtBody(BODY, double, double, double);
 double fdCPLDeccDt(BODY *, int *);
 double fdDEdTCPLEqtide(BODY *, SYSTEM *, int *);
 double fdCPLDeccDtLocked(BODY *, UPDATE *, int *);
+void fvCPLDsemiDtLanes(BODY **, int **, int, double *);
+void fvCPLDrotrateDtLanes(BODY **, int **, int, double *);
 
 /******************** CTL Functions ********************/
 
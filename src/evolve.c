@@ -9,8 +9,6 @@
   @date May 2014
 
 */
-#define NUM_THREADS 4
-
 #include "vplanet.h"
 
 void PropsAuxGeneral(BODY *body, CONTROL *control) {
@@ -119,6 +117,188 @@ double AssignDt(double dMin, double dNextOutput, double dEta) {
   return dMin;
 }
 
+double fdTimeToStepLimit(CONTROL *control) {
+  /* Time until the end of the step may not be passed: the next output, or
+     with dense output only the stop time */
+  if (control->Io.bDenseOutput) {
+    return control->Evolve.dStopTime - control->Evolve.dTime;
+  }
+  return control->Io.dNextOutput - control->Evolve.dTime;
+}
+
+/*
+ * Derivative evaluation
+ */
+
+int fbTimeStepSkipsDerivative(CONTROL *control, UPDATE *update, int iBody,
+                              int iVar, int iEqn) {
+  /* fdGetTimeStep does not evaluate variables that are explicit functions
+     of time (type 10), nor SpiNBody's equations while DistOrb is in use. */
+  int iType = update[iBody].iaType[iVar][0];
+
+  if (iType == 0 || iType == 3 || iType == 5) {
+    return 0;
+  }
+  if (iType == 10) {
+    return 1;
+  }
+  return update[iBody].iaType[iVar][iEqn] == 7 &&
+         control->Evolve.bSpiNBodyDistOrb != 0 &&
+         control->Evolve.bUsingSpiNBody != 1;
+}
+
+void EvaluateDerivativesParallel(BODY *body, CONTROL *control, SYSTEM *system,
+                                 UPDATE *update, fnUpdateVariable ***fnUpdate,
+                                 int bTimeStep) {
+  /* Evaluate the equations on control->Evolve.iNumThreads threads. Each body's
+     own-body equations run in one task, as some write members of their body.
+     The couplings only read the other bodies, so they can run one per task
+     once every own-body equation has finished. */
+  int iBody, iVar, iEqn, iTask;
+  EVOLVE *evolve = &control->Evolve;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(evolve->iNumThreads) private(iBody, iVar,     \
+                                                              iEqn, iTask)
+#endif
+  {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+      for (iTask = evolve->iaOwnEqnOffset[iBody];
+           iTask < evolve->iaOwnEqnOffset[iBody + 1]; iTask++) {
+        iVar = evolve->iaEqnVar[iTask];
+        iEqn = evolve->iaEqnNum[iTask];
+        if (bTimeStep &&
+            fbTimeStepSkipsDerivative(control, update, iBody, iVar, iEqn)) {
+          continue;
+        }
+        update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
+              body, system, update[iBody].iaBody[iVar][iEqn]);
+      }
+    }
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for (iTask = evolve->iNumOwnEqns; iTask < evolve->iNumEqnTasks; iTask++) {
+      iBody = evolve->iaEqnBody[iTask];
+      iVar  = evolve->iaEqnVar[iTask];
+      iEqn  = evolve->iaEqnNum[iTask];
+      if (bTimeStep &&
+          fbTimeStepSkipsDerivative(control, update, iBody, iVar, iEqn)) {
+        continue;
+      }
+      update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
+            body, system, update[iBody].iaBody[iVar][iEqn]);
+    }
+  }
+}
+
+void EvaluateDerivatives(BODY *body, CONTROL *control, SYSTEM *system,
+                         UPDATE *update, fnUpdateVariable ***fnUpdate,
+                         int bTimeStep) {
+  /* Fill update[].daDerivProc with the derivative of every process. If
+     bTimeStep is set, the equations fdGetTimeStep ignores are skipped. */
+  int iBody, iVar, iEqn;
+
+  if (control->Evolve.iNumThreads > 1) {
+    EvaluateDerivativesParallel(body, control, system, update, fnUpdate,
+                                bTimeStep);
+    return;
+  }
+
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+        if (bTimeStep &&
+            fbTimeStepSkipsDerivative(control, update, iBody, iVar, iEqn)) {
+          continue;
+        }
+        update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
+              body, system, update[iBody].iaBody[iVar][iEqn]);
+      }
+    }
+  }
+}
+
+int fbOwnBodyEquation(UPDATE *update, int iBody, int iVar, int iEqn) {
+  /* Does the equation only depend on iBody? */
+  int iPert;
+
+  for (iPert = 0; iPert < update[iBody].iNumBodies[iVar][iEqn]; iPert++) {
+    if (update[iBody].iaBody[iVar][iEqn][iPert] != iBody) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+void InitializeDerivativeTasks(CONTROL *control, UPDATE *update) {
+  /* Sort the equations into own-body and coupling tasks for
+     EvaluateDerivativesParallel, and settle the number of threads. */
+  int iBody, iVar, iEqn, iTask, bOwn;
+  char *cEnv;
+  EVOLVE *evolve = &control->Evolve;
+
+  if (evolve->iNumThreads == 0) {
+    cEnv = getenv("VPLANET_NUM_THREADS");
+    if (cEnv != NULL && atoi(cEnv) > 0) {
+      evolve->iNumThreads = atoi(cEnv);
+    } else {
+      evolve->iNumThreads = 1;
+    }
+  }
+#ifndef _OPENMP
+  if (evolve->iNumThreads > 1) {
+    if (control->Io.iVerbose >= VERBINPUT) {
+      fprintf(stderr,
+              "WARNING: VPLanet was compiled without OpenMP, so the "
+              "derivatives are evaluated on 1 thread, not %d.\n",
+              evolve->iNumThreads);
+    }
+    evolve->iNumThreads = 1;
+  }
+#endif
+
+  evolve->iNumEqnTasks = 0;
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      evolve->iNumEqnTasks += update[iBody].iNumEqns[iVar];
+    }
+  }
+
+  evolve->iaOwnEqnOffset = malloc((evolve->iNumBodies + 1) * sizeof(int));
+  evolve->iaEqnBody      = malloc(evolve->iNumEqnTasks * sizeof(int));
+  evolve->iaEqnVar       = malloc(evolve->iNumEqnTasks * sizeof(int));
+  evolve->iaEqnNum       = malloc(evolve->iNumEqnTasks * sizeof(int));
+
+  // Own-body equations first, then the couplings
+  iTask = 0;
+  for (bOwn = 1; bOwn >= 0; bOwn--) {
+    for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+      if (bOwn) {
+        evolve->iaOwnEqnOffset[iBody] = iTask;
+      }
+      for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+        for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+          if (fbOwnBodyEquation(update, iBody, iVar, iEqn) == bOwn) {
+            evolve->iaEqnBody[iTask] = iBody;
+            evolve->iaEqnVar[iTask]  = iVar;
+            evolve->iaEqnNum[iTask]  = iEqn;
+            iTask++;
+          }
+        }
+      }
+    }
+    if (bOwn) {
+      evolve->iaOwnEqnOffset[evolve->iNumBodies] = iTask;
+      evolve->iNumOwnEqns                        = iTask;
+    }
+  }
+}
+
 double fdGetTimeStep(BODY *body, CONTROL *control, SYSTEM *system,
                      UPDATE *update, fnUpdateVariable ***fnUpdate) {
   /* Fills the Update arrays with the derivatives
@@ -127,6 +307,14 @@ double fdGetTimeStep(BODY *body, CONTROL *control, SYSTEM *system,
    * an Euler step.
    */
 
+  EvaluateDerivatives(body, control, system, update, fnUpdate, 1);
+  return fdTimeStepOfDerivatives(body, control, update);
+}
+
+double fdTimeStepOfDerivatives(BODY *body, CONTROL *control, UPDATE *update) {
+  /* The smallest timescale of the derivatives already in update, which
+     EvaluateDerivatives filled with bTimeStep set. */
+
   int iBody, iVar, iEqn; // Dummy counting variables
   EVOLVE
   integr; // Dummy EVOLVE struct so we don't have to dereference control a lot
@@ -149,10 +337,6 @@ double fdGetTimeStep(BODY *body, CONTROL *control, SYSTEM *system,
         */
         if (update[iBody].iaType[iVar][0] == 0) {
           dVarNow = *update[iBody].pdVar[iVar];
-          for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-            update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
-                  body, system, update[iBody].iaBody[iVar][iEqn]);
-          }
           if (control->Evolve.bFirstStep) {
             dMin                       = integr.dTimeStep;
             control->Evolve.bFirstStep = 0;
@@ -180,10 +364,6 @@ double fdGetTimeStep(BODY *body, CONTROL *control, SYSTEM *system,
          */
         } else if (update[iBody].iaType[iVar][0] == 5) {
           // continue;
-          for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-            update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
-                  body, system, update[iBody].iaBody[iVar][iEqn]);
-          }
           /* Integration for binary, where parameters can be computed via
          derivatives, or as an explicit function of age */
         } else if (update[iBody].iaType[iVar][0] == 10) {
@@ -199,10 +379,6 @@ double fdGetTimeStep(BODY *body, CONTROL *control, SYSTEM *system,
             (e.g. h,k,p,q in DistOrb) */
         } else if (update[iBody].iaType[iVar][0] == 3) {
           dVarNow = *update[iBody].pdVar[iVar];
-          for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-            update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
-                  body, system, update[iBody].iaBody[iVar][iEqn]);
-          }
           if (control->Evolve.bFirstStep) {
             dMin                       = integr.dTimeStep;
             control->Evolve.bFirstStep = 0;
@@ -225,9 +401,6 @@ double fdGetTimeStep(BODY *body, CONTROL *control, SYSTEM *system,
         } else {
           for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
             if (update[iBody].iaType[iVar][iEqn] == 2) {
-              update[iBody].daDerivProc[iVar][iEqn] =
-                    fnUpdate[iBody][iVar][iEqn](
-                          body, system, update[iBody].iaBody[iVar][iEqn]);
               // if (update[iBody].daDerivProc[iVar][iEqn] != 0 &&
               // *(update[iBody].pdVar[iVar]) != 0) {
               if (update[iBody].daDerivProc[iVar][iEqn] != 0) {
@@ -262,9 +435,6 @@ double fdGetTimeStep(BODY *body, CONTROL *control, SYSTEM *system,
               // enforce a minimum step size for ice sheets, otherwise dDt -> 0
               // real fast
             } else if (update[iBody].iaType[iVar][iEqn] == 9) {
-              update[iBody].daDerivProc[iVar][iEqn] =
-                    fnUpdate[iBody][iVar][iEqn](
-                          body, system, update[iBody].iaBody[iVar][iEqn]);
               if (update[iBody].daDerivProc[iVar][iEqn] != 0 &&
                   *(update[iBody].pdVar[iVar]) != 0) {
                 dMinNow = fabs((*(update[iBody].pdVar[iVar])) /
@@ -288,9 +458,6 @@ double fdGetTimeStep(BODY *body, CONTROL *control, SYSTEM *system,
             } else if (update[iBody].iaType[iVar][iEqn] == 7) {
               if ((control->Evolve.bSpiNBodyDistOrb == 0) ||
                   (control->Evolve.bUsingSpiNBody == 1)) {
-                update[iBody].daDerivProc[iVar][iEqn] =
-                      fnUpdate[iBody][iVar][iEqn](
-                            body, system, update[iBody].iaBody[iVar][iEqn]);
                 dMinNow =
                       sqrt((body[iBody].dPositionX * body[iBody].dPositionX +
                             body[iBody].dPositionY * body[iBody].dPositionY +
@@ -304,9 +471,6 @@ double fdGetTimeStep(BODY *body, CONTROL *control, SYSTEM *system,
               }
             } else {
               // The parameter is controlled by a time derivative
-              update[iBody].daDerivProc[iVar][iEqn] =
-                    fnUpdate[iBody][iVar][iEqn](
-                          body, system, update[iBody].iaBody[iVar][iEqn]);
               if (!bFloatComparison(update[iBody].daDerivProc[iVar][iEqn],
                                     0.0) &&
                   !bFloatComparison(*(update[iBody].pdVar[iVar]), 0.0)) {
@@ -333,28 +497,32 @@ void fdGetUpdateInfo(BODY *body, CONTROL *control, SYSTEM *system,
    * or new values..
    */
 
-  int iBody, iVar, iEqn, iNumBodies, iNumVars,
-        iNumEqns; // Dummy counting variables
-  EVOLVE
-  integr; // Dummy EVOLVE struct so we don't have to dereference control a lot
-  double dVarNow, dMinNow, dMin = dHUGE,
-                           dVarTotal; // Intermediate storage variables
+  EvaluateDerivatives(body, control, system, update, fnUpdate, 0);
+}
 
-  integr = control->Evolve;
+void GetCurrentDerivatives(BODY *body, CONTROL *control, SYSTEM *system,
+                           UPDATE *update, fnUpdateVariable ***fnUpdate) {
+  /* Make sure update[].daDerivProc holds the derivatives of the current
+     state, evaluating them only if BODY changed since they were computed. */
 
-  iNumBodies = control->Evolve.iNumBodies;
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    if (update[iBody].iNumVars > 0) {
-      iNumVars = update[iBody].iNumVars;
-      for (iVar = 0; iVar < iNumVars; iVar++) {
-        iNumEqns = update[iBody].iNumEqns[iVar];
-        for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
-          update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
-                body, system, update[iBody].iaBody[iVar][iEqn]);
-        }
-      }
+  if (control->Evolve.iDerivVersion != control->Evolve.iStateVersion) {
+    fdGetUpdateInfo(body, control, system, update, fnUpdate);
+    control->Evolve.iDerivVersion = control->Evolve.iStateVersion;
+  }
+}
+
+int fbAuxUsesDerivatives(BODY *body, CONTROL *control) {
+  /* RadHeat and ThermInt compute auxiliary properties (radiogenic powers,
+     latent heat flows, inner core growth) from the derivatives in UPDATE, so
+     those must be evaluated before every call to PropertiesAuxiliary. */
+  int iBody;
+
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    if (body[iBody].bRadheat || body[iBody].bThermint) {
+      return 1;
     }
   }
+  return 0;
 }
 
 
@@ -369,7 +537,7 @@ void EulerStep(BODY *body, CONTROL *control, SYSTEM *system, UPDATE *update,
   if (control->Evolve.bVarDt) {
     /* dDt is the dynamical timescale */
     *dDt = fdGetTimeStep(body, control, system, update, fnUpdate);
-    *dDt = AssignDt(*dDt, (control->Io.dNextOutput - control->Evolve.dTime),
+    *dDt = AssignDt(*dDt, fdTimeToStepLimit(control),
                     control->Evolve.dEta);
   }
 
@@ -388,15 +556,184 @@ void EulerStep(BODY *body, CONTROL *control, SYSTEM *system, UPDATE *update,
   }
 }
 
+/*
+ * Packed state vector
+ */
+
+void InitializeStateVector(CONTROL *control, UPDATE *update) {
+  /* Map every primary variable of every body onto one contiguous vector.
+     Must be called after the modules have assigned iaType. */
+  int iBody, iVar, iState, iStage;
+  EVOLVE *evolve = &control->Evolve;
+
+  evolve->iaStateOffset = malloc(evolve->iNumBodies * sizeof(int));
+  evolve->iNumState     = 0;
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    evolve->iaStateOffset[iBody] = evolve->iNumState;
+    evolve->iNumState += update[iBody].iNumVars;
+  }
+
+  evolve->iaStateBody     = malloc(evolve->iNumState * sizeof(int));
+  evolve->iaStateVar      = malloc(evolve->iNumState * sizeof(int));
+  evolve->iaStateType     = malloc(evolve->iNumState * sizeof(int));
+  evolve->baStateExplicit = malloc(evolve->iNumState * sizeof(int));
+  evolve->pdStateVar      = malloc(evolve->iNumState * sizeof(double *));
+  evolve->pdStateTmpVar   = malloc(evolve->iNumState * sizeof(double *));
+  evolve->daStateStart    = malloc(evolve->iNumState * sizeof(double));
+  evolve->daStateStage    = malloc(evolve->iNumState * sizeof(double));
+  evolve->daStateEnd      = malloc(evolve->iNumState * sizeof(double));
+  evolve->daStateDense    = malloc(evolve->iNumState * sizeof(double));
+  evolve->daAgeEnd        = malloc(evolve->iNumBodies * sizeof(double));
+
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      iState                          = evolve->iaStateOffset[iBody] + iVar;
+      evolve->iaStateBody[iState]     = iBody;
+      evolve->iaStateVar[iState]      = iVar;
+      evolve->iaStateType[iState]     = update[iBody].iaType[iVar][0];
+      evolve->baStateExplicit[iState] = fbExplicitVariable(update, iBody, iVar);
+      evolve->pdStateVar[iState]      = update[iBody].pdVar[iVar];
+      evolve->pdStateTmpVar[iState]   = evolve->tmpUpdate[iBody].pdVar[iVar];
+    }
+  }
+
+  // One block, so consecutive stages are also adjacent in memory
+  evolve->daStateDeriv = malloc(NUMSTAGES * sizeof(double *));
+  evolve->daStateDeriv[0] =
+        calloc(NUMSTAGES * evolve->iNumState, sizeof(double));
+  for (iStage = 1; iStage < NUMSTAGES; iStage++) {
+    evolve->daStateDeriv[iStage] =
+          evolve->daStateDeriv[0] + iStage * evolve->iNumState;
+  }
+
+  /* The per-process stage derivatives are packed the same way, one process
+     after another in state order, and daDerivProc[iStage][iBody][iVar] is
+     pointed into the block so both views share the storage. */
+  evolve->iaStateProcOffset = malloc((evolve->iNumState + 1) * sizeof(int));
+  evolve->iNumStateProc     = 0;
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    evolve->iaStateProcOffset[iState] = evolve->iNumStateProc;
+    evolve->iNumStateProc +=
+          update[evolve->iaStateBody[iState]].iNumEqns[evolve->iaStateVar[iState]];
+  }
+  evolve->iaStateProcOffset[evolve->iNumState] = evolve->iNumStateProc;
+
+  evolve->daStateProc    = malloc(NUMSTAGES * sizeof(double *));
+  evolve->daStateProc[0] =
+        calloc(NUMSTAGES * evolve->iNumStateProc + 1, sizeof(double));
+  for (iStage = 0; iStage < NUMSTAGES; iStage++) {
+    evolve->daStateProc[iStage] =
+          evolve->daStateProc[0] + iStage * evolve->iNumStateProc;
+    for (iState = 0; iState < evolve->iNumState; iState++) {
+      iBody = evolve->iaStateBody[iState];
+      iVar  = evolve->iaStateVar[iState];
+      free(evolve->daDerivProc[iStage][iBody][iVar]);
+      evolve->daDerivProc[iStage][iBody][iVar] =
+            evolve->daStateProc[iStage] + evolve->iaStateProcOffset[iState];
+    }
+  }
+}
+
+void GatherState(EVOLVE *evolve, double **pdVar, double *daState) {
+  /* Copy the primary variables pointed to by pdVar into daState */
+  int iState;
+
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    daState[iState] = *(pdVar[iState]);
+  }
+}
+
+void ScatterState(EVOLVE *evolve, double **pdVar, double *daState) {
+  /* Copy daState into the primary variables pointed to by pdVar */
+  int iState;
+
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    *(pdVar[iState]) = daState[iState];
+  }
+}
+
+void StoreStageDerivatives(CONTROL *control, int iStage, int iDir,
+                           int iExplicitDir) {
+  /* Sum the derivatives just computed in tmpUpdate into stage iStage of
+     the state vector and keep each process's contribution. Explicit
+     variables store their value multiplied by iExplicitDir; if it is 0
+     they are left untouched. */
+  int iState, iBody, iVar, iEqn, iNumEqns, iSign;
+  double dDerivVar, *daDerivProc, *daStageProc;
+  EVOLVE *evolve = &control->Evolve;
+  double *daStateProc = evolve->daStateProc[iStage];
+
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    if (evolve->baStateExplicit[iState]) {
+      iSign = iExplicitDir;
+      if (iSign == 0) {
+        continue;
+      }
+    } else {
+      iSign = iDir;
+    }
+    iBody       = evolve->iaStateBody[iState];
+    iVar        = evolve->iaStateVar[iState];
+    iNumEqns    = evolve->tmpUpdate[iBody].iNumEqns[iVar];
+    daDerivProc = evolve->tmpUpdate[iBody].daDerivProc[iVar];
+    daStageProc = daStateProc + evolve->iaStateProcOffset[iState];
+    dDerivVar   = 0;
+    for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
+      dDerivVar += iSign * daDerivProc[iEqn];
+      daStageProc[iEqn] = daDerivProc[iEqn];
+    }
+    evolve->daStateDeriv[iStage][iState] = dDerivVar;
+  }
+}
+
+void RungeKutta4Stage(BODY *body, CONTROL *control, SYSTEM *system,
+                      UPDATE *update, fnUpdateVariable ***fnUpdate,
+                      double dFrac, double dDt, int iStage, int iDir) {
+  /* Move tmpBody a fraction dFrac of the step along the derivatives of
+     stage iStage-1 and evaluate the derivatives of stage iStage there. */
+  int iState;
+  double dH        = dFrac * dDt;
+  EVOLVE *evolve   = &control->Evolve;
+  double *daStart  = evolve->daStateStart;
+  double *daStage  = evolve->daStateStage;
+  double *daDeriv  = evolve->daStateDeriv[iStage - 1];
+  int *baExplicit  = evolve->baStateExplicit;
+
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    if (baExplicit[iState]) {
+      // LUGER: Note that this is the VALUE of the variable getting passed,
+      // contrary to what the names suggest These values are updated in the
+      // tmpUpdate struct so that equations which are dependent upon them will
+      // be evaluated with higher accuracy
+      daStage[iState] = daDeriv[iState];
+    } else {
+      daStage[iState] = daStart[iState] + dH * daDeriv[iState];
+    }
+  }
+  ScatterState(evolve, evolve->pdStateTmpVar, daStage);
+
+  PropertiesAuxiliary(evolve->tmpBody, control, system, update);
+  fdGetUpdateInfo(evolve->tmpBody, control, system, evolve->tmpUpdate,
+                  fnUpdate);
+
+  // Explicit variables are not averaged in the last stage
+  if (iStage == 3) {
+    StoreStageDerivatives(control, iStage, iDir, 0);
+  } else {
+    StoreStageDerivatives(control, iStage, iDir, iDir);
+  }
+}
+
 void RungeKutta4Step(BODY *body, CONTROL *control, SYSTEM *system,
                      UPDATE *update, fnUpdateVariable ***fnUpdate, double *dDt,
                      int iDir) {
-  /* Compute and apply a 4th order Runge-Kutta update step a given parameter. */
-  int iBody, iVar, iEqn, iSubStep, iNumBodies, iNumVars, iNumEqns;
-  double dFoo, dDelta;
-
+  /* Compute and apply a 4th order Runge-Kutta update step a given parameter.
+     The stages operate on the packed state vector. */
+  int iState, iBody, iVar, iEqn, iProc;
   EVOLVE *evolve = &(
         control->Evolve); // Save Evolve as a variable for speed and legibility
+  double **daDeriv = evolve->daStateDeriv;
+  double **daProc  = evolve->daStateProc;
 
   /* Create a copy of BODY array */
   BodyCopy(evolve->tmpBody, body, &control->Evolve);
@@ -408,249 +745,1098 @@ void RungeKutta4Step(BODY *body, CONTROL *control, SYSTEM *system,
   /* Adjust dt? */
   if (evolve->bVarDt) {
     /*  This is minimum dynamical timescale */
-    *dDt = AssignDt(*dDt, (control->Io.dNextOutput - evolve->dTime),
+    *dDt = AssignDt(*dDt, fdTimeToStepLimit(control),
                     evolve->dEta);
   } else {
     *dDt = evolve->dTimeStep;
   }
-
   evolve->dCurrentDt = *dDt;
-  iNumBodies         = evolve->iNumBodies;
-#pragma omp parallel for num_threads(NUM_THREADS) private(iNumVars, iNumEqns,  \
-                                                          iVar, iEqn)
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    // int thread_num = omp_get_thread_num();
-    // int cpu_num = sched_getcpu();
-    // printf("Thread %3d is running on CPU %3d\n", thread_num, cpu_num);
-    double daDerivVar;
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      daDerivVar = 0;
-      iNumEqns   = update[iBody].iNumEqns[iVar];
-      for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
-        daDerivVar += iDir * evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-        evolve->daDerivProc[0][iBody][iVar][iEqn] = evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
+
+  GatherState(evolve, evolve->pdStateVar, evolve->daStateStart);
+  StoreStageDerivatives(control, 0, iDir, iDir);
+
+  /* First and second midpoint derivatives, then the full step derivative */
+  RungeKutta4Stage(body, control, system, update, fnUpdate, 0.5, *dDt, 1,
+                   iDir);
+  RungeKutta4Stage(body, control, system, update, fnUpdate, 0.5, *dDt, 2,
+                   iDir);
+  RungeKutta4Stage(body, control, system, update, fnUpdate, 1, *dDt, 3,
+                   iDir);
+
+  /* Now do the update -- Note the pointer to the home of the actual
+   * variables!!! */
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    iBody = evolve->iaStateBody[iState];
+    iVar  = evolve->iaStateVar[iState];
+    update[iBody].daDeriv[iVar] =
+          1. / 6 *
+          (daDeriv[0][iState] + 2 * daDeriv[1][iState] +
+           2 * daDeriv[2][iState] + daDeriv[3][iState]);
+    iProc = evolve->iaStateProcOffset[iState];
+    for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++, iProc++) {
+      update[iBody].daDerivProc[iVar][iEqn] =
+            1. / 6 *
+            (daProc[0][iProc] + 2 * daProc[1][iProc] + 2 * daProc[2][iProc] +
+             daProc[3][iProc]);
+    }
+
+    if (evolve->baStateExplicit[iState]) {
+      // LUGER: Note that this is the VALUE of the variable getting passed,
+      // contrary to what the names suggest
+      evolve->daStateStage[iState] = daDeriv[0][iState];
+    } else {
+      evolve->daStateStage[iState] =
+            evolve->daStateStart[iState] +
+            update[iBody].daDeriv[iVar] * (*dDt);
+    }
+  }
+  ScatterState(evolve, evolve->pdStateVar, evolve->daStateStage);
+}
+
+/*
+ * Adaptive Runge-Kutta (Dormand & Prince 1980)
+ */
+
+/* Butcher tableau for RK5(4)7M. The last row of daRK45A holds the 5th order
+   weights, so the 7th stage is evaluated at the new state and can be reused
+   as the first stage of the next step (First Same As Last, FSAL). */
+static const double daRK45C[NUMSTAGES] = {0, 1. / 5, 3. / 10, 4. / 5,
+                                          8. / 9, 1, 1};
+
+static const double daRK45A[NUMSTAGES][NUMSTAGES - 1] = {
+      {0, 0, 0, 0, 0, 0},
+      {1. / 5, 0, 0, 0, 0, 0},
+      {3. / 40, 9. / 40, 0, 0, 0, 0},
+      {44. / 45, -56. / 15, 32. / 9, 0, 0, 0},
+      {19372. / 6561, -25360. / 2187, 64448. / 6561, -212. / 729, 0, 0},
+      {9017. / 3168, -355. / 33, 46732. / 5247, 49. / 176, -5103. / 18656, 0},
+      {35. / 384, 0, 500. / 1113, 125. / 192, -2187. / 6784, 11. / 84}};
+
+/* Difference between the 5th and embedded 4th order weights */
+static const double daRK45E[NUMSTAGES] = {
+      71. / 57600,      0, -71. / 16695, 71. / 1920, -17253. / 339200,
+      22. / 525, -1. / 40};
+
+int fbExplicitVariable(UPDATE *update, int iBody, int iVar) {
+  /* Is this primary variable an explicit function of time, i.e. its
+     "derivative" is actually its value? */
+  if (update[iBody].iaType[iVar][0] == 0 ||
+      update[iBody].iaType[iVar][0] == 3 ||
+      update[iBody].iaType[iVar][0] == 10) {
+    return 1;
+  }
+  return 0;
+}
+
+void InitializeRungeKutta45(CONTROL *control, UPDATE *update,
+                            fnUpdateVariable ***fnUpdate) {
+  /* Allocate the end-of-step record used to decide whether the last stage
+     may be reused as the next first stage. */
+  int iBody, iVar;
+  EVOLVE *evolve = &control->Evolve;
+
+  evolve->dProposedDt  = 0;
+  evolve->iNumRejected = 0;
+  evolve->bFSAL        = 0;
+  evolve->daFSALState  = malloc(evolve->iNumState * sizeof(double));
+  evolve->fnFSALUpdate =
+        malloc(evolve->iNumBodies * sizeof(fnUpdateVariable **));
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    evolve->fnFSALUpdate[iBody] =
+          malloc(update[iBody].iNumVars * sizeof(fnUpdateVariable *));
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      evolve->fnFSALUpdate[iBody][iVar] =
+            malloc(update[iBody].iNumEqns[iVar] * sizeof(fnUpdateVariable));
+    }
+  }
+}
+
+void SaveFSALState(CONTROL *control, UPDATE *update,
+                   fnUpdateVariable ***fnUpdate) {
+  /* Record the state at which the last stage was evaluated */
+  int iBody, iVar, iEqn;
+  EVOLVE *evolve = &control->Evolve;
+
+  GatherState(evolve, evolve->pdStateVar, evolve->daFSALState);
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+        evolve->fnFSALUpdate[iBody][iVar][iEqn] = fnUpdate[iBody][iVar][iEqn];
       }
-      evolve->daDeriv[0][iBody][iVar] = daDerivVar;
     }
   }
+  evolve->bFSAL = 1;
+}
 
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      if (update[iBody].iaType[iVar][0] == 0 ||
-          update[iBody].iaType[iVar][0] == 3 ||
-          update[iBody].iaType[iVar][0] == 10) {
-        // LUGER: Note that this is the VALUE of the variable getting passed,
-        // contrary to what the names suggest These values are updated in the
-        // tmpUpdate struct so that equations which are dependent upon them will
-        // be evaluated with higher accuracy
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              evolve->daDeriv[0][iBody][iVar];
-      } else {
-        /* While we're in this loop, move each parameter to the midpoint of the
-         * timestep */
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              *(update[iBody].pdVar[iVar]) +
-              0.5 * (*dDt) * evolve->daDeriv[0][iBody][iVar];
+int fbFSALValid(CONTROL *control, UPDATE *update,
+                fnUpdateVariable ***fnUpdate) {
+  /* The last stage of the previous step is only valid if ForceBehavior did
+     not change a primary variable or swap a derivative function. A
+     ForceBehavior that changes any other input of the derivatives clears
+     bFSAL itself. */
+  int iState, iBody, iVar, iEqn;
+  EVOLVE *evolve = &control->Evolve;
+
+  if (!evolve->bFSAL) {
+    return 0;
+  }
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    if (evolve->daFSALState[iState] != *(evolve->pdStateVar[iState])) {
+      return 0;
+    }
+  }
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+        if (evolve->fnFSALUpdate[iBody][iVar][iEqn] !=
+            fnUpdate[iBody][iVar][iEqn]) {
+          return 0;
+        }
       }
     }
   }
+  return 1;
+}
 
-  /* First midpoint derivative.*/
-  PropertiesAuxiliary(evolve->tmpBody, control, system, update);
+void RungeKutta45Stage(BODY *body, CONTROL *control, SYSTEM *system,
+                       UPDATE *update, fnUpdateVariable ***fnUpdate,
+                       double dDt, int iStage, int iDir) {
+  /* Move tmpBody to the state of stage iStage and evaluate derivatives */
+  int iBody, iState, iPrev;
+  double dIncrement;
+  EVOLVE *evolve   = &control->Evolve;
+  double **daDeriv = evolve->daStateDeriv;
+  double *daStage  = evolve->daStateStage;
+
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    evolve->tmpBody[iBody].dAge =
+          body[iBody].dAge + iDir * daRK45C[iStage] * dDt;
+  }
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    if (evolve->baStateExplicit[iState]) {
+      // As in RK4, explicit variables carry their latest value
+      daStage[iState] = daDeriv[iStage - 1][iState];
+    } else {
+      dIncrement = 0;
+      for (iPrev = 0; iPrev < iStage; iPrev++) {
+        dIncrement += daRK45A[iStage][iPrev] * daDeriv[iPrev][iState];
+      }
+      daStage[iState] = evolve->daStateStart[iState] + dDt * dIncrement;
+    }
+  }
+  ScatterState(evolve, evolve->pdStateTmpVar, daStage);
 
+  PropertiesAuxiliary(evolve->tmpBody, control, system, update);
   fdGetUpdateInfo(evolve->tmpBody, control, system, evolve->tmpUpdate,
                   fnUpdate);
+  StoreStageDerivatives(control, iStage, iDir, 1);
+}
 
-#pragma omp parallel for num_threads(NUM_THREADS) private(iNumVars, iNumEqns,  \
-                                                          iVar, iEqn)
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    double daDerivVar;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      daDerivVar = 0;
-      iNumEqns   = update[iBody].iNumEqns[iVar];
-      for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
-        daDerivVar += iDir * evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-        evolve->daDerivProc[1][iBody][iVar][iEqn] = evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-      }
-      evolve->daDeriv[1][iBody][iVar] = daDerivVar;
+double fdRK45ErrorScale(BODY *body, UPDATE *update, int iBody, int iVar) {
+  /* Natural magnitude of variables that oscillate about zero, mirroring the
+     timescales used by fdGetTimeStep. */
+  double dScale = 0;
+
+  if (update[iBody].iaType[iVar][0] == 2) {
+    if (iVar == update[iBody].iHecc || iVar == update[iBody].iKecc) {
+      dScale = body[iBody].dEcc;
+    } else if (iVar == update[iBody].iXobl || iVar == update[iBody].iYobl ||
+               iVar == update[iBody].iZobl) {
+      dScale = sin(body[iBody].dObliquity);
+    } else {
+      dScale = 1;
     }
   }
+  return dScale;
+}
 
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-
-      if (update[iBody].iaType[iVar][0] == 0 ||
-          update[iBody].iaType[iVar][0] == 3 ||
-          update[iBody].iaType[iVar][0] == 10) {
-        // LUGER: Note that this is the VALUE of the variable getting passed,
-        // contrary to what the names suggest These values are updated in the
-        // tmpUpdate struct so that equations which are dependent upon them will
-        // be evaluated with higher accuracy
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              evolve->daDeriv[1][iBody][iVar];
+double fdRK45Error(BODY *body, CONTROL *control, UPDATE *update, double dDt) {
+  /* Return the largest embedded error estimate in units of the tolerance.
+     Explicit and derived (type 5) variables do not control the step. The
+     5th order solution is in daStateStage. */
+  int iState, iStage;
+  double dErr, dErrMax, dScale, dOld, dNew;
+  EVOLVE *evolve = &control->Evolve;
+
+  dErrMax = 0;
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    if (evolve->baStateExplicit[iState] || evolve->iaStateType[iState] == 5) {
+      continue;
+    }
+    dErr = 0;
+    for (iStage = 0; iStage < NUMSTAGES; iStage++) {
+      dErr += daRK45E[iStage] * evolve->daStateDeriv[iStage][iState];
+    }
+    dErr = fabs(dErr * dDt);
+
+    dOld   = fabs(evolve->daStateStart[iState]);
+    dNew   = fabs(evolve->daStateStage[iState]);
+    dScale = fdRK45ErrorScale(body, update, evolve->iaStateBody[iState],
+                              evolve->iaStateVar[iState]);
+    if (dOld > dScale) {
+      dScale = dOld;
+    }
+    if (dNew > dScale) {
+      dScale = dNew;
+    }
+    dScale = evolve->dAbsTol + evolve->dRelTol * dScale;
+    if (dScale > 0 && dErr / dScale > dErrMax) {
+      dErrMax = dErr / dScale;
+    }
+  }
+  return dErrMax;
+}
+
+double fdRK45StepScale(double dErr) {
+  /* Standard step size controller for a 5th order method */
+  double dScale;
+
+  if (dErr <= 0) {
+    return RK45MAXSCALE;
+  }
+  dScale = RK45SAFETY * pow(dErr, -0.2);
+  if (dScale < RK45MINSCALE) {
+    dScale = RK45MINSCALE;
+  }
+  if (dScale > RK45MAXSCALE) {
+    dScale = RK45MAXSCALE;
+  }
+  return dScale;
+}
+
+void RungeKutta45Step(BODY *body, CONTROL *control, SYSTEM *system,
+                      UPDATE *update, fnUpdateVariable ***fnUpdate,
+                      double *dDt, int iDir) {
+  /* Take one step with the Dormand-Prince RK5(4) pair. The step size is
+     chosen by the embedded error estimate and steps that exceed the
+     tolerances are repeated with a smaller step. */
+  int iState, iBody, iVar, iEqn, iStage, iProc, bAccept, bClamped, bRejected;
+  double dErr, dMin, dNextDt, dTry;
+  EVOLVE *evolve   = &control->Evolve;
+  double **daDeriv = evolve->daStateDeriv;
+
+  BodyCopy(evolve->tmpBody, body, evolve);
+  GatherState(evolve, evolve->pdStateVar, evolve->daStateStart);
+
+  /* First stage: reuse the last stage of the previous step if possible */
+  if (fbFSALValid(control, update, fnUpdate)) {
+    memcpy(daDeriv[0], daDeriv[NUMSTAGES - 1],
+           evolve->iNumState * sizeof(double));
+    memcpy(evolve->daStateProc[0], evolve->daStateProc[NUMSTAGES - 1],
+           evolve->iNumStateProc * sizeof(double));
+  } else {
+    dMin = fdGetTimeStep(body, control, system, evolve->tmpUpdate, fnUpdate);
+    StoreStageDerivatives(control, 0, iDir, 1);
+    if (evolve->dProposedDt <= 0) {
+      if (evolve->bVarDt) {
+        evolve->dProposedDt = evolve->dEta * dMin;
       } else {
-        /* While we're in this loop, move each parameter to the midpoint
-        of the timestep based on the midpoint derivative. */
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              *(update[iBody].pdVar[iVar]) +
-              0.5 * (*dDt) * evolve->daDeriv[1][iBody][iVar];
+        evolve->dProposedDt = evolve->dTimeStep;
       }
     }
   }
 
-  /* Second midpoint derivative */
-  PropertiesAuxiliary(evolve->tmpBody, control, system, update);
+  bAccept   = 0;
+  bRejected = 0;
+  while (!bAccept) {
+    dTry     = evolve->dProposedDt;
+    bClamped = 0;
+    if (!evolve->bVarDt) {
+      dTry = evolve->dTimeStep;
+    } else if (fdTimeToStepLimit(control) < dTry) {
+      dTry     = fdTimeToStepLimit(control);
+      bClamped = 1;
+    }
 
-  fdGetUpdateInfo(evolve->tmpBody, control, system, evolve->tmpUpdate,
-                  fnUpdate);
+    for (iStage = 1; iStage < NUMSTAGES; iStage++) {
+      RungeKutta45Stage(body, control, system, update, fnUpdate, dTry, iStage,
+                        iDir);
+    }
 
-#pragma omp parallel for num_threads(NUM_THREADS) private(iNumVars, iNumEqns,  \
-                                                          iVar, iEqn)
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    double daDerivVar;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      daDerivVar = 0;
-      iNumEqns   = update[iBody].iNumEqns[iVar];
-      for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
-        daDerivVar += iDir * evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-        evolve->daDerivProc[2][iBody][iVar][iEqn] = evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
+    if (!evolve->bVarDt) {
+      bAccept = 1;
+      break;
+    }
+
+    dErr    = fdRK45Error(body, control, update, dTry);
+    dNextDt = dTry * fdRK45StepScale(dErr);
+    if (dErr <= 1) {
+      bAccept = 1;
+      // Do not grow the step right after a rejection
+      if (bRejected && dNextDt > dTry) {
+        dNextDt = dTry;
+      }
+      /* A step shortened to hit an output says little about the
+         dynamical timescale, so do not let it shrink the next step. */
+      if (!bClamped || dNextDt > evolve->dProposedDt) {
+        evolve->dProposedDt = dNextDt;
       }
-      evolve->daDeriv[2][iBody][iVar] = daDerivVar;
+    } else {
+      bRejected = 1;
+      evolve->iNumRejected++;
+      evolve->dProposedDt = dNextDt;
+      if (evolve->dProposedDt <= DBL_EPSILON * fabs(evolve->dTime)) {
+        fprintf(stderr,
+                "ERROR: RK45 timestep underflow at t = %e years. Consider "
+                "increasing %s.\n",
+                evolve->dTime / YEARSEC, "dRelTol");
+        VplanetExit(EXIT_INT);
+      }
+      // Stages may have altered tmpBody beyond the primary variables
+      BodyCopy(evolve->tmpBody, body, evolve);
     }
   }
 
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-
-      if (update[iBody].iaType[iVar][0] == 0 ||
-          update[iBody].iaType[iVar][0] == 3 ||
-          update[iBody].iaType[iVar][0] == 10) {
-        // LUGER: Note that this is the VALUE of the variable getting passed,
-        // contrary to what the names suggest These values are updated in the
-        // tmpUpdate struct so that equations which are dependent upon them will
-        // be evaluated with higher accuracy
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              evolve->daDeriv[2][iBody][iVar];
-      } else {
-        /* While we're in this loop, move each parameter to the end of
-        the timestep based on the second midpoint derivative. */
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              *(update[iBody].pdVar[iVar]) +
-              *dDt * evolve->daDeriv[2][iBody][iVar];
+  *dDt               = dTry;
+  evolve->dCurrentDt = dTry;
+
+  /* Now do the update with the 5th order weights, which are the last row of
+     the tableau, i.e. the state at which the last stage was evaluated. */
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    iBody                       = evolve->iaStateBody[iState];
+    iVar                        = evolve->iaStateVar[iState];
+    update[iBody].daDeriv[iVar] = 0;
+    for (iStage = 0; iStage < NUMSTAGES - 1; iStage++) {
+      update[iBody].daDeriv[iVar] +=
+            daRK45A[NUMSTAGES - 1][iStage] * daDeriv[iStage][iState];
+    }
+    iProc = evolve->iaStateProcOffset[iState];
+    for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++, iProc++) {
+      update[iBody].daDerivProc[iVar][iEqn] = 0;
+      for (iStage = 0; iStage < NUMSTAGES - 1; iStage++) {
+        update[iBody].daDerivProc[iVar][iEqn] +=
+              daRK45A[NUMSTAGES - 1][iStage] * evolve->daStateProc[iStage][iProc];
       }
     }
+
+    if (evolve->baStateExplicit[iState]) {
+      evolve->daStateStage[iState] = daDeriv[NUMSTAGES - 1][iState];
+    }
   }
+  ScatterState(evolve, evolve->pdStateVar, evolve->daStateStage);
 
-  /* Full step derivative */
-  PropertiesAuxiliary(evolve->tmpBody, control, system, update);
+  SaveFSALState(control, update, fnUpdate);
+}
+
+/*
+ * Rosenbrock method for stiff systems (Shampine 1982, as in Numerical
+ * Recipes' stiff). The Jacobian is built by finite differences over the
+ * integrated primary variables and reused across steps.
+ */
+
+#define ROSENGAMMA (1.0 / 2.0)
+#define ROSENA21 2.0
+#define ROSENA31 (48.0 / 25.0)
+#define ROSENA32 (6.0 / 25.0)
+#define ROSENC21 -8.0
+#define ROSENC31 (372.0 / 25.0)
+#define ROSENC32 (12.0 / 5.0)
+#define ROSENC41 (-112.0 / 125.0)
+#define ROSENC42 (-54.0 / 125.0)
+#define ROSENC43 (-2.0 / 5.0)
+#define ROSENB1 (19.0 / 9.0)
+#define ROSENB2 (1.0 / 2.0)
+#define ROSENB3 (25.0 / 108.0)
+#define ROSENB4 (125.0 / 108.0)
+#define ROSENE1 (17.0 / 54.0)
+#define ROSENE2 (7.0 / 36.0)
+#define ROSENE3 0.0
+#define ROSENE4 (125.0 / 108.0)
+#define ROSENA2X 1.0
+#define ROSENA3X (3.0 / 5.0)
+#define ROSENC1X (1.0 / 2.0)
+#define ROSENC2X (-3.0 / 2.0)
+#define ROSENC3X (121.0 / 50.0)
+#define ROSENC4X (29.0 / 250.0)
+
+void InitializeRosenbrock(CONTROL *control, UPDATE *update) {
+  /* Select the integrated elements of the state vector and allocate the
+     linear algebra work space. */
+  int iState, iStiff, iNum, iStage;
+  EVOLVE *evolve = &control->Evolve;
+
+  iNum = 0;
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    if (!evolve->baStateExplicit[iState]) {
+      iNum++;
+    }
+  }
+  evolve->iNumStiffVars = iNum;
+  evolve->iaStiffState  = malloc(iNum * sizeof(int));
+
+  iStiff = 0;
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    if (!evolve->baStateExplicit[iState]) {
+      evolve->iaStiffState[iStiff] = iState;
+      iStiff++;
+    }
+  }
 
+  evolve->daJacobian     = malloc(iNum * sizeof(double *));
+  evolve->daStiffMatrix  = malloc(iNum * sizeof(double *));
+  evolve->daStiffLU      = malloc(iNum * sizeof(double *));
+  for (iStiff = 0; iStiff < iNum; iStiff++) {
+    evolve->daJacobian[iStiff]    = malloc(iNum * sizeof(double));
+    evolve->daStiffMatrix[iStiff] = malloc(iNum * sizeof(double));
+    evolve->daStiffLU[iStiff]     = malloc(iNum * sizeof(double));
+  }
+  evolve->daStiffScale   = malloc(iNum * sizeof(double));
+  evolve->iaStiffRowswap = malloc(iNum * sizeof(int));
+  evolve->daStiffStage   = malloc(4 * sizeof(double *));
+  for (iStage = 0; iStage < 4; iStage++) {
+    evolve->daStiffStage[iStage] = malloc(iNum * sizeof(double));
+  }
+  evolve->daStiffState  = malloc(iNum * sizeof(double));
+  evolve->daStiffWork   = malloc(iNum * sizeof(double));
+  evolve->daStiffDeriv0 = malloc(iNum * sizeof(double));
+  evolve->daStiffDeriv  = malloc(iNum * sizeof(double));
+  evolve->daStiffDfDt   = malloc(iNum * sizeof(double));
+
+  evolve->dProposedDt    = 0;
+  evolve->dStiffFirstDt  = 0;
+  evolve->iNumRejected   = 0;
+  evolve->dStiffLUDt     = 0;
+  evolve->iJacobianAge   = 0;
+  evolve->bJacobianValid = 0;
+}
+
+void RosenbrockDerivatives(BODY *body, CONTROL *control, SYSTEM *system,
+                           UPDATE *update, fnUpdateVariable ***fnUpdate,
+                           double *daState, double dOffset, int iDir,
+                           int bKeepExplicit, double *daDeriv) {
+  /* Evaluate the derivatives of the integrated variables at daState and
+     age offset dOffset, using tmpBody. If bKeepExplicit, the explicit
+     variables keep their new values, as in the RK4 stages. */
+  int iBody, iVar, iEqn, iState, iStiff;
+  EVOLVE *evolve = &control->Evolve;
+
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    evolve->tmpBody[iBody].dAge = body[iBody].dAge + iDir * dOffset;
+  }
+  for (iStiff = 0; iStiff < evolve->iNumStiffVars; iStiff++) {
+    *(evolve->pdStateTmpVar[evolve->iaStiffState[iStiff]]) = daState[iStiff];
+  }
+
+  PropertiesAuxiliary(evolve->tmpBody, control, system, update);
   fdGetUpdateInfo(evolve->tmpBody, control, system, evolve->tmpUpdate,
                   fnUpdate);
 
-#pragma omp parallel for num_threads(NUM_THREADS) private(iNumVars, iNumEqns,  \
-                                                          iVar, iEqn)
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    double daDerivVar;
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      daDerivVar = 0;
-      if (update[iBody].iaType[iVar][0] == 0 ||
-          update[iBody].iaType[iVar][0] == 3 ||
-          update[iBody].iaType[iVar][0] == 10) {
-        // NOTHING!
-      } else {
-        evolve->daDeriv[3][iBody][iVar] = 0;
-        iNumEqns                        = update[iBody].iNumEqns[iVar];
-        for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
-          daDerivVar += iDir * evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-          evolve->daDerivProc[3][iBody][iVar][iEqn] = evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
+  for (iStiff = 0; iStiff < evolve->iNumStiffVars; iStiff++) {
+    iBody           = evolve->iaStateBody[evolve->iaStiffState[iStiff]];
+    iVar            = evolve->iaStateVar[evolve->iaStiffState[iStiff]];
+    daDeriv[iStiff] = 0;
+    for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+      daDeriv[iStiff] +=
+            iDir * evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
+    }
+  }
+
+  if (bKeepExplicit) {
+    for (iState = 0; iState < evolve->iNumState; iState++) {
+      if (evolve->baStateExplicit[iState]) {
+        iBody                           = evolve->iaStateBody[iState];
+        iVar                            = evolve->iaStateVar[iState];
+        *(evolve->pdStateTmpVar[iState]) = 0;
+        for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+          *(evolve->pdStateTmpVar[iState]) +=
+                evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
         }
-        evolve->daDeriv[3][iBody][iVar] = daDerivVar;
       }
     }
   }
-  /* Now do the update -- Note the pointer to the home of the actual
-   * variables!!! */
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      update[iBody].daDeriv[iVar] = 1. / 6 *
-                                    (evolve->daDeriv[0][iBody][iVar] +
-                                     2 * evolve->daDeriv[1][iBody][iVar] +
-                                     2 * evolve->daDeriv[2][iBody][iVar] +
-                                     evolve->daDeriv[3][iBody][iVar]);
-      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-        update[iBody].daDerivProc[iVar][iEqn] = 1. / 6 *
-                                    (evolve->daDerivProc[0][iBody][iVar][iEqn] +
-                                     2 * evolve->daDerivProc[1][iBody][iVar][iEqn] +
-                                     2 * evolve->daDerivProc[2][iBody][iVar][iEqn] +
-                                     evolve->daDerivProc[3][iBody][iVar][iEqn]);
+}
+
+void RosenbrockJacobian(BODY *body, CONTROL *control, SYSTEM *system,
+                        UPDATE *update, fnUpdateVariable ***fnUpdate,
+                        int iDir) {
+  /* Forward difference Jacobian about daStiffState, whose derivatives are
+     in daStiffDeriv0. Costs one derivative evaluation per column, plus one
+     for the explicit age dependence in daStiffDfDt. */
+  int iRow, iCol, iState, iNum, iBody;
+  double dDelta, dScale;
+  EVOLVE *evolve = &control->Evolve;
+
+  iNum = evolve->iNumStiffVars;
+  for (iCol = 0; iCol < iNum; iCol++) {
+    evolve->daStiffWork[iCol] = evolve->daStiffState[iCol];
+  }
+
+  for (iCol = 0; iCol < iNum; iCol++) {
+    iState = evolve->iaStiffState[iCol];
+    dScale = fdRK45ErrorScale(body, update, evolve->iaStateBody[iState],
+                              evolve->iaStateVar[iState]);
+    if (fabs(evolve->daStiffState[iCol]) > dScale) {
+      dScale = fabs(evolve->daStiffState[iCol]);
+    }
+    if (fabs(evolve->dProposedDt * evolve->daStiffDeriv0[iCol]) > dScale) {
+      dScale = fabs(evolve->dProposedDt * evolve->daStiffDeriv0[iCol]);
+    }
+    if (dScale == 0) {
+      dScale = 1;
+    }
+    dDelta = sqrt(DBL_EPSILON) * dScale;
+
+    evolve->daStiffWork[iCol] = evolve->daStiffState[iCol] + dDelta;
+    // Recompute the increment actually represented in floating point
+    dDelta = evolve->daStiffWork[iCol] - evolve->daStiffState[iCol];
+    RosenbrockDerivatives(body, control, system, update, fnUpdate,
+                          evolve->daStiffWork, 0, iDir, 0,
+                          evolve->daStiffDeriv);
+    for (iRow = 0; iRow < iNum; iRow++) {
+      evolve->daJacobian[iRow][iCol] =
+            (evolve->daStiffDeriv[iRow] - evolve->daStiffDeriv0[iRow]) / dDelta;
+    }
+    evolve->daStiffWork[iCol] = evolve->daStiffState[iCol];
+  }
+
+  /* Derivatives that depend on age, e.g. through the stellar tracks, need
+     df/dt to keep the method 4th order. */
+  dScale = fabs(evolve->dProposedDt);
+  if (fabs(evolve->dTime) > dScale) {
+    dScale = fabs(evolve->dTime);
+  }
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    if (fabs(body[iBody].dAge) > dScale) {
+      dScale = fabs(body[iBody].dAge);
+    }
+  }
+  if (dScale == 0) {
+    dScale = 1;
+  }
+  dDelta = sqrt(DBL_EPSILON) * dScale;
+  RosenbrockDerivatives(body, control, system, update, fnUpdate,
+                        evolve->daStiffWork, dDelta, iDir, 0,
+                        evolve->daStiffDeriv);
+  for (iRow = 0; iRow < iNum; iRow++) {
+    evolve->daStiffDfDt[iRow] =
+          (evolve->daStiffDeriv[iRow] - evolve->daStiffDeriv0[iRow]) / dDelta;
+  }
+
+  evolve->bJacobianValid = 1;
+  evolve->iJacobianAge   = 0;
+  evolve->dStiffLUDt     = 0; // Force a new decomposition
+}
+
+void RosenbrockStep(BODY *body, CONTROL *control, SYSTEM *system,
+                    UPDATE *update, fnUpdateVariable ***fnUpdate, double *dDt,
+                    int iDir) {
+  /* Take one step with a 4th order Rosenbrock method with embedded 3rd
+     order error estimate. The LU decomposition of 1/(gamma*dt) - J is kept
+     as long as the Jacobian is current and the step barely changes. */
+  int iBody, iVar, iEqn, iState, iStiff, jStiff, iNum, bAccept, bClamped;
+  double dMin, dTry, dErr, dErrVar, dScale, dNew, dNextDt;
+  double *daG1, *daG2, *daG3, *daG4;
+  EVOLVE *evolve = &control->Evolve;
+
+  iNum = evolve->iNumStiffVars;
+  daG1 = evolve->daStiffStage[0];
+  daG2 = evolve->daStiffStage[1];
+  daG3 = evolve->daStiffStage[2];
+  daG4 = evolve->daStiffStage[3];
+
+  BodyCopy(evolve->tmpBody, body, evolve);
+
+  /* Derivatives at the start of the step, which also provide the first
+     step size and the values of the explicit variables. */
+  dMin = fdGetTimeStep(body, control, system, evolve->tmpUpdate, fnUpdate);
+  if (evolve->dProposedDt <= 0) {
+    if (evolve->bVarDt) {
+      evolve->dProposedDt = evolve->dEta * dMin;
+    } else {
+      evolve->dProposedDt = evolve->dTimeStep;
+    }
+    evolve->dStiffFirstDt = evolve->dProposedDt;
+  }
+  for (iStiff = 0; iStiff < iNum; iStiff++) {
+    iState                        = evolve->iaStiffState[iStiff];
+    iBody                         = evolve->iaStateBody[iState];
+    iVar                          = evolve->iaStateVar[iState];
+    evolve->daStiffState[iStiff]  = *(evolve->pdStateVar[iState]);
+    evolve->daStiffDeriv0[iStiff] = 0;
+    for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+      evolve->daStiffDeriv0[iStiff] +=
+            iDir * evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
+    }
+  }
+
+  if (!evolve->bJacobianValid || evolve->iJacobianAge >= ROSENMAXJACAGE) {
+    RosenbrockJacobian(body, control, system, update, fnUpdate, iDir);
+  }
+
+  bAccept = 0;
+  while (!bAccept) {
+    dTry     = evolve->dProposedDt;
+    bClamped = 0;
+    if (!evolve->bVarDt) {
+      dTry = evolve->dTimeStep;
+    } else if (dTry >= evolve->dStiffLUDt &&
+               dTry <= ROSENLUREUSE * evolve->dStiffLUDt) {
+      // A slightly smaller step is safe and saves a decomposition
+      dTry = evolve->dStiffLUDt;
+    }
+    if (evolve->bVarDt && fdTimeToStepLimit(control) < dTry) {
+      dTry     = fdTimeToStepLimit(control);
+      bClamped = 1;
+    }
+
+    if (dTry != evolve->dStiffLUDt) {
+      for (iStiff = 0; iStiff < iNum; iStiff++) {
+        for (jStiff = 0; jStiff < iNum; jStiff++) {
+          evolve->daStiffMatrix[iStiff][jStiff] =
+                -evolve->daJacobian[iStiff][jStiff];
+        }
+        evolve->daStiffMatrix[iStiff][iStiff] += 1.0 / (ROSENGAMMA * dTry);
+      }
+      LUDecomp(evolve->daStiffMatrix, evolve->daStiffLU, evolve->daStiffScale,
+               evolve->iaStiffRowswap, iNum);
+      evolve->dStiffLUDt = dTry;
+    }
+
+    // Explicit variables start each attempt at their current values
+    for (iState = 0; iState < evolve->iNumState; iState++) {
+      if (evolve->baStateExplicit[iState]) {
+        *(evolve->pdStateTmpVar[iState]) = *(evolve->pdStateVar[iState]);
+      }
+    }
+
+    for (iStiff = 0; iStiff < iNum; iStiff++) {
+      daG1[iStiff] = evolve->daStiffDeriv0[iStiff] +
+                     dTry * ROSENC1X * evolve->daStiffDfDt[iStiff];
+    }
+    LUSolve(evolve->daStiffLU, daG1, evolve->iaStiffRowswap, iNum);
+
+    for (iStiff = 0; iStiff < iNum; iStiff++) {
+      evolve->daStiffWork[iStiff] =
+            evolve->daStiffState[iStiff] + ROSENA21 * daG1[iStiff];
+    }
+    RosenbrockDerivatives(body, control, system, update, fnUpdate,
+                          evolve->daStiffWork, ROSENA2X * dTry, iDir, 1,
+                          evolve->daStiffDeriv);
+    for (iStiff = 0; iStiff < iNum; iStiff++) {
+      daG2[iStiff] = evolve->daStiffDeriv[iStiff] +
+                     dTry * ROSENC2X * evolve->daStiffDfDt[iStiff] +
+                     ROSENC21 * daG1[iStiff] / dTry;
+    }
+    LUSolve(evolve->daStiffLU, daG2, evolve->iaStiffRowswap, iNum);
+
+    for (iStiff = 0; iStiff < iNum; iStiff++) {
+      evolve->daStiffWork[iStiff] = evolve->daStiffState[iStiff] +
+                                    ROSENA31 * daG1[iStiff] +
+                                    ROSENA32 * daG2[iStiff];
+    }
+    RosenbrockDerivatives(body, control, system, update, fnUpdate,
+                          evolve->daStiffWork, ROSENA3X * dTry, iDir, 0,
+                          evolve->daStiffDeriv);
+    for (iStiff = 0; iStiff < iNum; iStiff++) {
+      daG3[iStiff] =
+            evolve->daStiffDeriv[iStiff] +
+            dTry * ROSENC3X * evolve->daStiffDfDt[iStiff] +
+            (ROSENC31 * daG1[iStiff] + ROSENC32 * daG2[iStiff]) / dTry;
+    }
+    LUSolve(evolve->daStiffLU, daG3, evolve->iaStiffRowswap, iNum);
+
+    for (iStiff = 0; iStiff < iNum; iStiff++) {
+      daG4[iStiff] = evolve->daStiffDeriv[iStiff] +
+                     dTry * ROSENC4X * evolve->daStiffDfDt[iStiff] +
+                     (ROSENC41 * daG1[iStiff] + ROSENC42 * daG2[iStiff] +
+                      ROSENC43 * daG3[iStiff]) /
+                           dTry;
+    }
+    LUSolve(evolve->daStiffLU, daG4, evolve->iaStiffRowswap, iNum);
+
+    /* New state and error estimate */
+    dErr = 0;
+    for (iStiff = 0; iStiff < iNum; iStiff++) {
+      iState = evolve->iaStiffState[iStiff];
+      iBody  = evolve->iaStateBody[iState];
+      iVar   = evolve->iaStateVar[iState];
+      dNew   = evolve->daStiffState[iStiff] + ROSENB1 * daG1[iStiff] +
+             ROSENB2 * daG2[iStiff] + ROSENB3 * daG3[iStiff] +
+             ROSENB4 * daG4[iStiff];
+      evolve->daStiffWork[iStiff] = dNew;
+      /* A variable that is switching on from zero, e.g. a reservoir that
+         starts to fill, has no relative accuracy to control yet. */
+      if (update[iBody].iaType[iVar][0] == 5 ||
+          (evolve->daStiffState[iStiff] == 0 && evolve->dAbsTol == 0)) {
+        continue;
+      }
+      dErrVar = fabs(ROSENE1 * daG1[iStiff] + ROSENE2 * daG2[iStiff] +
+                     ROSENE3 * daG3[iStiff] + ROSENE4 * daG4[iStiff]);
+      dScale = fdRK45ErrorScale(body, update, iBody, iVar);
+      if (fabs(evolve->daStiffState[iStiff]) > dScale) {
+        dScale = fabs(evolve->daStiffState[iStiff]);
+      }
+      if (fabs(dNew) > dScale) {
+        dScale = fabs(dNew);
       }
+      dScale = evolve->dAbsTol + evolve->dRelTol * dScale;
+      if (dScale > 0 && dErrVar / dScale > dErr) {
+        dErr = dErrVar / dScale;
+      }
+    }
 
-      if (update[iBody].iaType[iVar][0] == 0 ||
-          update[iBody].iaType[iVar][0] == 3 ||
-          update[iBody].iaType[iVar][0] == 10) {
-        // LUGER: Note that this is the VALUE of the variable getting passed,
-        // contrary to what the names suggest
-        *(update[iBody].pdVar[iVar]) = evolve->daDeriv[0][iBody][iVar];
+    if (!evolve->bVarDt || dErr <= 1) {
+      bAccept = 1;
+      evolve->iJacobianAge++;
+      if (dErr > ROSENERRCON) {
+        dNextDt = ROSENSAFETY * dTry * pow(dErr, -0.25);
       } else {
-        *(update[iBody].pdVar[iVar]) += update[iBody].daDeriv[iVar] * (*dDt);
+        dNextDt = ROSENGROW * dTry;
+      }
+      if (!bClamped || dNextDt > evolve->dProposedDt) {
+        evolve->dProposedDt = dNextDt;
       }
+    } else {
+      evolve->iNumRejected++;
+      dNextDt = ROSENSAFETY * dTry * pow(dErr, -1.0 / 3);
+      if (dNextDt < ROSENSHRINK * dTry) {
+        dNextDt = ROSENSHRINK * dTry;
+      }
+      evolve->dProposedDt = dNextDt;
+      BodyCopy(evolve->tmpBody, body, evolve);
+      // A stale Jacobian is the usual culprit of a rejected step
+      if (evolve->iJacobianAge > 0) {
+        RosenbrockJacobian(body, control, system, update, fnUpdate, iDir);
+      }
+    }
+
+    /* Steps this small mean the derivatives are not smooth in the state,
+       which defeats the linearization. Stop rather than crawl. The first
+       step sets the scale at t = 0. */
+    if (evolve->dProposedDt <=
+        ROSENMINSTEP * fmax(fabs(evolve->dTime), evolve->dStiffFirstDt)) {
+      fprintf(stderr,
+              "ERROR: Rosenbrock timestep underflow at t = %e years. "
+              "Consider increasing %s or %s.\n",
+              evolve->dTime / YEARSEC, "dRelTol", "dAbsTol");
+      VplanetExit(EXIT_INT);
+    }
+  }
+
+  *dDt               = dTry;
+  evolve->dCurrentDt = dTry;
+
+  /* Now do the update. Explicit variables take their values at the end of
+     the step, which were kept by the second stage. */
+  for (iStiff = 0; iStiff < iNum; iStiff++) {
+    iState = evolve->iaStiffState[iStiff];
+    iBody  = evolve->iaStateBody[iState];
+    iVar   = evolve->iaStateVar[iState];
+    update[iBody].daDeriv[iVar] =
+          (evolve->daStiffWork[iStiff] - evolve->daStiffState[iStiff]) / dTry;
+    *(evolve->pdStateVar[iState]) = evolve->daStiffWork[iStiff];
+  }
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    if (evolve->baStateExplicit[iState]) {
+      *(evolve->pdStateVar[iState]) = *(evolve->pdStateTmpVar[iState]);
+    }
+  }
+}
+
+/*
+ * Dense output
+ */
+
+void DenseOutputState(CONTROL *control, double dTheta, double dDt) {
+  /* Interpolate the state a fraction dTheta through the last step into
+     daStateDense. The integrated variables use the cubic Hermite polynomial
+     through the state and derivative at both ends of the step, as the
+     integrator left them in daStateStart and daStateStage, i.e. before
+     ForceBehavior. The end derivative is the last stage, which RK45
+     evaluates at the new state and RungeKutta4EndDerivatives puts in place
+     of RK4's full-step predictor. Explicit variables are interpolated
+     linearly between their values. */
+  int iState;
+  EVOLVE *evolve   = &control->Evolve;
+  double *daStart  = evolve->daStateStart;
+  double *daEnd    = evolve->daStateStage;
+  double *daDeriv0 = evolve->daStateDeriv[0];
+  double *daDeriv1;
+  double dH00, dH10, dH01, dH11;
+
+  if (evolve->iOneStep == RK45) {
+    daDeriv1 = evolve->daStateDeriv[NUMSTAGES - 1];
+  } else {
+    daDeriv1 = evolve->daStateDeriv[3];
+  }
+
+  dH00 = (1 + 2 * dTheta) * (1 - dTheta) * (1 - dTheta);
+  dH10 = dTheta * (1 - dTheta) * (1 - dTheta) * dDt;
+  dH01 = dTheta * dTheta * (3 - 2 * dTheta);
+  dH11 = dTheta * dTheta * (dTheta - 1) * dDt;
+
+  for (iState = 0; iState < evolve->iNumState; iState++) {
+    if (evolve->baStateExplicit[iState]) {
+      evolve->daStateDense[iState] =
+            daStart[iState] + dTheta * (daEnd[iState] - daStart[iState]);
+    } else {
+      evolve->daStateDense[iState] =
+            dH00 * daStart[iState] + dH10 * daDeriv0[iState] +
+            dH01 * daEnd[iState] + dH11 * daDeriv1[iState];
     }
   }
 }
 
+void RungeKutta4EndDerivatives(CONTROL *control, SYSTEM *system,
+                               UPDATE *update, fnUpdateVariable ***fnUpdate,
+                               int iDir) {
+  /* The last RK4 stage is evaluated at the full-step predictor, which would
+     make the interpolation only 3rd order. Replace it with the derivatives
+     at the new state, evaluated like the stages in tmpBody, which still
+     holds the last stage. */
+  EVOLVE *evolve = &control->Evolve;
+
+  ScatterState(evolve, evolve->pdStateTmpVar, evolve->daStateStage);
+  PropertiesAuxiliary(evolve->tmpBody, control, system, update);
+  fdGetUpdateInfo(evolve->tmpBody, control, system, evolve->tmpUpdate,
+                  fnUpdate);
+  StoreStageDerivatives(control, 3, iDir, 0);
+}
+
+void WriteDenseOutput(BODY *body, CONTROL *control, FILES *files,
+                      OUTPUT *output, SYSTEM *system, UPDATE *update,
+                      fnUpdateVariable ***fnUpdate, fnWriteOutput *fnWrite,
+                      double dDt, int iDir) {
+  /* Write every output time that fell inside the step just taken from the
+     interpolated state, then return BODY to the end of the step. An output
+     at the end of the step is written from BODY as is. */
+  int iBody;
+  EVOLVE *evolve  = &control->Evolve;
+  double dTimeEnd = evolve->dTime;
+  double dBefore;
+  double *daAgeEnd = evolve->daAgeEnd;
+
+  if (evolve->iOneStep == RUNGEKUTTA) {
+    RungeKutta4EndDerivatives(control, system, update, fnUpdate, iDir);
+  }
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    daAgeEnd[iBody] = body[iBody].dAge;
+  }
+  GatherState(evolve, evolve->pdStateVar, evolve->daStateEnd);
+
+  while (control->Io.dNextOutput <= dTimeEnd) {
+    dBefore = dTimeEnd - control->Io.dNextOutput;
+    if (dBefore > 0) {
+      DenseOutputState(control, 1 - dBefore / dDt, dDt);
+      ScatterState(evolve, evolve->pdStateVar, evolve->daStateDense);
+    } else {
+      ScatterState(evolve, evolve->pdStateVar, evolve->daStateEnd);
+    }
+    for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+      body[iBody].dAge = daAgeEnd[iBody] - iDir * dBefore;
+    }
+    evolve->dTime = control->Io.dNextOutput;
+
+    PropertiesAuxiliary(body, control, system, update);
+    evolve->iStateVersion++;
+    GetCurrentDerivatives(body, control, system, update, fnUpdate);
+    WriteOutput(body, control, files, output, system, update, fnWrite,
+                evolve->dTime, control->Io.dOutputTime / evolve->nSteps);
+    control->Io.dNextOutput += control->Io.dOutputTime;
+  }
+
+  evolve->dTime = dTimeEnd;
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    body[iBody].dAge = daAgeEnd[iBody];
+  }
+  ScatterState(evolve, evolve->pdStateVar, evolve->daStateEnd);
+  evolve->iStateVersion++;
+  if (evolve->bAuxDerivs) {
+    GetCurrentDerivatives(body, control, system, update, fnUpdate);
+  }
+}
+
 /*
  * Evolution Subroutine
  */
 
-void Evolve(BODY *body, CONTROL *control, FILES *files, MODULE *module,
-            OUTPUT *output, SYSTEM *system, UPDATE *update,
-            fnUpdateVariable ***fnUpdate, fnWriteOutput *fnWrite,
-            fnIntegrate fnOneStep) {
-  /* Master evolution routine that controls the simulation integration. */
-  int iDir, iBody, iModule, nSteps; // Dummy counting variables
-  double dDt, dFoo;                 // Next timestep, dummy variable
-  double dEqSpinRate;               // Store the equilibrium spin rate
+/* Evolve runs in the phases below, so that the lockstep ensemble in
+   ensemble.c can advance many systems with one shared step and still run
+   the rest of each system's loop exactly as Evolve does. Only the phases
+   named Write... touch files. */
 
-  nSteps = 0;
+int fiBeginEvolve(BODY *body, CONTROL *control, FILES *files, OUTPUT *output,
+                  SYSTEM *system, UPDATE *update, fnUpdateVariable ***fnUpdate,
+                  fnWriteOutput *fnWrite, double *dDt) {
+  /* Prepare the main loop: restart from the checkpoint, or write the initial
+     conditions. Returns the direction of the integration. */
 
-  if (control->Evolve.bDoForward) {
-    iDir = 1;
+  if (control->Io.bRestart || control->Io.dCheckpointTime > 0) {
+    InitializeCheckpoint(control, update, fnUpdate);
+  }
+  if (control->Io.bRestart) {
+    /* Pick up where the checkpoint was written: right after an output, at
+       the end of the main loop */
+    ReadCheckpoint(body, control, files, system, update, fnUpdate, dDt);
+    UpdateCopy(control->Evolve.tmpUpdate, update, control->Evolve.iNumBodies);
+    BodyCopyStatic(control->Evolve.tmpBody, body, &control->Evolve);
+    PropertiesAuxiliary(body, control, system, update);
+    control->Evolve.iStateVersion++;
+    control->Evolve.bFirstStep = 0;
+    CheckProgress(body, control, system, update);
   } else {
-    iDir = -1;
+    PropertiesAuxiliary(body, control, system, update);
+    control->Io.dNextOutput = control->Evolve.dTime + control->Io.dOutputTime;
+    control->Io.dNextCheckpoint =
+          control->Evolve.dTime + control->Io.dCheckpointTime;
+
+    // Get derivatives at start, useful for logging
+    *dDt = fdGetTimeStep(body, control, system, update, fnUpdate);
+    control->Evolve.iStateVersion = 0;
+    control->Evolve.iDerivVersion = 0;
+    control->Evolve.bAuxDerivs    = fbAuxUsesDerivatives(body, control);
+
+    /* Adjust dt? */
+    if (control->Evolve.bVarDt) {
+      /* Now choose the correct timestep */
+      *dDt = AssignDt(*dDt, fdTimeToStepLimit(control),
+                      control->Evolve.dEta);
+    } else {
+      *dDt = control->Evolve.dTimeStep;
+    }
+
+    /* Write out initial conditions */
+    WriteOutput(body, control, files, output, system, update, fnWrite,
+                control->Evolve.dTime, *dDt);
+    // Output routines may set BODY members
+    control->Evolve.iStateVersion++;
+
+    /* If Runge-Kutta need to copy actual update to that in
+       control->Evolve. This transfer all the meta-data about the
+       struct. */
+    UpdateCopy(control->Evolve.tmpUpdate, update, control->Evolve.iNumBodies);
+    BodyCopyStatic(control->Evolve.tmpBody, body, &control->Evolve);
   }
 
-  PropertiesAuxiliary(body, control, system, update);
-  control->Io.dNextOutput = control->Evolve.dTime + control->Io.dOutputTime;
+  if (control->Evolve.bDoForward) {
+    return 1;
+  }
+  return -1;
+}
 
-  // Get derivatives at start, useful for logging
-  dDt = fdGetTimeStep(body, control, system, update, fnUpdate);
+int fbEndStepHalts(BODY *body, CONTROL *control, MODULE *module,
+                   SYSTEM *system, UPDATE *update,
+                   fnUpdateVariable ***fnUpdate, double dDt) {
+  /* Apply each module's forced behavior after a step, and check whether
+     the integration must halt. */
+  int iBody, iModule;
 
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    for (iModule = 0; iModule < control->Evolve.iNumModules[iBody];
+         iModule++) {
+      control->fnForceBehavior[iBody][iModule](body, module, &control->Evolve,
+                                               &control->Io, system, update,
+                                               fnUpdate, iBody, iModule);
+    }
 
-  /* Adjust dt? */
-  if (control->Evolve.bVarDt) {
-    /* Now choose the correct timestep */
-    dDt = AssignDt(dDt, (control->Io.dNextOutput - control->Evolve.dTime),
-                   control->Evolve.dEta);
-  } else {
-    dDt = control->Evolve.dTimeStep;
+    for (iModule = 0; iModule < control->iNumMultiForce[iBody]; iModule++) {
+      control->fnForceBehaviorMulti[iBody][iModule](
+            body, module, &control->Evolve, &control->Io, system, update,
+            fnUpdate, iBody, iModule);
+    }
+  }
+
+  control->Evolve.iStateVersion++;
+
+  /* Derivatives at the end of the step are only needed for output and by
+     modules whose auxiliary properties depend on them. The halts use the
+     step-averaged daDeriv, and the next step evaluates its own first stage
+     after the auxiliary properties are updated. */
+  if (control->Evolve.bAuxDerivs ||
+      (!control->Io.bDenseOutput &&
+       control->Evolve.dTime + dDt >= control->Io.dNextOutput)) {
+    GetCurrentDerivatives(body, control, system, update, fnUpdate);
   }
 
-  /* Write out initial conditions */
+  return fbCheckHalt(body, control, update, fnUpdate);
+}
+
+void WriteHaltOutput(BODY *body, CONTROL *control, FILES *files,
+                     OUTPUT *output, SYSTEM *system, UPDATE *update,
+                     fnUpdateVariable ***fnUpdate, fnWriteOutput *fnWrite) {
+  /* Write the state at which the integration halted */
+
+  GetCurrentDerivatives(body, control, system, update, fnUpdate);
   WriteOutput(body, control, files, output, system, update, fnWrite,
-              control->Evolve.dTime, dDt);
+              control->Evolve.dTime,
+              control->Io.dOutputTime / control->Evolve.nSteps);
+}
+
+int fbAdvanceTime(BODY *body, CONTROL *control, double dDt, int iDir,
+                  int *nSteps) {
+  /* Move the clocks to the end of the step. Returns whether an output is
+     due. */
+  int iBody;
+
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    body[iBody].dAge += iDir * dDt;
+  }
+
+  control->Evolve.dTime += dDt;
+  (*nSteps)++;
+
+  return control->Evolve.dTime >= control->Io.dNextOutput;
+}
+
+void WriteEvolveOutput(BODY *body, CONTROL *control, FILES *files,
+                       OUTPUT *output, SYSTEM *system, UPDATE *update,
+                       fnUpdateVariable ***fnUpdate, fnWriteOutput *fnWrite,
+                       double *dDt, int iDir, int *nSteps) {
+  /* Write the outputs that are due, and a checkpoint if one is due too */
+
+  control->Evolve.nSteps += *nSteps;
+  if (control->Io.bDenseOutput) {
+    WriteDenseOutput(body, control, files, output, system, update, fnUpdate,
+                     fnWrite, *dDt, iDir);
+  } else {
+    WriteOutput(body, control, files, output, system, update, fnWrite,
+                control->Evolve.dTime,
+                control->Io.dOutputTime / control->Evolve.nSteps);
+    control->Evolve.iStateVersion++;
+    // Timesteps are synchronized with the output time, so this statement
+    // is sufficient
+    control->Io.dNextOutput += control->Io.dOutputTime;
+  }
+  *nSteps = 0;
+
+  /* Checkpoints are only written at outputs, so that a restarted run
+     continues the output files from a complete line. */
+  if (control->Io.dCheckpointTime > 0 &&
+      control->Evolve.dTime >= control->Io.dNextCheckpoint &&
+      control->Evolve.dTime < control->Evolve.dStopTime) {
+    while (control->Io.dNextCheckpoint <= control->Evolve.dTime) {
+      control->Io.dNextCheckpoint += control->Io.dCheckpointTime;
+    }
+    WriteCheckpoint(body, control, files, system, update, fnUpdate, dDt);
+  }
+}
+
+void PrepareNextStep(BODY *body, CONTROL *control, SYSTEM *system,
+                     UPDATE *update) {
+  /* Get auxiliary properties for next step -- first call
+     was prior to loop. */
+  PropertiesAuxiliary(body, control, system, update);
+  control->Evolve.iStateVersion++;
+
+  // If control->Evolve.bFirstStep hasn't been switched off by now, do so.
+  if (control->Evolve.bFirstStep) {
+    control->Evolve.bFirstStep = 0;
+  }
+
+  // Any variables reached an interesting value?
+  CheckProgress(body, control, system, update);
+}
+
+void Evolve(BODY *body, CONTROL *control, FILES *files, MODULE *module,
+            OUTPUT *output, SYSTEM *system, UPDATE *update,
+            fnUpdateVariable ***fnUpdate, fnWriteOutput *fnWrite,
+            fnIntegrate fnOneStep) {
+  /* Master evolution routine that controls the simulation integration. */
+  int iDir, nSteps = 0; // Direction and steps since the last output
+  double dDt;           // Next timestep
 
-  /* If Runge-Kutta need to copy actual update to that in
-     control->Evolve. This transfer all the meta-data about the
-     struct. */
-  UpdateCopy(control->Evolve.tmpUpdate, update, control->Evolve.iNumBodies);
+  iDir = fiBeginEvolve(body, control, files, output, system, update, fnUpdate,
+                       fnWrite, &dDt);
 
   /*
    *
@@ -662,62 +1848,21 @@ void Evolve(BODY *body, CONTROL *control, FILES *files, MODULE *module,
     /* Take one step */
     fnOneStep(body, control, system, update, fnUpdate, &dDt, iDir);
 
-    for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
-      for (iModule = 0; iModule < control->Evolve.iNumModules[iBody];
-           iModule++) {
-        control->fnForceBehavior[iBody][iModule](body, module, &control->Evolve,
-                                                 &control->Io, system, update,
-                                                 fnUpdate, iBody, iModule);
-      }
-
-      for (iModule = 0; iModule < control->iNumMultiForce[iBody]; iModule++) {
-        control->fnForceBehaviorMulti[iBody][iModule](
-              body, module, &control->Evolve, &control->Io, system, update,
-              fnUpdate, iBody, iModule);
-      }
-    }
-
-    fdGetUpdateInfo(body, control, system, update, fnUpdate);
-
     /* Halt? */
-    if (fbCheckHalt(body, control, update, fnUpdate)) {
-      fdGetUpdateInfo(body, control, system, update, fnUpdate);
-      WriteOutput(body, control, files, output, system, update, fnWrite,
-                  control->Evolve.dTime,
-                  control->Io.dOutputTime / control->Evolve.nSteps);
+    if (fbEndStepHalts(body, control, module, system, update, fnUpdate,
+                       dDt)) {
+      WriteHaltOutput(body, control, files, output, system, update, fnUpdate,
+                      fnWrite);
       return;
     }
 
-    for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
-      body[iBody].dAge += iDir * dDt;
-    }
-
-    control->Evolve.dTime += dDt;
-    nSteps++;
-
     /* Time for Output? */
-    if (control->Evolve.dTime >= control->Io.dNextOutput) {
-      control->Evolve.nSteps += nSteps;
-      WriteOutput(body, control, files, output, system, update, fnWrite,
-                  control->Evolve.dTime,
-                  control->Io.dOutputTime / control->Evolve.nSteps);
-      // Timesteps are synchronized with the output time, so this statement is
-      // sufficient
-      control->Io.dNextOutput += control->Io.dOutputTime;
-      nSteps = 0;
-    }
-
-    /* Get auxiliary properties for next step -- first call
-       was prior to loop. */
-    PropertiesAuxiliary(body, control, system, update);
-
-    // If control->Evolve.bFirstStep hasn't been switched off by now, do so.
-    if (control->Evolve.bFirstStep) {
-      control->Evolve.bFirstStep = 0;
+    if (fbAdvanceTime(body, control, dDt, iDir, &nSteps)) {
+      WriteEvolveOutput(body, control, files, output, system, update,
+                        fnUpdate, fnWrite, &dDt, iDir, &nSteps);
     }
 
-    // Any variables reached an interesting value?
-    CheckProgress(body, control, system, update);
+    PrepareNextStep(body, control, system, update);
   }
 
   if (control->Io.iVerbose >= VERBPROG) {
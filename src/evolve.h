@@ -13,24 +13,103 @@
 /* 0 => Not input by user, verify assigns default */
 #define EULER 1
 #define RUNGEKUTTA 2
+#define RK45 3
+#define ROSENBROCK 4
+
+/* Number of derivative stages stored in EVOLVE. RK4 uses the first 4, the
+   Dormand-Prince RK45 scheme uses all 7. */
+#define NUMSTAGES 7
+
+/* Step size controller limits for RK45 */
+#define RK45SAFETY 0.9
+#define RK45MINSCALE 0.2
+#define RK45MAXSCALE 5.0
+
+/* Step size controller and Jacobian reuse for the Rosenbrock method */
+#define ROSENSAFETY 0.9
+#define ROSENGROW 1.5
+#define ROSENSHRINK 0.5
+#define ROSENERRCON 0.1296 /* (ROSENGROW/ROSENSAFETY)^(-4) */
+#define ROSENMAXJACAGE 10  /* Accepted steps before the Jacobian is rebuilt */
+#define ROSENLUREUSE 1.2   /* Keep the LU if the new step is within this factor */
+#define ROSENMINSTEP (100 * DBL_EPSILON) /* Smallest step relative to age */
 
 /* @cond DOXYGEN_OVERRIDE */
 
 void PropertiesAuxiliary(BODY *, CONTROL *, SYSTEM *, UPDATE *);
+int fbTimeStepSkipsDerivative(CONTROL *, UPDATE *, int, int, int);
+void EvaluateDerivativesParallel(BODY *, CONTROL *, SYSTEM *, UPDATE *,
+                                 fnUpdateVariable ***, int);
+void EvaluateDerivatives(BODY *, CONTROL *, SYSTEM *, UPDATE *,
+                         fnUpdateVariable ***, int);
+int fbOwnBodyEquation(UPDATE *, int, int, int);
+void InitializeDerivativeTasks(CONTROL *, UPDATE *);
 void fdGetUpdateInfo(BODY *, CONTROL *, SYSTEM *, UPDATE *,
                      fnUpdateVariable ***);
 double fdGetTimeStep(BODY *, CONTROL *, SYSTEM *, UPDATE *,
                      fnUpdateVariable ***);
+double fdTimeStepOfDerivatives(BODY *, CONTROL *, UPDATE *);
+void GetCurrentDerivatives(BODY *, CONTROL *, SYSTEM *, UPDATE *,
+                           fnUpdateVariable ***);
+int fbAuxUsesDerivatives(BODY *, CONTROL *);
 void CalculateDerivatives(BODY *, SYSTEM *, UPDATE *, fnUpdateVariable ***,
                           int);
 
+void DenseOutputState(CONTROL *, double, double);
+void RungeKutta4EndDerivatives(CONTROL *, SYSTEM *, UPDATE *,
+                               fnUpdateVariable ***, int);
+void WriteDenseOutput(BODY *, CONTROL *, FILES *, OUTPUT *, SYSTEM *, UPDATE *,
+                      fnUpdateVariable ***, fnWriteOutput *, double, int);
+
+int fiBeginEvolve(BODY *, CONTROL *, FILES *, OUTPUT *, SYSTEM *, UPDATE *,
+                  fnUpdateVariable ***, fnWriteOutput *, double *);
+int fbEndStepHalts(BODY *, CONTROL *, MODULE *, SYSTEM *, UPDATE *,
+                   fnUpdateVariable ***, double);
+void WriteHaltOutput(BODY *, CONTROL *, FILES *, OUTPUT *, SYSTEM *, UPDATE *,
+                     fnUpdateVariable ***, fnWriteOutput *);
+int fbAdvanceTime(BODY *, CONTROL *, double, int, int *);
+void WriteEvolveOutput(BODY *, CONTROL *, FILES *, OUTPUT *, SYSTEM *,
+                       UPDATE *, fnUpdateVariable ***, fnWriteOutput *,
+                       double *, int, int *);
+void PrepareNextStep(BODY *, CONTROL *, SYSTEM *, UPDATE *);
 void Evolve(BODY *, CONTROL *, FILES *, MODULE *, OUTPUT *, SYSTEM *, UPDATE *,
             fnUpdateVariable ***, fnWriteOutput *, fnIntegrate);
 
 void EulerStep(BODY *, CONTROL *, SYSTEM *, UPDATE *, fnUpdateVariable ***,
                double *, int);
 
+double AssignDt(double, double, double);
+double fdTimeToStepLimit(CONTROL *);
+
+void InitializeStateVector(CONTROL *, UPDATE *);
+void GatherState(EVOLVE *, double **, double *);
+void ScatterState(EVOLVE *, double **, double *);
+void StoreStageDerivatives(CONTROL *, int, int, int);
+
+void RungeKutta4Stage(BODY *, CONTROL *, SYSTEM *, UPDATE *,
+                      fnUpdateVariable ***, double, double, int, int);
 void RungeKutta4Step(BODY *, CONTROL *, SYSTEM *, UPDATE *,
                      fnUpdateVariable ***, double *, int);
 
+int fbExplicitVariable(UPDATE *, int, int);
+void InitializeRungeKutta45(CONTROL *, UPDATE *, fnUpdateVariable ***);
+void SaveFSALState(CONTROL *, UPDATE *, fnUpdateVariable ***);
+int fbFSALValid(CONTROL *, UPDATE *, fnUpdateVariable ***);
+void RungeKutta45Stage(BODY *, CONTROL *, SYSTEM *, UPDATE *,
+                       fnUpdateVariable ***, double, int, int);
+double fdRK45ErrorScale(BODY *, UPDATE *, int, int);
+double fdRK45Error(BODY *, CONTROL *, UPDATE *, double);
+double fdRK45StepScale(double);
+void RungeKutta45Step(BODY *, CONTROL *, SYSTEM *, UPDATE *,
+                      fnUpdateVariable ***, double *, int);
+
+void InitializeRosenbrock(CONTROL *, UPDATE *);
+void RosenbrockDerivatives(BODY *, CONTROL *, SYSTEM *, UPDATE *,
+                           fnUpdateVariable ***, double *, double, int, int,
+                           double *);
+void RosenbrockJacobian(BODY *, CONTROL *, SYSTEM *, UPDATE *,
+                        fnUpdateVariable ***, int);
+void RosenbrockStep(BODY *, CONTROL *, SYSTEM *, UPDATE *,
+                    fnUpdateVariable ***, double *, int);
+
 /* @endcond */
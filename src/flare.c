@@ -966,11 +966,17 @@ void fnForceBehaviorFlare(BODY *body,
                           fnUpdateVariable ***fnUpdate,
                           int iBody,
                           int iModule) {
+  double dLXUVFlare = body[iBody].dLXUVFlare;
 
   if (body[iBody].dLXUVFlare < 0)
     body[iBody].dLXUVFlare = 0;
   else
     body[iBody].dLXUVFlare = fdLXUVFlare(body, evolve->dTimeStep, iBody);
+
+  // Escape rates read the flare luminosity
+  if (body[iBody].dLXUVFlare != dLXUVFlare) {
+    evolve->bFSAL = 0;
+  }
 }
 
 
@@ -978,15 +984,18 @@ void InitializeBodyFlare(BODY *body, CONTROL *control, UPDATE *update,
                          int iBody, int iModule) {
   // double *daEnergyERGXUV, *daLXUVFlare, *daFFD, *daEnergyJOUXUV, *daLogEner;
   // double *daLogEnerXUV, *daEnergyERG, *daEnergyJOU, *daEnerJOU;
-  body[iBody].daEnergyERGXUV = malloc(body[iBody].dEnergyBin * sizeof(double));
-  body[iBody].daLXUVFlare    = malloc(body[iBody].dEnergyBin * sizeof(double));
-  body[iBody].daFFD          = malloc(body[iBody].dEnergyBin * sizeof(double));
-  body[iBody].daEnergyJOUXUV = malloc(body[iBody].dEnergyBin * sizeof(double));
-  body[iBody].daLogEner      = malloc(body[iBody].dEnergyBin * sizeof(double));
-  body[iBody].daLogEnerXUV   = malloc(body[iBody].dEnergyBin * sizeof(double));
-  body[iBody].daEnergyERG    = malloc(body[iBody].dEnergyBin * sizeof(double));
-  body[iBody].daEnergyJOU    = malloc(body[iBody].dEnergyBin * sizeof(double));
-  body[iBody].daEnerJOU      = malloc(body[iBody].dEnergyBin * sizeof(double));
+  // fdLXUVFlare fills dEnergyBin + 1 energies
+  int iNumBins = (int)body[iBody].dEnergyBin + 1;
+
+  body[iBody].daEnergyERGXUV = malloc(iNumBins * sizeof(double));
+  body[iBody].daLXUVFlare    = malloc(iNumBins * sizeof(double));
+  body[iBody].daFFD          = malloc(iNumBins * sizeof(double));
+  body[iBody].daEnergyJOUXUV = malloc(iNumBins * sizeof(double));
+  body[iBody].daLogEner      = malloc(iNumBins * sizeof(double));
+  body[iBody].daLogEnerXUV   = malloc(iNumBins * sizeof(double));
+  body[iBody].daEnergyERG    = malloc(iNumBins * sizeof(double));
+  body[iBody].daEnergyJOU    = malloc(iNumBins * sizeof(double));
+  body[iBody].daEnerJOU      = malloc(iNumBins * sizeof(double));
 
   body[iBody].dLXUVFlare = fdLXUVFlare(body, control->Evolve.dTimeStep, iBody);
 }
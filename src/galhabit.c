@@ -19,6 +19,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Number of rand() calls since the generator was seeded, so a restarted run
+   can bring the generator back to the same point */
+static long iRandomCalls = 0;
+
 void BodyCopyGalHabit(BODY *dest, BODY *src, int iTideModel, int iNumBodies,
                       int iBody) {
   dest[iBody].dPeriQ        = src[iBody].dPeriQ;
@@ -960,7 +964,7 @@ void VerifyTidesBinary(BODY *body, CONTROL *control, OPTIONS *options,
               options[OPT_GALACTIDES].cName, options[OPT_HOSTBINARY].cName,
               cFile);
     }
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
   if (body[iBody].bHostBinary) {
     if (control->Evolve.iNumBodies != 3) {
@@ -970,7 +974,7 @@ void VerifyTidesBinary(BODY *body, CONTROL *control, OPTIONS *options,
               "ERROR: %s can only be used with exactly 3 bodies in GalHabit\n",
               options[OPT_HOSTBINARY].cName);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
     if (body[1].bHostBinary == 1 && body[2].bHostBinary == 0) {
       if (iVerbose >= VERBERR) {
@@ -979,7 +983,7 @@ void VerifyTidesBinary(BODY *body, CONTROL *control, OPTIONS *options,
                 "GalHabit\n",
                 options[OPT_HOSTBINARY].cName);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     } else if (body[1].bHostBinary == 0 && body[2].bHostBinary == 1) {
       if (iVerbose >= VERBERR) {
         fprintf(stderr,
@@ -987,7 +991,7 @@ void VerifyTidesBinary(BODY *body, CONTROL *control, OPTIONS *options,
                 "GalHabit\n",
                 options[OPT_HOSTBINARY].cName);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
   }
   if (body[iBody].bGalacTides) {
@@ -1080,6 +1084,7 @@ void VerifyGalHabit(BODY *body, CONTROL *control, FILES *files,
   FILE *fOut;
 
   srand(system->iSeed);
+  iRandomCalls = 0;
 
   VerifyTidesBinary(body, control, options, files->Infile[iBody + 1].cIn, iBody,
                     control->Io.iVerbose);
@@ -1816,6 +1821,45 @@ void LogBodyGalHabit(BODY *body, CONTROL *control, OUTPUT *output,
   }
 }
 
+/************ GALHABIT Checkpoint Functions **************/
+
+/**
+Write or read the encounter geometry and the state of the random number
+generator. The generator cannot be saved directly, so on reading it is seeded
+again and advanced by the number of draws made before the checkpoint.
+
+@param body Body struct
+@param system System struct
+@param iBody Index of body
+@param fp Checkpoint file
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointGalHabit(BODY *body, SYSTEM *system, int iBody, FILE *fp,
+                        int bWrite) {
+  long iCall;
+
+  CheckpointData(fp, body[iBody].daRelativeImpact, sizeof(double), 3, bWrite);
+  CheckpointData(fp, body[iBody].daRelativeVel, sizeof(double), 3, bWrite);
+
+  // The system members are allocated with the first orbiting body
+  if (iBody == 1) {
+    CheckpointData(fp, system->daPassingStarR, sizeof(double), 3, bWrite);
+    CheckpointData(fp, system->daPassingStarV, sizeof(double), 3, bWrite);
+    CheckpointData(fp, system->daPassingStarImpact, sizeof(double), 3, bWrite);
+    CheckpointData(fp, system->daHostApexVel, sizeof(double), 3, bWrite);
+    CheckpointData(fp, system->daRelativeVel, sizeof(double), 3, bWrite);
+    CheckpointData(fp, system->daRelativePos, sizeof(double), 3, bWrite);
+
+    CheckpointData(fp, &iRandomCalls, sizeof(long), 1, bWrite);
+    if (!bWrite) {
+      srand(system->iSeed);
+      for (iCall = 0; iCall < iRandomCalls; iCall++) {
+        rand();
+      }
+    }
+  }
+}
+
 /************* MODULE Functions ***********/
 
 void AddModuleGalHabit(CONTROL *control, MODULE *module, int iBody,
@@ -1912,6 +1956,9 @@ void ForceBehaviorGalHabit(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
   int idr;
   FILE *fOut;
 
+  // The osculating elements and the galactic scalings change every step
+  evolve->bFSAL = 0;
+
   dCurrentAge = system->dGalaxyAge - evolve->dStopTime + evolve->dTime;
   if (system->bTimeEvolVelDisp) {
     system->dScalingFVelDisp *=
@@ -2291,11 +2338,13 @@ double fndRandom_double() {
   double n;
 
   n = (double)rand() / RAND_MAX;
+  iRandomCalls++;
   return n;
 }
 
 int fniRandom_int(int n) {
   if ((n - 1) == RAND_MAX) {
+    iRandomCalls++;
     return rand();
   } else {
     // Chop off all of the values that would cause skew...
@@ -2308,8 +2357,9 @@ int fniRandom_int(int n) {
     // so we can expect to bail out of this loop pretty quickly.)
     int r;
     while ((r = rand()) >= end) {
-      ;
+      iRandomCalls++;
     }
+    iRandomCalls++;
 
     return r % n;
   }
@@ -2414,7 +2464,7 @@ double fndMag2mass(double dMagV) {
     dlogMass = log10(4.0); // giants
   } else {
     fprintf(stderr, "ERROR: Unknown object in galhabit.c:fndMag2mass.\n");
-    exit(EXIT_INT);
+    VplanetExit(EXIT_INT);
   }
 
   return pow(10.0, dlogMass);
@@ -2511,7 +2561,7 @@ void VelocityDisp(SYSTEM *system) {
     dSigma = 41.0; // giants
   } else {
     fprintf(stderr, "ERROR: Unknown object in galhabit.c:VelocityDisp.\n");
-    exit(EXIT_INT);
+    VplanetExit(EXIT_INT);
   }
 
   system->dPassingStarSigma = system->dScalingFVelDisp * dSigma;
@@ -2550,7 +2600,7 @@ void VelocityApex(SYSTEM *system) {
     dVel = 21.0; // giants
   } else {
     fprintf(stderr, "ERROR: Unknown object in galhabit.c:VelocityApex.\n");
-    exit(EXIT_INT);
+    VplanetExit(EXIT_INT);
   }
 
   dVel *= 1000.0;
@@ -2627,7 +2677,7 @@ double fndNearbyStarDist(double dMagV) {
     dNs = 0.43; // giants
   } else {
     fprintf(stderr, "ERROR: Unknown object in galhabit.c:fndNearbyStarDist.\n");
-    exit(EXIT_INT);
+    VplanetExit(EXIT_INT);
   }
 
 
@@ -2666,7 +2716,7 @@ double fndNearbyStarFrEnc(SYSTEM *system, double dMagV) {
   } else {
     fprintf(stderr,
             "ERROR: Unknown object in galhabit.c:fndNearbyStarFrEnc.\n");
-    exit(EXIT_INT);
+    VplanetExit(EXIT_INT);
   }
 
   return dFs;
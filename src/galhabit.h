@@ -129,6 +129,7 @@ void PropsAuxGalHabit(BODY *, EVOLVE *, IO *, UPDATE *, int);
 void ForceBehaviorGalHabit(BODY *, MODULE *, EVOLVE *, IO *, SYSTEM *, UPDATE *,
                            fnUpdateVariable ***, int, int);
 double fndRandom_double();
+void CheckpointGalHabit(BODY *, SYSTEM *, int, FILE *, int);
 void testrand(SYSTEM *);
 double fndNearbyStarDist(double);
 int fniCheck_disrupt(BODY *, SYSTEM *, int);
@@ -187,6 +187,7 @@ int HaltMerge(BODY *body, EVOLVE *evolve, HALT *halt, IO *io, UPDATE *update,
                body[iBody].cName, evolve->dTime / YEARSEC);
       }
       fdMergePlanet(body, update, fnUpdate, iBody);
+      evolve->bFSAL = 0;
     }
   }
 
@@ -206,6 +207,7 @@ int HaltMerge(BODY *body, EVOLVE *evolve, HALT *halt, IO *io, UPDATE *update,
                  body[iBody].cName, evolve->dTime / YEARSEC);
         }
         fdMergePlanet(body, update, fnUpdate, iBody);
+        evolve->bFSAL = 0;
       }
     }
 
@@ -282,7 +284,7 @@ void VerifyHalts(BODY *body, CONTROL *control, MODULE *module,
               "maximum value for the eccentricity of all non-primary body will "
               "be MAXECCDISTORB\n.",
               options[OPT_HALTMAXECC].cName, iNumMaxEcc);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
 
     // Now add 1 to each iNumHalts
@@ -298,7 +300,7 @@ void VerifyHalts(BODY *body, CONTROL *control, MODULE *module,
       fprintf(stderr,
               "ERROR: %s set, but only 1 body present.\n",
               options[OPT_HALTMAXMUTUALINC].cName);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
   }
 
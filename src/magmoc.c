@@ -1579,11 +1579,14 @@ void fnForceBehaviorMagmOc(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
                            SYSTEM *system, UPDATE *update,
                            fnUpdateVariable ***fnUpdate, int iBody,
                            int iModule) {
+  /* Each change below alters the derivatives, so the last RK45 stage of the
+     step cannot be reused */
 
   /* Mantle starts to solidify */
   if (!body[iBody].bManStartSol &&
       (body[iBody].dSolidRadius - body[iBody].dCoreRadius) > 1e-5) {
     body[iBody].bManStartSol = 1;
+    evolve->bFSAL            = 0;
     if (io->iVerbose >= VERBPROG) {
       printf("%s's mantle starts to solidify after %f years. \n",
              body[iBody].cName, evolve->dTime / YEARSEC);
@@ -1597,6 +1600,7 @@ void fnForceBehaviorMagmOc(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
     body[iBody].dPrefactorA  = ALOWPRESSURE;
     body[iBody].dPrefactorB  = BLOWPRESSURE;
     body[iBody].bLowPressSol = 1;
+    evolve->bFSAL            = 0;
     if (io->iVerbose >= VERBPROG) {
       printf("%s: Switch to low-pressure treatment of solidus after %f years. "
              "\n",
@@ -1609,6 +1613,7 @@ void fnForceBehaviorMagmOc(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
       (body[iBody].dFracFe2O3Man >=
        (body[iBody].dMassFracFeOIni * MOLWEIGHTFEO15 / MOLWEIGHTFEO - 1e-14))) {
     body[iBody].bAllFeOOxid = 1;
+    evolve->bFSAL           = 0;
     if (io->iVerbose >= VERBPROG) {
       printf("%s: All FeO in magma ocean oxidized to Fe2O3 after %f years. \n",
              body[iBody].cName, evolve->dTime / YEARSEC);
@@ -1619,6 +1624,7 @@ void fnForceBehaviorMagmOc(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
   if ((!body[iBody].bManSolid) &&
       (body[iBody].dSolidRadius >= (0.9999 * body[iBody].dRadius))) {
     body[iBody].bManSolid = 1;
+    evolve->bFSAL         = 0;
     // body[iBody].dManMeltDensity = 4200;
     body[iBody].dSolidRadius = body[iBody].dRadius;
     /*
@@ -1652,6 +1658,7 @@ void fnForceBehaviorMagmOc(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
   if ((!body[iBody].bPlanetDesiccated) &&
       (body[iBody].dPressWaterAtm <= PRESSWATERMIN)) {
     body[iBody].bPlanetDesiccated = 1;
+    evolve->bFSAL                 = 0;
     body[iBody].dWaterMassEsc     = 0;
     body[iBody].dOxygenMassEsc    = 0;
     SetDerivTiny(fnUpdate, iBody, update[iBody].iWaterMassMOAtm,
@@ -1675,6 +1682,7 @@ void fnForceBehaviorMagmOc(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
     double dDeltaCO2Mass;
 
     body[iBody].bManQuasiSol = 1;
+    evolve->bFSAL            = 0;
 
     // body[iBody].dManMeltDensity = 4200;
     body[iBody].dSolidRadius = body[iBody].dRadius;
@@ -1747,6 +1755,7 @@ void fnForceBehaviorMagmOc(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
   } else if ((!body[iBody].bOptManQuasiSol) && (!body[iBody].bManQuasiSol) &&
              (body[iBody].dMeltFracSurf < CRITMELTFRAC)) {
     body[iBody].bManQuasiSol = 1;
+    evolve->bFSAL            = 0;
     if (io->iVerbose >= VERBPROG) {
       printf("Surface melt fraction of %s's smaller than 0.4 after %f years \n",
              body[iBody].cName, evolve->dTime / YEARSEC);
@@ -1761,6 +1770,7 @@ void fnForceBehaviorMagmOc(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
     SetDerivTiny(fnUpdate, iBody, update[iBody].iHydrogenMassSpace,
                  update[iBody].iHydrogenMassSpaceMagmOc);
     body[iBody].bEscapeStop = 1;
+    evolve->bFSAL           = 0;
     if (io->iVerbose >= VERBPROG) {
       printf("%s enters habitable zone after %f years. \n", body[iBody].cName,
              evolve->dTime / YEARSEC);
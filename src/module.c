@@ -946,7 +946,7 @@ void VerifyModuleMultiDistOrbDistRot(BODY *body, UPDATE *update,
                 "ERROR: Module DISTROT selected for %s, but DISTORB not "
                 "selected and bReadOrbitData = 0.\n",
                 body[iBody].cName);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
     } else {
       if (body[iBody].bReadOrbitData) {
@@ -954,7 +954,7 @@ void VerifyModuleMultiDistOrbDistRot(BODY *body, UPDATE *update,
                 "ERROR: Cannot set both DISTORB and bReadOrbitData for body "
                 "%s.\n",
                 body[iBody].cName);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
     }
   }
@@ -969,7 +969,7 @@ void VerifyModuleMultiEqtideDistRot(BODY *body, UPDATE *update,
       fprintf(stderr,
               "ERROR: Cannot set both EQTIDE and bReadOrbitData for body %s.\n",
               body[iBody].cName);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
 
     control->fnPropsAuxMulti[iBody][(*iModuleProps)++] = &PropsAuxEqtideDistRot;
@@ -1082,7 +1082,7 @@ void VerifyModuleMultiEqtideStellar(BODY *body, UPDATE *update,
                   "and 1 for a binary system!\n",
                   iBody);
         }
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
 
       // If you're using stellar and eqtide and this isn't the primary body, it
@@ -1092,7 +1092,7 @@ void VerifyModuleMultiEqtideStellar(BODY *body, UPDATE *update,
           fprintf(stderr, "ERROR: If both stellar AND eqtide are set and iBody "
                           "> 0, MUST set iBodyType == 1 for stars\n");
         }
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
 
       // Can't have any ocean, envelope tidal parameters set
@@ -1111,28 +1111,28 @@ void VerifyModuleMultiEqtideStellar(BODY *body, UPDATE *update,
           fprintf(stderr, "ERROR: %s set, but this body is a star!.\n",
                   options[OPT_TIDALQOCEAN].cName);
         }
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
       if (options[OPT_K2OCEAN].iLine[iBody + 1] > -1) {
         if (control->Io.iVerbose >= VERBINPUT) {
           fprintf(stderr, "ERROR: %s set, but this body is a star!.\n",
                   options[OPT_K2OCEAN].cName);
         }
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
       if (options[OPT_TIDALQENV].iLine[iBody + 1] > -1) {
         if (control->Io.iVerbose >= VERBINPUT) {
           fprintf(stderr, "ERROR: %s set, but this body is a star!.\n",
                   options[OPT_TIDALQENV].cName);
         }
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
       if (options[OPT_K2ENV].iLine[iBody + 1] > -1) {
         if (control->Io.iVerbose >= VERBINPUT) {
           fprintf(stderr, "ERROR: %s set, but this body is a star!.\n",
                   options[OPT_K2ENV].cName);
         }
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
 
       // ALl the options are ok! Add in the necessary AuxProps
@@ -1206,19 +1206,19 @@ void VerifyModuleMultiAtmescEqtide(BODY *body, UPDATE *update, CONTROL *control,
         if (!(options[OPT_TIDALQENV].iLine[iBody + 1] > -1)) {
           fprintf(stderr, "ERROR: if bEnvTides == 1, must specify %s.\n",
                   options[OPT_TIDALQENV].cName);
-          exit(EXIT_INPUT);
+          VplanetExit(EXIT_INPUT);
         }
         // k2env not set
         else if (!(options[OPT_K2ENV].iLine[iBody + 1] > -1)) {
           fprintf(stderr, "ERROR: if bEnvTides == 1, must specify %s.\n",
                   options[OPT_K2ENV].cName);
-          exit(EXIT_INPUT);
+          VplanetExit(EXIT_INPUT);
         }
         // envmass not set
         else if (!(options[OPT_ENVELOPEMASS].iLine[iBody + 1] > -1)) {
           fprintf(stderr, "ERROR: if bEnvTides == 1, must specify %s.\n",
                   options[OPT_ENVELOPEMASS].cName);
-          exit(EXIT_INPUT);
+          VplanetExit(EXIT_INPUT);
         }
       }
 
@@ -1229,16 +1229,16 @@ void VerifyModuleMultiAtmescEqtide(BODY *body, UPDATE *update, CONTROL *control,
           fprintf(stderr, "ERROR: if %s == 1, must specify %s.\n",
                   options[OPT_OCEANTIDES].cName,
                   options[OPT_TIDALQOCEAN].cName);
-          exit(EXIT_INPUT);
+          VplanetExit(EXIT_INPUT);
         } else if (options[OPT_SURFACEWATERMASS].iLine[iBody + 1] == -1) {
           fprintf(stderr, "ERROR: if %s == 1, must specify %s.\n",
                   options[OPT_OCEANTIDES].cName,
                   options[OPT_SURFACEWATERMASS].cName);
-          exit(EXIT_INPUT);
+          VplanetExit(EXIT_INPUT);
         } else if (options[OPT_K2OCEAN].iLine[iBody + 1] == -1) {
           fprintf(stderr, "ERROR: if %s == 1, must specify %s.\n",
                   options[OPT_OCEANTIDES].cName, options[OPT_K2OCEAN].cName);
-          exit(EXIT_INPUT);
+          VplanetExit(EXIT_INPUT);
         }
       }
       // now lets check there's actually an envelope
@@ -1324,7 +1324,7 @@ body[iBody].dTidalQOcean;
               (options[OPT_TIDALRADIUS].iLine[iBody + 1] > -1))) {
           fprintf(stderr, "ERROR: if bTidalRadius == 1, must set %s.\n",
                   options[OPT_TIDALRADIUS].cName);
-          exit(EXIT_INPUT);
+          VplanetExit(EXIT_INPUT);
         }
       }
 
@@ -1341,7 +1341,7 @@ body[iBody].dTidalQOcean;
                   "not set!\n",
                   options[OPT_RADIUS].cName,
                   options[OPT_PLANETRADIUSMODEL].cName);
-          exit(EXIT_INPUT);
+          VplanetExit(EXIT_INPUT);
         }
 
         // If dTidalRadius set, warn user since it's not considered
@@ -1379,7 +1379,7 @@ body[iBody].dTidalQOcean;
           !(options[OPT_MASSRAD].iLine[iBody + 1] > -1)) {
         fprintf(stderr, "ERROR: Using EQTIDE but neither %s or %s is set!\n",
                 options[OPT_RADIUS].cName, options[OPT_MASSRAD].cName);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
 
       // If dTidalRadius or bUseTidalRadius set, ignore and warn user as they do
@@ -1427,7 +1427,7 @@ void VerifyModuleMultiAtmescEqtideThermint(BODY *body, UPDATE *update,
                       options[OPT_TIDALQENV].cName, options[OPT_K2ENV].cName);
               fprintf(stderr, "Must both be set when using EQTIDE, THERMINT "
                               "and ATMESC with bEnvTides == True.\n");
-              exit(EXIT_INPUT);
+              VplanetExit(EXIT_INPUT);
             }
 
             // Otherwise, we're good! set ImK2 for the envelope component
@@ -1441,7 +1441,7 @@ void VerifyModuleMultiAtmescEqtideThermint(BODY *body, UPDATE *update,
               if (control->Io.iVerbose >= VERBINPUT) {
                 fprintf(stderr, "ERROR: %s or %s set, but bEnvTides == 0.\n",
                         options[OPT_TIDALQENV].cName, options[OPT_K2ENV].cName);
-                exit(EXIT_INPUT);
+                VplanetExit(EXIT_INPUT);
               }
             }
 
@@ -1471,7 +1471,7 @@ void VerifyModuleMultiAtmescEqtideThermint(BODY *body, UPDATE *update,
             if (control->Io.iVerbose >= VERBINPUT) {
               fprintf(stderr, "ERROR: %s or %s set, but bOceanTides == 0.\n",
                       options[OPT_TIDALQENV].cName, options[OPT_K2ENV].cName);
-              exit(EXIT_INPUT);
+              VplanetExit(EXIT_INPUT);
             }
           }
 
@@ -2002,6 +2002,11 @@ void ForceBehaviorSpiNBodyDistOrb(BODY *body, MODULE *module, EVOLVE *evolve,
     }
   }
 
+  if (evolve->bUsingDistOrb != bOldUsingDistOrb ||
+      evolve->bUsingSpiNBody != bOldUsingSpiNBody) {
+    evolve->bFSAL = 0;
+  }
+
   if (evolve->bUsingDistOrb && !(bOldUsingDistOrb)) {
     // If using DistOrb now, but not earlier, then change derivatives to use
     // DistOrb
@@ -2109,6 +2114,7 @@ void ForceBehaviorSpiNBodyAtmEsc(BODY *body, MODULE *module, EVOLVE *evolve,
 
   // Need to get orbital elements for AtmEsc to use for escape
   Bary2OrbElems(body, iBody);
+  evolve->bFSAL = 0;
 }
 
 void ForceBehaviorEqtideDistOrb(BODY *body, MODULE *module, EVOLVE *evolve,
@@ -2138,6 +2144,7 @@ void ForceBehaviorEqtideAtmesc(BODY *body, MODULE *module, EVOLVE *evolve,
     body[iBody].dImK2Env = 0;
     // Adjust Im(k_2)
     body[iBody].dImK2 = fdImK2Total(body, iBody);
+    evolve->bFSAL     = 0;
   }
 
   // We think there's an ocean, but there isn't!!
@@ -2151,6 +2158,7 @@ void ForceBehaviorEqtideAtmesc(BODY *body, MODULE *module, EVOLVE *evolve,
     body[iBody].dImK2Ocean = 0;
     // Adjust Im(k_2)
     body[iBody].dImK2 = fdImK2Total(body, iBody);
+    evolve->bFSAL     = 0;
   }
 
   /* Old way, in which Q is set by top layer. need a switch for this.
@@ -2212,6 +2220,7 @@ void ForceBehaviorAtmescEqtideThermint(BODY *body, MODULE *module,
   // -dHUGE
   int bOceans = 0;
   int bEnv    = 0;
+  int bOldOcean, bOldEnv;
 
   for (iBody = 1; iBody < evolve->iNumBodies; iBody++) {
     // If body 1 is a star (iBodyType==1), pass
@@ -2219,6 +2228,9 @@ void ForceBehaviorAtmescEqtideThermint(BODY *body, MODULE *module,
       continue;
     }
 
+    bOldOcean = body[iBody].bOcean;
+    bOldEnv   = body[iBody].bEnv;
+
     // Ocean check
     if (body[iBody].dTidalQOcean < 0) {
       bOceans = 0;
@@ -2282,6 +2294,11 @@ void ForceBehaviorAtmescEqtideThermint(BODY *body, MODULE *module,
         (body[iBody].dEnvelopeMass > body[iBody].dMinEnvelopeMass)) {
       body[iBody].bOcean = 0;
     }
+
+    // The tidal derivatives read which layers respond
+    if (body[iBody].bOcean != bOldOcean || body[iBody].bEnv != bOldEnv) {
+      evolve->bFSAL = 0;
+    }
   }
 }
 
@@ -14,22 +14,75 @@
  *
  */
 
-/* Is the current input file the primary, i.e. the one on the command
-   line */
+/* Input files can also be given as text in memory, e.g. by the Python
+   module, so that a run needs no input files on disk. Every input file is
+   opened by fpOpenInput, which prefers the text registered under its name. */
 
-void NotPrimaryInput(int iFile, char cName[], char cFile[], int iLine,
-                     int iVerbose) {
-  if (iLine > 0 && iFile == 0) {
-    if (iVerbose >= VERBINPUT) {
-      fprintf(stderr, "ERROR: %s is not allowed in file %s.\n", cName, cFile);
-    }
-    LineExit(cFile, iLine);
+static char **saInputName = NULL;
+static char **saInputText = NULL;
+static int iNumInputTexts = 0;
+
+/**
+Register the contents of an input file, to be used instead of the file with
+that name. The text is copied.
+
+@param cFile Name of the input file, as it appears in saBodyFiles or on the
+  command line
+@param cText Contents of the file
+*/
+void AddInputText(char cFile[], char cText[]) {
+  saInputName = realloc(saInputName, (iNumInputTexts + 1) * sizeof(char *));
+  saInputText = realloc(saInputText, (iNumInputTexts + 1) * sizeof(char *));
+  saInputName[iNumInputTexts] = malloc(strlen(cFile) + 1);
+  saInputText[iNumInputTexts] = malloc(strlen(cText) + 1);
+  strcpy(saInputName[iNumInputTexts], cFile);
+  strcpy(saInputText[iNumInputTexts], cText);
+  iNumInputTexts++;
+}
+
+/**
+Forget all of the texts registered by AddInputText.
+*/
+void FreeInputTexts(void) {
+  int iText;
+
+  for (iText = 0; iText < iNumInputTexts; iText++) {
+    free(saInputName[iText]);
+    free(saInputText[iText]);
   }
+  free(saInputName);
+  free(saInputText);
+  saInputName    = NULL;
+  saInputText    = NULL;
+  iNumInputTexts = 0;
 }
 
-/* Returns the line with the desiried options AND asserts no duplicate
-   entries. cLine is the entire text of the line, iLine is the line
-   number. */
+/**
+Open an input file for reading, from its registered text if it has one.
+
+@param cFile Name of the input file
+@return The open file, or NULL if it cannot be opened
+*/
+FILE *fpOpenInput(char cFile[]) {
+  int iText;
+
+  for (iText = iNumInputTexts - 1; iText >= 0; iText--) {
+    if (strcmp(saInputName[iText], cFile) == 0) {
+#ifndef VPLANET_ON_WINDOWS
+      // A stream of zero bytes cannot be opened
+      if (saInputText[iText][0] == '\0') {
+        return fmemopen((char *)"\n", 1, "r");
+      }
+      return fmemopen(saInputText[iText], strlen(saInputText[iText]), "r");
+#else
+      fprintf(stderr, "ERROR: Input text is not supported on Windows.\n");
+      VplanetExit(EXIT_INPUT);
+      return NULL;
+#endif
+    }
+  }
+  return fopen(cFile, "r");
+}
 
 /* Is the first non-white space a #? I so, return 1 */
 int CheckComment(char cLine[], int iLen) {
@@ -48,88 +101,302 @@ int CheckComment(char cLine[], int iLen) {
   return 0;
 }
 
-void GetLine(char cFile[], char cOption[], char cLine[], int *iLine,
-             int iVerbose) {
-  int iLen, bDone = 0, iLineTmp = 0;
-  char cWord[OPTLEN], cTmp[LINE];
-  FILE *fp;
+/* Each input file is read once, into a table of its lines, the first time an
+   option is looked up in it. The lines that are not comments are indexed by
+   their first word, i.e. the option name, so a lookup only compares the
+   lines that could hold the option. The lines are exactly what fgets read, so
+   line numbers and line contents are the same as when the file was scanned
+   for each option. */
+
+#define INPUTHASHSIZE 256
+
+typedef struct {
+  char *cFile;
+  int iNumLines;
+  int iMaxLines;
+  char **saLine;
+  char **saWord;                /* First word, NULL for a comment or blank */
+  int *iaNext;                  /* Next line in the same bucket */
+  int iaBucket[INPUTHASHSIZE];  /* First line in each bucket */
+  int bIndexed;                 /* Are the buckets up to date? */
+} INPUTTABLE;
+
+static INPUTTABLE *tables = NULL;
+static int iNumTables     = 0;
 
-  iLen = strlen(cOption);
+/**
+Hash an option name into a bucket of an input table.
 
-  fp = fopen(cFile, "r");
-  memset(cLine, '\0', LINE);
-  memset(cTmp, '\0', LINE);
+@param cWord Option name
+@return Bucket
+*/
+int iInputHash(char cWord[]) {
+  unsigned int iHash = 5381;
+  int iPos;
+
+  for (iPos = 0; cWord[iPos] != '\0'; iPos++) {
+    iHash = iHash * 33 + (unsigned char)cWord[iPos];
+  }
+  return iHash % INPUTHASHSIZE;
+}
+
+/**
+Find the table of an input file among those already read or added.
+
+@param cFile Name of the input file
+@return Table, or NULL if there is none
+*/
+INPUTTABLE *FindInputTable(char cFile[]) {
+  int iTable;
+
+  for (iTable = 0; iTable < iNumTables; iTable++) {
+    if (strcmp(tables[iTable].cFile, cFile) == 0) {
+      return &tables[iTable];
+    }
+  }
+  return NULL;
+}
+
+/**
+Start an empty table for an input file.
+
+@param cFile Name of the input file
+@return Table
+*/
+INPUTTABLE *NewInputTable(char cFile[]) {
+  INPUTTABLE *table;
+
+  tables = realloc(tables, (iNumTables + 1) * sizeof(INPUTTABLE));
+  table  = &tables[iNumTables];
+  iNumTables++;
+
+  table->cFile = malloc(strlen(cFile) + 1);
+  strcpy(table->cFile, cFile);
+  table->iNumLines = 0;
+  table->iMaxLines = 64;
+  table->saLine    = malloc(table->iMaxLines * sizeof(char *));
+  table->saWord    = malloc(table->iMaxLines * sizeof(char *));
+  table->iaNext    = NULL;
+  table->bIndexed  = 0;
+
+  return table;
+}
+
+/**
+Append a line to an input table.
+
+@param table Table of the input file
+@param cLine Line, as fgets reads it
+*/
+void AddInputLine(INPUTTABLE *table, char cLine[]) {
+  char cWord[OPTLEN];
+  int iLine;
+
+  if (table->iNumLines == table->iMaxLines) {
+    table->iMaxLines *= 2;
+    table->saLine = realloc(table->saLine, table->iMaxLines * sizeof(char *));
+    table->saWord = realloc(table->saWord, table->iMaxLines * sizeof(char *));
+  }
+  iLine                = table->iNumLines;
+  table->saLine[iLine] = malloc(strlen(cLine) + 1);
+  strcpy(table->saLine[iLine], cLine);
+  table->saWord[iLine] = NULL;
   memset(cWord, '\0', OPTLEN);
+  if (!CheckComment(cLine, LINE) && sscanf(cLine, "%47s", cWord) == 1) {
+    table->saWord[iLine] = malloc(strlen(cWord) + 1);
+    strcpy(table->saWord[iLine], cWord);
+  }
+  table->iNumLines++;
+  table->bIndexed = 0;
+}
 
-  while (fgets(cTmp, LINE, fp) != NULL) {
-    if (!CheckComment(cTmp, LINE)) {
-      sscanf(cTmp, "%s", cWord);
-      if (memcmp(cWord, cOption, iLen + 1) == 0) {
-        /* Parameter Found! */
-        if (bDone) {
-          if (iVerbose > VERBINPUT) {
-            fprintf(stderr, "Multiple occurences of parameter %s found.\n",
-                    cOption);
-          }
-          fprintf(stderr, "\t%s, lines: %d and %d\n", cFile, (*iLine + 1),
-                  iLineTmp + 1);
-          exit(1);
-        }
-        strcpy(cLine, cTmp);
-        *iLine = iLineTmp;
-        bDone  = 1;
-      }
+/**
+Chain the lines of each bucket of an input table in the order they appear.
+
+@param table Table of the input file
+*/
+void IndexInputTable(INPUTTABLE *table) {
+  int iLine, iBucket;
+
+  table->iaNext = realloc(table->iaNext, (table->iNumLines + 1) * sizeof(int));
+  for (iBucket = 0; iBucket < INPUTHASHSIZE; iBucket++) {
+    table->iaBucket[iBucket] = -1;
+  }
+  for (iLine = table->iNumLines - 1; iLine >= 0; iLine--) {
+    table->iaNext[iLine] = -1;
+    if (table->saWord[iLine] != NULL) {
+      iBucket                  = iInputHash(table->saWord[iLine]);
+      table->iaNext[iLine]     = table->iaBucket[iBucket];
+      table->iaBucket[iBucket] = iLine;
     }
-    iLineTmp++;
-    memset(cTmp, '\0', LINE);
-    memset(cWord, '\0', OPTLEN);
   }
-  fclose(fp);
+  table->bIndexed = 1;
 }
 
-/* If the previous line ended in $, must find the next valid line
-   (the next lines could be a # or blank). The search is made
-   recursively, and cLine and *iLine are the line and line number,
-   respectively. */
+/**
+Add an option to an input file that is given as options rather than read,
+e.g. by the Python module. The option becomes a line of the file's table, as
+if the file held "cName cValue", so it is read, checked and reported exactly
+as an option in a file, and the file is never opened.
+
+@param cFile Name of the input file, as it appears in saBodyFiles or on the
+  command line
+@param cName Name of the option
+@param cValue Value of the option, with the words of an array separated by
+  spaces
+@return 1, or 0 if the option is longer than a line of a file may be
+*/
+int fbAddInputOption(char cFile[], char cName[], char cValue[]) {
+  INPUTTABLE *table;
+  char cLine[LINE];
 
-void GetNextValidLine(char cFile[], int iStart, char cLine[], int *iLine) {
+  if (snprintf(cLine, LINE, "%s %s\n", cName, cValue) >= LINE) {
+    return 0;
+  }
+  table = FindInputTable(cFile);
+  if (table == NULL) {
+    table = NewInputTable(cFile);
+  }
+  AddInputLine(table, cLine);
+  return 1;
+}
+
+/**
+Return the table of an input file, reading the file if it has not been read
+or added since the last call to FreeInputTables.
+
+@param cFile Name of the input file
+@return Table, or NULL if the file cannot be opened
+*/
+INPUTTABLE *GetInputTable(char cFile[]) {
+  INPUTTABLE *table;
   FILE *fp;
-  int iPos, iLineTmp, ok = 1;
+  char cTmp[LINE];
 
-  fp     = fopen(cFile, "r");
-  *iLine = 0;
+  table = FindInputTable(cFile);
+  if (table == NULL) {
+    fp = fpOpenInput(cFile);
+    if (fp == NULL) {
+      return NULL;
+    }
+    table = NewInputTable(cFile);
+    memset(cTmp, '\0', LINE);
+    while (fgets(cTmp, LINE, fp) != NULL) {
+      AddInputLine(table, cTmp);
+      memset(cTmp, '\0', LINE);
+    }
+    fclose(fp);
+  }
+  if (!table->bIndexed) {
+    IndexInputTable(table);
+  }
 
-  for (iLineTmp = 0; iLineTmp < iStart; iLineTmp++) {
-    fgets(cLine, LINE, fp);
-    (*iLine)++;
+  return table;
+}
+
+/**
+Forget every input file read by GetInputTable or added by AddInputOption, so
+that the next lookup reads the file again.
+*/
+void FreeInputTables(void) {
+  int iTable, iLine;
+
+  for (iTable = 0; iTable < iNumTables; iTable++) {
+    for (iLine = 0; iLine < tables[iTable].iNumLines; iLine++) {
+      free(tables[iTable].saLine[iLine]);
+      free(tables[iTable].saWord[iLine]);
+    }
+    free(tables[iTable].saLine);
+    free(tables[iTable].saWord);
+    free(tables[iTable].iaNext);
+    free(tables[iTable].cFile);
   }
+  free(tables);
+  tables     = NULL;
+  iNumTables = 0;
+}
 
-  /* If EOF, return */
-  if (fgets(cLine, LINE, fp) == NULL) {
-    sprintf(cLine, "null");
-    fclose(fp);
-    return;
+/* Is the current input file the primary, i.e. the one on the command
+   line */
+
+void NotPrimaryInput(int iFile, char cName[], char cFile[], int iLine,
+                     int iVerbose) {
+  if (iLine > 0 && iFile == 0) {
+    if (iVerbose >= VERBINPUT) {
+      fprintf(stderr, "ERROR: %s is not allowed in file %s.\n", cName, cFile);
+    }
+    LineExit(cFile, iLine);
   }
+}
 
-  /* Now check for blank line, comment (# = 35), continue ($ = 36)
-     or blank line (line feed = 10). */
+/* Returns the line with the desiried options AND asserts no duplicate
+   entries. cLine is the entire text of the line, iLine is the line
+   number. */
 
-  for (iPos = 0; iPos < LINE; iPos++) {
-    if (cLine[iPos] == 36 || cLine[iPos] == 35 || cLine[iPos] == 10) {
-      /* First character is a $, # or \n: continue */
-      GetNextValidLine(cFile, iStart + 1, cLine, iLine);
-      fclose(fp);
-      return;
+void GetLine(char cFile[], char cOption[], char cLine[], int *iLine,
+             int iVerbose) {
+  int bDone = 0, iLineTmp;
+  INPUTTABLE *table;
+
+  memset(cLine, '\0', LINE);
+  table = GetInputTable(cFile);
+  if (table == NULL) {
+    return;
+  }
+
+  for (iLineTmp = table->iaBucket[iInputHash(cOption)]; iLineTmp >= 0;
+       iLineTmp = table->iaNext[iLineTmp]) {
+    if (strcmp(table->saWord[iLineTmp], cOption) == 0) {
+      /* Parameter Found! */
+      if (bDone) {
+        if (iVerbose > VERBINPUT) {
+          fprintf(stderr, "Multiple occurences of parameter %s found.\n",
+                  cOption);
+        }
+        fprintf(stderr, "\t%s, lines: %d and %d\n", cFile, (*iLine + 1),
+                iLineTmp + 1);
+        VplanetExit(1);
+      }
+      strcpy(cLine, table->saLine[iLineTmp]);
+      *iLine = iLineTmp;
+      bDone  = 1;
     }
-    if (!isspace(cLine[iPos])) {
-      /* Found next valid line */
-      fclose(fp);
-      return;
+  }
+}
+
+/* If the previous line ended in $, must find the next valid line
+   (the next lines could be a # or blank). cLine and *iLine are the
+   line and line number, respectively. */
+
+void GetNextValidLine(char cFile[], int iStart, char cLine[], int *iLine) {
+  INPUTTABLE *table;
+  int iPos, iLineTmp;
+  char *cTmp;
+
+  table = GetInputTable(cFile);
+  for (iLineTmp = iStart; table != NULL && iLineTmp < table->iNumLines;
+       iLineTmp++) {
+    cTmp = table->saLine[iLineTmp];
+    /* Now check for blank line, comment (# = 35), continue ($ = 36)
+       or blank line (line feed = 10). The terminating null counts as
+       a valid character, as it always has. */
+    for (iPos = 0; iPos <= strlen(cTmp); iPos++) {
+      if (cTmp[iPos] == 36 || cTmp[iPos] == 35 || cTmp[iPos] == 10) {
+        /* First character is a $, # or \n: continue */
+        break;
+      }
+      if (!isspace(cTmp[iPos])) {
+        /* Found next valid line */
+        strcpy(cLine, cTmp);
+        *iLine = iLineTmp;
+        return;
+      }
     }
   }
-  /* If made it here, line was blank */
-  GetNextValidLine(cFile, iStart + 1, cLine, iLine);
-  fclose(fp);
+
+  /* If EOF, return */
+  sprintf(cLine, "null");
+  *iLine = iLineTmp;
 }
 
 /* Where is the first non-white-space character in a line? */
@@ -376,16 +643,18 @@ void AddOptionString(char cFile[], char cOption[], char cInput[], int *iLine,
 
 int GetNumOut(char cFile[], char cName[], int iLen, int *iLineNum, int iExit) {
   char cLine[LINE], cWord[NAMELEN];
-  int iPos, j, ok, bDone = 0, iLine = 0, iNumOut;
-  FILE *fp;
+  int iPos, j, ok, bDone = 0, iLine, iNumOut;
+  INPUTTABLE *table;
 
-  fp = fopen(cFile, "r");
-  if (fp == NULL) {
+  table = GetInputTable(cFile);
+  if (table == NULL) {
     fprintf(stderr, "Unable to open %s.\n", cFile);
-    exit(iExit);
+    VplanetExit(iExit);
   }
 
-  while (fgets(cLine, LINE, fp) != NULL) {
+  memset(cLine, '\0', LINE);
+  for (iLine = 0; iLine < table->iNumLines; iLine++) {
+    strcpy(cLine, table->saLine[iLine]);
     /* Check for # sign */
     if (memcmp(cLine, "#", 1) != 0) {
       /* Check for desired parameter */
@@ -396,7 +665,7 @@ int GetNumOut(char cFile[], char cName[], int iLen, int *iLineNum, int iExit) {
           fprintf(stderr, "ERROR: Multiple occurences of parameter %s found.\n",
                   cName);
           fprintf(stderr, "\t%s, lines: %d and %d\n", cFile, *iLineNum, iLine);
-          exit(iExit);
+          VplanetExit(iExit);
         }
         bDone     = 1;
         *iLineNum = iLine;
@@ -420,7 +689,6 @@ int GetNumOut(char cFile[], char cName[], int iLen, int *iLineNum, int iExit) {
         }
       }
     }
-    iLine++;
     for (iPos = 0; iPos < LINE; iPos++) {
       cLine[iPos] = 0;
     }
@@ -433,20 +701,21 @@ int GetNumOut(char cFile[], char cName[], int iLen, int *iLineNum, int iExit) {
 int iGetNumLines(char cFile[]) {
   int iNumLines = 0, iChar, bFileOK = 1;
   int bComment, bReturn;
-  FILE *fp;
+  INPUTTABLE *table;
   char cLine[LINE];
 
   fprintf(stderr,"File: %s\n",cFile);
 
-  fp = fopen(cFile, "r");
-  if (fp == NULL) {
+  table = GetInputTable(cFile);
+  if (table == NULL) {
     fprintf(stderr, "Unable to open %s.\n", cFile);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   memset(cLine, '\0', LINE);
   // fprintf(stderr,"File: %s\n",cFile);
-  while (fgets(cLine, LINE, fp) != NULL) {
+  while (iNumLines < table->iNumLines) {
+    strcpy(cLine, table->saLine[iNumLines]);
     // fprintf(stderr,"iLine: %d, %s",iNumLines,cLine);
     iNumLines++;
 
@@ -478,7 +747,7 @@ int iGetNumLines(char cFile[]) {
   }
 
   if (!bFileOK) {
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   return iNumLines;
@@ -486,15 +755,15 @@ int iGetNumLines(char cFile[]) {
 
 void InitializeInput(INFILE *input) {
   int iLine, iPos, bBlank;
-  FILE *fp;
+  INPUTTABLE *table;
   char cLine[LINE];
 
 fprintf(stderr,"File: %s\n",input->cIn);
 
-  fp = fopen(input->cIn, "r");
-  if (fp == NULL) {
+  table = GetInputTable(input->cIn);
+  if (table == NULL) {
     fprintf(stderr, "Unable to open %s.\n", input->cIn);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
   input->iNumLines = iGetNumLines(input->cIn);
   input->bLineOK   = malloc(input->iNumLines * sizeof(int));
@@ -515,7 +784,7 @@ fprintf(stderr,"File: %s\n",input->cIn);
     */
     memset(cLine, '\0', LINE);
 
-    fgets(cLine, LINE, fp);
+    strcpy(cLine, table->saLine[iLine]);
     // fprintf(stderr,"iLine: %d, %s",iLine,cLine);
     /* Check for # sign or blank line */
     if (CheckComment(cLine, LINE)) {
@@ -537,15 +806,15 @@ fprintf(stderr,"File: %s\n",input->cIn);
 }
 
 void Unrecognized(FILES files) {
-  FILE *fp;
+  INPUTTABLE *table;
   char cLine[LINE], cWord[NAMELEN];
   int iFile, iLine, bExit = 0; /* Assume don't exit */
 
   for (iFile = 0; iFile < files.iNumInputs; iFile++) {
-    fp = fopen(files.Infile[iFile].cIn, "r");
+    table = GetInputTable(files.Infile[iFile].cIn);
 
-    iLine = 0;
-    while (fgets(cLine, LINE, fp) != NULL) {
+    for (iLine = 0; iLine < table->iNumLines; iLine++) {
+      strcpy(cLine, table->saLine[iLine]);
       if (!files.Infile[iFile].bLineOK[iLine]) {
         /* Bad line */
         sscanf(cLine, "%s", cWord);
@@ -554,18 +823,40 @@ void Unrecognized(FILES files) {
         bExit = 1;
       }
       memset(cLine, '\0', LINE);
-      iLine++;
     }
   }
   if (bExit) {
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 }
 
+/* Until an option is found in a file, its file names are the shared table of
+   "null"s, so that the options of every module cost little more than their
+   names until they are set. */
+
+static char caFileNull[MAXFILES][OPTLEN];
+
+/**
+Record the file in which an option was found, giving the option its own table
+of file names first.
+
+@param options Option
+@param iFile Index of the file
+@param cFile Name of the file
+*/
+void SetOptionFile(OPTIONS *options, int iFile, char cFile[]) {
+  if (options->cFile == caFileNull) {
+    // Freed with the options by FreeOptions, after the run
+    options->cFile = fvMallocOutsideRun(MAXFILES * OPTLEN);
+    memcpy(options->cFile, caFileNull, MAXFILES * OPTLEN);
+  }
+  strcpy(options->cFile[iFile], cFile);
+}
+
 void UpdateFoundOption(INFILE *input, OPTIONS *options, int iLine, int iFile) {
   input->bLineOK[iLine] = 1;
   options->iLine[iFile] = iLine;
-  strcpy(options->cFile[iFile], input->cIn);
+  SetOptionFile(options, iFile, input->cIn);
 }
 
 void UpdateFoundOptionMulti(INFILE *input, OPTIONS *options, int *iLine,
@@ -577,7 +868,7 @@ void UpdateFoundOptionMulti(INFILE *input, OPTIONS *options, int *iLine,
     The user should be able to figure it out from there.
   */
   options->iLine[iFile] = iLine[0];
-  strcpy(options->cFile[iFile], input->cIn);
+  SetOptionFile(options, iFile, input->cIn);
   for (iLineNow = 0; iLineNow < iNumLines; iLineNow++) {
     input->bLineOK[iLine[iLineNow]] = 1;
   }
@@ -591,7 +882,7 @@ void CheckDuplication(FILES *files, OPTIONS *options, char cFile[], int iLine,
     fprintf(stderr,
             "ERROR: CheckDuplication called, but options. bMultiFile = %d\n",
             options->bMultiFile);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   for (iFile = 0; iFile < files->iNumInputs; iFile++) {
@@ -605,7 +896,7 @@ void CheckDuplication(FILES *files, OPTIONS *options, char cFile[], int iLine,
       fprintf(stderr, "\t%s, Line: %d\n", files->Infile[iFile].cIn,
               options->iLine[iFile]);
       fprintf(stderr, "\t%s, Line: %d\n", cFile, iLine);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
   }
 }
@@ -719,7 +1010,7 @@ void ReadUnitMass(CONTROL *control, FILES *files, OPTIONS *options, int iFile) {
         fprintf(stderr, "\t%s, Line: %d\n", files->Infile[0].cIn,
                 options->iLine[0]);
         fprintf(stderr, "\t%s, Line: %d\n", files->Infile[iFile].cIn, lTmp);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       } else {
         /* Wasn't assigned in primary */
         control->Units[iFile].iMass =
@@ -811,7 +1102,7 @@ void ReadUnitTime(CONTROL *control, FILES *files, OPTIONS *options, int iFile) {
         fprintf(stderr, "\t%s, Line: %d\n", options->cFile[0],
                 options->iLine[0]);
         fprintf(stderr, "\t%s, Line: %d\n", files->Infile[iFile].cIn, lTmp);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       } else {
         /* Wasn't assigned in primary */
         control->Units[iFile].iTime =
@@ -897,7 +1188,7 @@ void ReadUnitAngle(CONTROL *control, FILES *files, OPTIONS *options,
         fprintf(stderr, "\t%s, Line: %d\n", options->cFile[0],
                 options->iLine[0]);
         fprintf(stderr, "\t%s, Line: %d\n", files->Infile[iFile].cIn, lTmp);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       } else {
         /* Wasn't assigned in primary */
         control->Units[iFile].iAngle =
@@ -994,7 +1285,7 @@ void ReadUnitLength(CONTROL *control, FILES *files, OPTIONS *options,
         fprintf(stderr, "\t%s, Line: %d\n", options->cFile[0],
                 options->iLine[0]);
         fprintf(stderr, "\t%s, Line: %d\n", files->Infile[iFile].cIn, lTmp);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       } else {
         /* Wasn't assigned in primary */
         control->Units[iFile].iLength =
@@ -1083,7 +1374,7 @@ void ReadUnitTemp(CONTROL *control, FILES *files, OPTIONS *options, int iFile) {
         fprintf(stderr, "\t%s, Line: %d\n", files->Infile[0].cIn,
                 options->iLine[0]);
         fprintf(stderr, "\t%s, Line: %d\n", files->Infile[iFile].cIn, lTmp);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       } else {
         /* Wasn't assigned in primary */
         control->Units[iFile].iTemp =
@@ -1158,7 +1449,7 @@ void ReadBodyFileNames(CONTROL *control, FILES *files, OPTIONS *options,
   } else {
     fprintf(stderr, "ERROR: Option %s is required in file %s.\n",
             options->cName, infile->cIn);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   /* With body files identified, must allocate space */
@@ -1176,6 +1467,10 @@ void ReadBodyFileNames(CONTROL *control, FILES *files, OPTIONS *options,
   files->Outfile             = malloc(iNumIndices * sizeof(OUTFILE));
   for (iIndex = 0; iIndex < iNumIndices; iIndex++) {
     memset(files->Outfile[iIndex].cOut, '\0', NAMELEN);
+    files->Outfile[iIndex].fp        = NULL;
+    files->Outfile[iIndex].fpGrid    = NULL;
+    files->Outfile[iIndex].chunk     = NULL;
+    files->Outfile[iIndex].chunkGrid = NULL;
   }
 
   UpdateFoundOptionMulti(&files->Infile[0], options, lTmp, iNumLines, 0);
@@ -1311,6 +1606,58 @@ int bOptionAlreadyFound(int *iLine, int iNumFiles) {
  *
  */
 
+/* Absolute tolerance of the adaptive integrator */
+
+void ReadAbsTol(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
+                SYSTEM *system, int iFile) {
+  /* This parameter can exist in any file, but only once */
+  int lTmp = -1;
+  double dTmp;
+
+  AddOptionDouble(files->Infile[iFile].cIn, options->cName, &dTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    CheckDuplication(files, options, files->Infile[iFile].cIn, lTmp,
+                     control->Io.iVerbose);
+    if (dTmp < 0) {
+      if (control->Io.iVerbose >= VERBERR) {
+        fprintf(stderr, "ERROR: %s must be non-negative.\n", options->cName);
+      }
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    control->Evolve.dAbsTol = dTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultDouble(options, &control->Evolve.dAbsTol, files->iNumInputs);
+  }
+}
+
+/* Relative tolerance of the adaptive integrator */
+
+void ReadRelTol(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
+                SYSTEM *system, int iFile) {
+  /* This parameter can exist in any file, but only once */
+  int lTmp = -1;
+  double dTmp;
+
+  AddOptionDouble(files->Infile[iFile].cIn, options->cName, &dTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    CheckDuplication(files, options, files->Infile[iFile].cIn, lTmp,
+                     control->Io.iVerbose);
+    if (dTmp <= 0) {
+      if (control->Io.iVerbose >= VERBERR) {
+        fprintf(stderr, "ERROR: %s must be greater than 0.\n", options->cName);
+      }
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    control->Evolve.dRelTol = dTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultDouble(options, &control->Evolve.dRelTol, files->iNumInputs);
+  }
+}
+
 /* Age */
 
 void ReadAge(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
@@ -1365,6 +1712,26 @@ void ReadAlbedoGlobal(BODY *body, CONTROL *control, FILES *files,
   }
 }
 
+/* Asynchronous output */
+
+void ReadAsyncOutput(BODY *body, CONTROL *control, FILES *files,
+                     OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter can exist in any file, but only once */
+  int lTmp = -1;
+  int bTmp;
+
+  AddOptionBool(files->Infile[iFile].cIn, options->cName, &bTmp, &lTmp,
+                control->Io.iVerbose);
+  if (lTmp >= 0) {
+    CheckDuplication(files, options, files->Infile[iFile].cIn, lTmp,
+                     control->Io.iVerbose);
+    control->Io.bAsyncOutput = bTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultInt(options, &control->Io.bAsyncOutput, files->iNumInputs);
+  }
+}
+
 /* Body Type */
 
 void ReadBodyType(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
@@ -1602,6 +1969,55 @@ void ReadBodyName(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   }
 }
 
+/* Checkpoint interval */
+
+void ReadCheckpointTime(BODY *body, CONTROL *control, FILES *files,
+                        OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter can exist in any file, but only once */
+  int lTmp = -1;
+  double dTmp;
+
+  AddOptionDouble(files->Infile[iFile].cIn, options->cName, &dTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    CheckDuplication(files, options, files->Infile[iFile].cIn, lTmp,
+                     control->Io.iVerbose);
+    if (dTmp < 0) {
+      if (control->Io.iVerbose >= VERBERR) {
+        fprintf(stderr, "ERROR: %s must be greater than 0.\n", options->cName);
+      }
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    /* Convert checkpoint time to cgs */
+    control->Io.dCheckpointTime =
+          dTmp * fdUnitsTime(control->Units[iFile].iTime);
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultDouble(options, &control->Io.dCheckpointTime,
+                        files->iNumInputs);
+  }
+}
+
+/* Dense output */
+
+void ReadDenseOutput(BODY *body, CONTROL *control, FILES *files,
+                     OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter can exist in any file, but only once */
+  int lTmp = -1;
+  int bTmp;
+
+  AddOptionBool(files->Infile[iFile].cIn, options->cName, &bTmp, &lTmp,
+                control->Io.iVerbose);
+  if (lTmp >= 0) {
+    CheckDuplication(files, options, files->Infile[iFile].cIn, lTmp,
+                     control->Io.iVerbose);
+    control->Io.bDenseOutput = bTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultInt(options, &control->Io.bDenseOutput, files->iNumInputs);
+  }
+}
+
 /* Body color (for plotting) */
 void ReadColor(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
                SYSTEM *system, int iFile) {
@@ -1661,6 +2077,33 @@ void ReadDigits(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   }
 }
 
+/* Number of threads */
+
+void ReadNumThreads(BODY *body, CONTROL *control, FILES *files,
+                    OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter can exist in any file, but only once */
+  int lTmp = -1;
+  int iTmp;
+
+  AddOptionInt(files->Infile[iFile].cIn, options->cName, &iTmp, &lTmp,
+               control->Io.iVerbose);
+  if (lTmp >= 0) {
+    /* Option was found */
+    CheckDuplication(files, options, files->Infile[iFile].cIn, lTmp,
+                     control->Io.iVerbose);
+    if (iTmp < 1) {
+      if (control->Io.iVerbose >= VERBERR) {
+        fprintf(stderr, "ERROR: %s must be greater than 0.\n", options->cName);
+      }
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    control->Evolve.iNumThreads = iTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultInt(options, &control->Evolve.iNumThreads, files->iNumInputs);
+  }
+}
+
 
 /*
  *
@@ -2047,7 +2490,7 @@ void ReadHecc(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   if (lTmp >= 0) {
     fprintf(stderr, "ERROR: Option %s is not currently supported.\n",
             options->cName);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   } else if (iFile > 0) {
     body[iFile - 1].dHecc = options->dDefault;
   }
@@ -2073,13 +2516,19 @@ void ReadIntegrationMethod(BODY *body, CONTROL *control, FILES *files,
                      control->Io.iVerbose);
     if (memcmp(sLower(cTmp), "e", 1) == 0) {
       control->Evolve.iOneStep = EULER;
+    } else if (memcmp(sLower(cTmp), "rk45", 4) == 0 ||
+               memcmp(sLower(cTmp), "d", 1) == 0) {
+      control->Evolve.iOneStep = RK45;
+    } else if (memcmp(sLower(cTmp), "ro", 2) == 0) {
+      control->Evolve.iOneStep = ROSENBROCK;
     } else if (memcmp(sLower(cTmp), "r", 1) == 0) {
       control->Evolve.iOneStep = RUNGEKUTTA;
     } else {
       if (control->Io.iVerbose >= VERBERR) {
         fprintf(stderr, "ERROR: Unknown argument to %s: %s.\n", options->cName,
                 cTmp);
-        fprintf(stderr, "Options are Euler.\n");
+        fprintf(stderr,
+                "Options are Euler, Runge-Kutta4, RK45, Rosenbrock.\n");
       }
       LineExit(files->Infile[iFile].cIn, lTmp);
     }
@@ -2106,7 +2555,7 @@ void ReadKecc(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   if (lTmp >= 0) {
     fprintf(stderr, "ERROR: Option %s is not currently supported.\n",
             options->cName);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   } else if (iFile > 0) {
     body[iFile - 1].dKecc = options->dDefault;
   }
@@ -2369,7 +2818,7 @@ void ReadLXUV(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   if (lTmp >= 0) {
     fprintf(stderr, "ERROR: Option %s is not currently supported.\n",
             options->cName);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   } else {
     if (iFile > 0) {
       body[iFile - 1].dLXUV = options->dDefault;
@@ -2682,7 +3131,7 @@ void ReadOutputOrder(FILES *files, MODULE *module, OPTIONS *options,
                 "increase MAXARRAY in vplanet.h.\n",
                 files->Infile[iFile].cIn);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
 
     /* First remove and record negative signs */
@@ -3004,6 +3453,38 @@ void ReadGridOutput(FILES *files, OPTIONS *options, OUTPUT *output, int iFile,
   free(lTmp);
 }
 
+/* Output file format */
+
+void ReadOutputFormat(BODY *body, CONTROL *control, FILES *files,
+                      OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter can exist in any file, but only once */
+  int lTmp = -1;
+  char cTmp[OPTLEN];
+
+  AddOptionString(files->Infile[iFile].cIn, options->cName, cTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    CheckDuplication(files, options, files->Infile[iFile].cIn, lTmp,
+                     control->Io.iVerbose);
+    if (memcmp(sLower(cTmp), "t", 1) == 0) {
+      control->Io.iOutputFormat = OUTPUTTEXT;
+    } else if (memcmp(sLower(cTmp), "b", 1) == 0) {
+      control->Io.iOutputFormat = OUTPUTBINARY;
+    } else if (memcmp(sLower(cTmp), "c", 1) == 0) {
+      control->Io.iOutputFormat = OUTPUTCONTAINER;
+    } else {
+      if (control->Io.iVerbose >= VERBERR) {
+        fprintf(stderr, "ERROR: Unknown argument to %s: %s.\n", options->cName,
+                cTmp);
+        fprintf(stderr, "Options are Text, Binary, Container.\n");
+      }
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  }
+  /* If not input, the default was assigned in main */
+}
+
 void ReadOverwrite(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
                    SYSTEM *system, int iFile) {
   /* This parameter can exist in any file, but only once */
@@ -3564,7 +4045,7 @@ void ReadXobl(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   if (lTmp >= 0) {
     fprintf(stderr, "ERROR: Option %s is not currently supported.\n",
             options->cName);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   } else if (iFile > 0) {
     body[iFile - 1].dXobl = options->dDefault;
   }
@@ -3588,7 +4069,7 @@ void ReadYobl(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   if (lTmp >= 0) {
     fprintf(stderr, "ERROR: Option %s is not currently supported.\n",
             options->cName);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   } else if (iFile > 0) {
     body[iFile - 1].dYobl = options->dDefault;
   }
@@ -3612,7 +4093,7 @@ void ReadZobl(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   if (lTmp >= 0) {
     fprintf(stderr, "ERROR: Option %s is not currently supported.\n",
             options->cName);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   } else if (iFile > 0) {
     body[iFile - 1].dZobl = options->dDefault;
   }
@@ -3630,6 +4111,9 @@ void ReadOptions(BODY **body, CONTROL *control, FILES *files, MODULE *module,
                  UPDATE **update, fnReadOption fnRead[], char infile[]) {
   int iBody;
 
+  /* Every run ends by freeing the tables, so these are the files as they are
+     now, or the options added by fbAddInputOption for this run */
+
   /* Read options for files, units, verbosity, and system name. */
   ReadInitialOptions(body, control, files, module, options, output, system,
                      infile);
@@ -3652,6 +4136,7 @@ void ReadOptions(BODY **body, CONTROL *control, FILES *files, MODULE *module,
 
   /* Any unrecognized options? */
   Unrecognized(*files);
+  FreeInputTables();
 }
 
 /*
@@ -3678,6 +4163,18 @@ void InitializeOptionsGeneral(OPTIONS *options, fnReadOption fnRead[]) {
    *
    */
 
+  sprintf(options[OPT_ABSTOL].cName, "dAbsTol");
+  sprintf(options[OPT_ABSTOL].cDescr,
+          "Absolute error tolerance for the adaptive integrators");
+  sprintf(options[OPT_ABSTOL].cDefault, "0");
+  sprintf(options[OPT_ABSTOL].cDimension, "nd");
+  options[OPT_ABSTOL].dDefault   = 0;
+  options[OPT_ABSTOL].iType      = 2;
+  options[OPT_ABSTOL].iModuleBit = 0;
+  options[OPT_ABSTOL].bNeg       = 0;
+  options[OPT_ABSTOL].iFileType  = 2;
+  fnRead[OPT_ABSTOL]             = &ReadAbsTol;
+
   sprintf(options[OPT_AGE].cName, "dAge");
   sprintf(options[OPT_AGE].cDescr, "System Age");
   sprintf(options[OPT_AGE].cDefault, "0");
@@ -3703,6 +4200,23 @@ void InitializeOptionsGeneral(OPTIONS *options, fnReadOption fnRead[]) {
   options[OPT_ALBEDOGLOBAL].iFileType  = 1;
   fnRead[OPT_ALBEDOGLOBAL]             = &ReadAlbedoGlobal;
 
+  sprintf(options[OPT_ASYNCOUTPUT].cName, "bAsyncOutput");
+  sprintf(options[OPT_ASYNCOUTPUT].cDescr,
+          "Write output rows on a background thread?");
+  sprintf(options[OPT_ASYNCOUTPUT].cDefault, "0");
+  options[OPT_ASYNCOUTPUT].dDefault   = 0;
+  options[OPT_ASYNCOUTPUT].iType      = 0;
+  options[OPT_ASYNCOUTPUT].iModuleBit = 0;
+  options[OPT_ASYNCOUTPUT].bNeg       = 0;
+  options[OPT_ASYNCOUTPUT].iFileType  = 2;
+  fnRead[OPT_ASYNCOUTPUT]             = &ReadAsyncOutput;
+  sprintf(options[OPT_ASYNCOUTPUT].cLongDescr,
+          "If set, the rows of the forward, backward and Climate files are \n"
+          "handed to a writer thread that formats and writes them while the \n"
+          "integration continues. The files are identical to those written \n"
+          "without it. Container output is always written by the main \n"
+          "thread, as are all outputs on Windows.");
+
   /*
    *
    *   B
@@ -3815,6 +4329,25 @@ void InitializeOptionsGeneral(OPTIONS *options, fnReadOption fnRead[]) {
    *
    */
 
+  sprintf(options[OPT_CHECKPOINTTIME].cName, "dCheckpointTime");
+  sprintf(options[OPT_CHECKPOINTTIME].cDescr, "Checkpoint Interval");
+  sprintf(options[OPT_CHECKPOINTTIME].cDefault, "0 (never)");
+  sprintf(options[OPT_CHECKPOINTTIME].cNeg, "Years");
+  sprintf(options[OPT_CHECKPOINTTIME].cDimension, "time");
+  options[OPT_CHECKPOINTTIME].dDefault   = 0;
+  options[OPT_CHECKPOINTTIME].iType      = 2;
+  options[OPT_CHECKPOINTTIME].iModuleBit = 0;
+  options[OPT_CHECKPOINTTIME].bNeg       = 1;
+  options[OPT_CHECKPOINTTIME].dNeg       = YEARSEC;
+  options[OPT_CHECKPOINTTIME].iFileType  = 2;
+  fnRead[OPT_CHECKPOINTTIME]             = &ReadCheckpointTime;
+  sprintf(options[OPT_CHECKPOINTTIME].cLongDescr,
+          "At the first output after every interval, the complete evolving \n"
+          "state is written to <sSystemName>.checkpoint, replacing the \n"
+          "previous one. Running vplanet -r on the same input files resumes \n"
+          "the integration from it and continues the output files, \n"
+          "producing the same results as an uninterrupted run.");
+
   sprintf(options[OPT_COLOR].cName, "sColor");
   sprintf(options[OPT_COLOR].cDescr,
           "Hexadecimal color code for the body to be used in vplot");
@@ -3825,6 +4358,30 @@ void InitializeOptionsGeneral(OPTIONS *options, fnReadOption fnRead[]) {
   options[OPT_COLOR].iFileType  = 1;
   fnRead[OPT_COLOR]             = &ReadColor;
 
+  /*
+   *
+   *   D
+   *
+   */
+
+  sprintf(options[OPT_DENSEOUTPUT].cName, "bDenseOutput");
+  sprintf(options[OPT_DENSEOUTPUT].cDescr,
+          "Interpolate output times instead of stepping to them?");
+  sprintf(options[OPT_DENSEOUTPUT].cDefault, "0");
+  options[OPT_DENSEOUTPUT].dDefault   = 0;
+  options[OPT_DENSEOUTPUT].iType      = 0;
+  options[OPT_DENSEOUTPUT].iModuleBit = 0;
+  options[OPT_DENSEOUTPUT].bNeg       = 0;
+  options[OPT_DENSEOUTPUT].iFileType  = 2;
+  fnRead[OPT_DENSEOUTPUT]             = &ReadDenseOutput;
+  sprintf(options[OPT_DENSEOUTPUT].cLongDescr,
+          "By default every step is shortened so that it ends on the next \n"
+          "output time, so a small dOutputTime forces small steps. If set, \n"
+          "the integrator steps freely and each output is computed at its \n"
+          "exact time by cubic Hermite interpolation across the step that \n"
+          "contains it. Only available with the Runge-Kutta4 and RK45 \n"
+          "integration methods.");
+
   /*
    *
    *   E
@@ -3988,7 +4545,8 @@ void InitializeOptionsGeneral(OPTIONS *options, fnReadOption fnRead[]) {
 
   sprintf(options[OPT_INTEGRATIONMETHOD].cName, "sIntegrationMethod");
   sprintf(options[OPT_INTEGRATIONMETHOD].cDescr,
-          "Integration Method: Euler, Runge-Kutta4 (Default = Runge-Kutta4)");
+          "Integration Method: Euler, Runge-Kutta4, RK45, Rosenbrock "
+          "(Default = Runge-Kutta4)");
   sprintf(options[OPT_INTEGRATIONMETHOD].cDefault, "Runge-Kutta4");
   options[OPT_INTEGRATIONMETHOD].iType      = 3;
   options[OPT_INTEGRATIONMETHOD].iModuleBit = 0;
@@ -4119,6 +4677,22 @@ void InitializeOptionsGeneral(OPTIONS *options, fnReadOption fnRead[]) {
    *
    */
 
+  sprintf(options[OPT_NUMTHREADS].cName, "iNumThreads");
+  sprintf(options[OPT_NUMTHREADS].cDescr,
+          "Number of Threads Evaluating the Derivatives");
+  sprintf(options[OPT_NUMTHREADS].cDefault, "0");
+  options[OPT_NUMTHREADS].iType      = 1;
+  options[OPT_NUMTHREADS].iModuleBit = 0;
+  options[OPT_NUMTHREADS].bNeg       = 0;
+  options[OPT_NUMTHREADS].iFileType  = 2;
+  fnRead[OPT_NUMTHREADS]             = &ReadNumThreads;
+  sprintf(options[OPT_NUMTHREADS].cLongDescr,
+          "The derivatives of different bodies, and the couplings between \n"
+          "bodies, are evaluated concurrently by this many threads. If not \n"
+          "set, the environment variable VPLANET_NUM_THREADS is used, or 1 \n"
+          "if that is not set either. Requires a build with OpenMP, e.g. \n"
+          "make parallel.");
+
   sprintf(options[OPT_OUTDIGITS].cName, "iDigits");
   sprintf(options[OPT_OUTDIGITS].cDescr,
           "Number of Digits After Decimal Point");
@@ -4142,6 +4716,27 @@ void InitializeOptionsGeneral(OPTIONS *options, fnReadOption fnRead[]) {
   options[OPT_OUTPUTORDER].iFileType  = 1;
   options[OPT_OUTPUTORDER].bMultiFile = 1;
 
+  sprintf(options[OPT_OUTPUTFORMAT].cName, "sOutputFormat");
+  sprintf(options[OPT_OUTPUTFORMAT].cDescr,
+          "Format of the output files: Text, Binary, Container");
+  sprintf(options[OPT_OUTPUTFORMAT].cDefault, "Text");
+  options[OPT_OUTPUTFORMAT].iType      = 3;
+  options[OPT_OUTPUTFORMAT].iModuleBit = 0;
+  options[OPT_OUTPUTFORMAT].bNeg       = 0;
+  options[OPT_OUTPUTFORMAT].iFileType  = 2;
+  fnRead[OPT_OUTPUTFORMAT]             = &ReadOutputFormat;
+  sprintf(options[OPT_OUTPUTFORMAT].cLongDescr,
+          "With Binary, the .forward and .backward files start with the line \n"
+          "\"VPLANET BINARY 1\" and a line of JSON that lists the columns and \n"
+          "their units, padded to a multiple of 8 bytes. Every output then \n"
+          "appends one row of little-endian float64 values, which are the \n"
+          "full precision values, so iDigits and iSciNot do not apply. \n"
+          "With Container, all of these rows, the .Climate grids and the \n"
+          "SeasonalClimateFiles are instead appended to the single file \n"
+          "<sSystemName>.container, as chunks that each start with a line of \n"
+          "JSON naming the file they replace and the shape of the float64 \n"
+          "rows that follow. vplanet.get_output reads all three formats.");
+
   sprintf(options[OPT_GRIDOUTPUT].cName, "saGridOutput");
   sprintf(options[OPT_GRIDOUTPUT].cDescr, "Gridded Output Parameter(s)");
   sprintf(options[OPT_GRIDOUTPUT].cDefault, "None");
@@ -4458,6 +5053,27 @@ void InitializeOptionsGeneral(OPTIONS *options, fnReadOption fnRead[]) {
   options[OPT_RG].iFileType  = 1;
   fnRead[OPT_RG]             = &ReadRadiusGyration;
 
+  sprintf(options[OPT_RELTOL].cName, "dRelTol");
+  sprintf(options[OPT_RELTOL].cDescr,
+          "Relative error tolerance for the adaptive integrators");
+  sprintf(options[OPT_RELTOL].cDefault, "1e-8");
+  sprintf(options[OPT_RELTOL].cDimension, "nd");
+  options[OPT_RELTOL].dDefault   = 1e-8;
+  options[OPT_RELTOL].iType      = 2;
+  options[OPT_RELTOL].iModuleBit = 0;
+  options[OPT_RELTOL].bNeg       = 0;
+  options[OPT_RELTOL].iFileType  = 2;
+  fnRead[OPT_RELTOL]             = &ReadRelTol;
+  sprintf(options[OPT_RELTOL].cLongDescr,
+          "With %s = RK45 or Rosenbrock, the embedded error estimate of \n"
+          "each primary variable x must be smaller than %s + %s*|x| for a \n"
+          "step to be accepted. Variables that oscillate about zero, e.g. \n"
+          "Hecc and Xobl, are measured relative to the eccentricity, \n"
+          "obliquity, or unity. %s only sets the initial step size for \n"
+          "these methods.",
+          options[OPT_INTEGRATIONMETHOD].cName, options[OPT_ABSTOL].cName,
+          options[OPT_RELTOL].cName, options[OPT_ETA].cName);
+
   sprintf(options[OPT_ROTPER].cName, "dRotPeriod");
   sprintf(options[OPT_ROTPER].cDescr, "Rotation Period");
   sprintf(options[OPT_ROTPER].cDefault, "1 Day");
@@ -4666,35 +5282,35 @@ void InitializeOptionsGeneral(OPTIONS *options, fnReadOption fnRead[]) {
 void InitializeOptions(OPTIONS *options, fnReadOption *fnRead) {
   int iBody, iOpt, iFile, iModule;
 
-  /* Initialize all parameters describing the option's location */
+  for (iFile = 0; iFile < MAXFILES; iFile++) {
+    memset(caFileNull[iFile], '\0', OPTLEN);
+    sprintf(caFileNull[iFile], "null");
+  }
+
+  /* Initialize all parameters describing the option's location. Only the
+     start of each string is written, so the entries of options no module
+     registers are hardly touched. */
   for (iOpt = 0; iOpt < MODULEOPTEND; iOpt++) {
-    memset(options[iOpt].cName, '\0', OPTLEN);
     sprintf(options[iOpt].cName, "null");
     options[iOpt].iLine      = malloc(MAXFILES * sizeof(int));
     options[iOpt].bMultiFile = 0;
     options[iOpt].iMultiIn   = 0;
     options[iOpt].iType      = -1;
-    memset(options[iOpt].cDescr, '\0', OPTDESCR);
     sprintf(options[iOpt].cDescr, "null");
-    memset(options[iOpt].cLongDescr, '\0', OPTLONDESCR);
     sprintf(options[iOpt].cLongDescr, "null");
-    memset(options[iOpt].cDefault, '\0', OPTDESCR);
     sprintf(options[iOpt].cDefault, "null");
-    memset(options[iOpt].cValues, '\0', OPTDESCR);
     sprintf(options[iOpt].cValues, "null");
-    memset(options[iOpt].cNeg, '\0', OPTDESCR);
     sprintf(options[iOpt].cNeg, "null");
-    memset(options[iOpt].cDimension, '\0', OPTDESCR);
-    options[iOpt].dDefault   = NAN;
-    options[iOpt].iModuleBit = 0;
-    options[iOpt].bNeg       = 0;
-    options[iOpt].iFileType  = 2;
-    options[iOpt].dNeg       = 0;
+    options[iOpt].cDimension[0] = '\0';
+    options[iOpt].dDefault      = NAN;
+    options[iOpt].iModuleBit    = 0;
+    options[iOpt].bNeg          = 0;
+    options[iOpt].iFileType     = 2;
+    options[iOpt].dNeg          = 0;
+    options[iOpt].cFile         = caFileNull;
 
     for (iFile = 0; iFile < MAXFILES; iFile++) {
       options[iOpt].iLine[iFile] = -1;
-      memset(options[iOpt].cFile[iFile], '\0', OPTLEN);
-      sprintf(options[iOpt].cFile[iFile], "null");
     }
   }
 
@@ -4719,3 +5335,39 @@ void InitializeOptions(OPTIONS *options, fnReadOption *fnRead) {
   InitializeOptionsMagmOc(options, fnRead);
   InitializeOptionsFlare(options, fnRead);
 }
+
+/**
+Forget where the last run found each option, so that the options can read
+another system.
+
+@param options Options
+*/
+void ResetOptions(OPTIONS *options) {
+  int iOpt, iFile;
+
+  for (iOpt = 0; iOpt < MODULEOPTEND; iOpt++) {
+    for (iFile = 0; iFile < MAXFILES; iFile++) {
+      options[iOpt].iLine[iFile] = -1;
+    }
+    if (options[iOpt].cFile != caFileNull) {
+      free(options[iOpt].cFile);
+      options[iOpt].cFile = caFileNull;
+    }
+  }
+}
+
+/**
+Free what InitializeOptions and SetOptionFile allocated for each option.
+
+@param options Options, themselves freed by the caller
+*/
+void FreeOptions(OPTIONS *options) {
+  int iOpt;
+
+  for (iOpt = 0; iOpt < MODULEOPTEND; iOpt++) {
+    free(options[iOpt].iLine);
+    if (options[iOpt].cFile != caFileNull) {
+      free(options[iOpt].cFile);
+    }
+  }
+}
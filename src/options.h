@@ -30,6 +30,7 @@
 // Regular Options
 
 #define OPT_AGE 100
+#define OPT_ABSTOL 102
 #define OPT_ALBEDOGLOBAL 105
 
 #define OPT_BACK 110
@@ -40,8 +41,11 @@
 #define OPT_TIMESTEP 160
 #define OPT_VARDT 170
 #define OPT_BODYNAME 180
+#define OPT_ASYNCOUTPUT 181
 
+#define OPT_CHECKPOINTTIME 182
 #define OPT_COLOR 185
+#define OPT_DENSEOUTPUT 187
 
 #define OPT_DENSITY 190
 
@@ -69,6 +73,7 @@
 #define OPT_MASS 520
 #define OPT_MASSRAD 525
 #define OPT_MINVALUE 530
+#define OPT_NUMTHREADS 533
 
 #define OPT_ORBECC 535
 #define OPT_ORBMEANMOTION 540
@@ -85,6 +90,7 @@
 
 #define OPT_OUTDIGITS 570
 #define OPT_OUTPUTORDER 580
+#define OPT_OUTPUTFORMAT 582
 #define OPT_GRIDOUTPUT 585
 #define OPT_OUTSCINOT 590
 #define OPT_OVERWRITE 595
@@ -99,6 +105,7 @@
 #define OPT_COSOBL 645
 #define OPT_RADIUS 650
 #define OPT_RG 655
+#define OPT_RELTOL 657
 
 #define OPT_ROTPER 660
 #define OPT_ROTRATE 665
@@ -120,8 +127,15 @@
 /* @cond DOXYGEN_OVERRIDE */
 
 void GetWords(char cLine[], char[MAXARRAY][OPTLEN], int *, int *);
+void AddInputText(char[], char[]);
+void FreeInputTexts(void);
+FILE *fpOpenInput(char[]);
+int fbAddInputOption(char[], char[], char[]);
+void FreeInputTables(void);
 
 void InitializeOptions(OPTIONS *, fnReadOption *);
+void ResetOptions(OPTIONS *);
+void FreeOptions(OPTIONS *);
 void ReadOptions(BODY **, CONTROL *, FILES *, MODULE *, OPTIONS *, OUTPUT *,
                  SYSTEM *, UPDATE **, fnReadOption *, char[]);
 
@@ -135,6 +149,7 @@ void AddOptionInt(char[], char[], int *, int *, int);
 void AddOptionString(char[], char[], char[], int *, int);
 void AddOptionBool(char[], char[], int *, int *, int);
 void CheckDuplication(FILES *, OPTIONS *, char[], int, int);
+void SetOptionFile(OPTIONS *, int, char[]);
 void UpdateFoundOption(INFILE *, OPTIONS *, int, int);
 void UpdateFoundOptionMulti(INFILE *, OPTIONS *, int *, int, int);
 void AssignDefaultDouble(OPTIONS *, double *, int);
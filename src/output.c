@@ -1933,9 +1933,25 @@ void LogIntegration(CONTROL *control, FILE *fp) {
     fprintf(fp, "Euler");
   } else if (control->Evolve.iOneStep == RUNGEKUTTA) {
     fprintf(fp, "Runge-Kutta4");
+  } else if (control->Evolve.iOneStep == RK45) {
+    fprintf(fp, "RK45");
+  } else if (control->Evolve.iOneStep == ROSENBROCK) {
+    fprintf(fp, "Rosenbrock");
   }
   fprintf(fp, "\n");
 
+  if (control->Evolve.iOneStep == RK45 ||
+      control->Evolve.iOneStep == ROSENBROCK) {
+    fprintf(fp, "Relative Tolerance: ");
+    fprintd(fp, control->Evolve.dRelTol, control->Io.iSciNot,
+            control->Io.iDigits);
+    fprintf(fp, "\n");
+    fprintf(fp, "Absolute Tolerance: ");
+    fprintd(fp, control->Evolve.dAbsTol, control->Io.iSciNot,
+            control->Io.iDigits);
+    fprintf(fp, "\n");
+  }
+
   fprintf(fp, "Direction: ");
   if (control->Evolve.bDoBackward) {
     fprintf(fp, "Backward\n");
@@ -1994,7 +2010,7 @@ void LogBodyRelations(CONTROL *control, FILE *fp, int iBody) {
     } else {
       fprintf(fp, "Unknown!\n");
       fprintf(stderr, "Unknown Mass-Radius Relationship!\n");
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
   }
 }
@@ -2161,9 +2177,11 @@ void LogBody(BODY *body, CONTROL *control, FILES *files, MODULE *module,
 void WriteLog(BODY *body, CONTROL *control, FILES *files, MODULE *module,
               OPTIONS *options, OUTPUT *output, SYSTEM *system, UPDATE *update,
               fnUpdateVariable ***fnUpdate, fnWriteOutput fnWrite[], int iEnd) {
-  char cTime[OPTLEN];
+  char cTime[OPTLEN], *cMode;
   FILE *fp;
   double dDt, dTotTime;
+  char *cText = NULL;
+  size_t iLen = 0;
 
   /* Get derivatives */
   PropertiesAuxiliary(body, control, system, update);
@@ -2171,16 +2189,31 @@ void WriteLog(BODY *body, CONTROL *control, FILES *files, MODULE *module,
 
   if (iEnd == 0) {
     sprintf(cTime, "Input");
-    fp = fopen(files->cLog, "w");
+    cMode = "w";
   } else if (iEnd == 1) {
     sprintf(cTime, "Final");
-    fp = fopen(files->cLog, "a");
+    cMode = "a";
   } else if (iEnd == -1) {
     sprintf(cTime, "Initial");
-    fp = fopen(files->cLog, "w");
+    cMode = "w";
   } else {
     fprintf(stderr, "ERROR: Unknown cTime in output.c:WriteLog.\n");
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
+  }
+
+#ifndef VPLANET_ON_WINDOWS
+  if (control->Io.bStream) {
+    // Written to memory, then sent through the stream
+    fp = open_memstream(&cText, &iLen);
+  } else {
+    fp = fopen(files->cLog, cMode);
+  }
+#else
+  fp = fopen(files->cLog, cMode);
+#endif
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to write %s.\n", files->cLog);
+    VplanetExit(EXIT_WRITE);
   }
 
   if (!iEnd) {
@@ -2207,78 +2240,425 @@ void WriteLog(BODY *body, CONTROL *control, FILES *files, MODULE *module,
   }
   */
   fclose(fp);
+  if (cText != NULL) {
+    WriteContainerText(&control->Io, files->cLog, cText, (int)iLen);
+    // Allocated by the C library, not recorded by the run
+    (free)(cText);
+  }
+}
+
+/* Output files are opened at the first row and then kept open with a large
+   buffer until the run ends, rather than reopened for every row. With
+   bAsyncOutput the rows are written by the writer thread, so it must have
+   caught up before the files are flushed or closed. */
+
+FILE *fpOutputFile(FILE **pfp, char cFile[], char cMode[]) {
+  if (*pfp == NULL) {
+    *pfp = fopen(cFile, cMode);
+    if (*pfp == NULL) {
+      fprintf(stderr, "ERROR: Unable to open %s.\n", cFile);
+      VplanetExit(EXIT_WRITE);
+    }
+    setvbuf(*pfp, NULL, _IOFBF, OUTPUTBUFSIZE);
+  }
+  return *pfp;
+}
+
+void FlushOutputFiles(CONTROL *control, FILES *files) {
+  int iBody;
+
+  DrainWriter(control->Io.writer);
+  // A run that ends on an error may not have read its bodies yet
+  for (iBody = 0; files->Outfile != NULL && iBody < control->Evolve.iNumBodies;
+       iBody++) {
+    FlushChunk(&control->Io, files->Outfile[iBody].chunk);
+    FlushChunk(&control->Io, files->Outfile[iBody].chunkGrid);
+    if (files->Outfile[iBody].fp != NULL) {
+      fflush(files->Outfile[iBody].fp);
+    }
+    if (files->Outfile[iBody].fpGrid != NULL) {
+      fflush(files->Outfile[iBody].fpGrid);
+    }
+  }
+  if (control->Io.fpContainer != NULL) {
+    fflush(control->Io.fpContainer);
+  }
+}
+
+int fbCloseOutputFile(FILE **pfp) {
+  /* Close an output file, if open, and return whether any write to it,
+     including those of the writer thread and the final flush, failed. */
+  int bError;
+
+  if (*pfp == NULL) {
+    return 0;
+  }
+  bError = ferror(*pfp);
+  if (fclose(*pfp) != 0) {
+    bError = 1;
+  }
+  *pfp = NULL;
+  return bError;
+}
+
+void CloseOutputFiles(CONTROL *control, FILES *files) {
+  int iBody, bError = 0;
+
+  FlushOutputFiles(control, files);
+  StopWriter(&control->Io.writer);
+  for (iBody = 0; files->Outfile != NULL && iBody < control->Evolve.iNumBodies;
+       iBody++) {
+    FreeChunk(&files->Outfile[iBody].chunk);
+    FreeChunk(&files->Outfile[iBody].chunkGrid);
+    if (fbCloseOutputFile(&files->Outfile[iBody].fp)) {
+      fprintf(stderr, "ERROR: Unable to write %s.\n",
+              files->Outfile[iBody].cOut);
+      bError = 1;
+    }
+    if (fbCloseOutputFile(&files->Outfile[iBody].fpGrid)) {
+      fprintf(stderr, "ERROR: Unable to write the .Climate file of %s.\n",
+              files->Outfile[iBody].cOut);
+      bError = 1;
+    }
+  }
+  // The final log still goes through a stream, which CloseStream closes
+  if (!control->Io.bStream &&
+      fbCloseOutputFile(&control->Io.fpContainer)) {
+    fprintf(stderr, "ERROR: Unable to write %s.\n", control->Io.cContainer);
+    bError = 1;
+  }
+  if (bError) {
+    VplanetExit(EXIT_WRITE);
+  }
+}
+
+void CloseStream(CONTROL *control) {
+  if (control->Io.bStream && fbCloseOutputFile(&control->Io.fpContainer)) {
+    fprintf(stderr, "ERROR: Unable to write %s.\n", control->Io.cContainer);
+    VplanetExit(EXIT_WRITE);
+  }
+}
+
+/* Each output column is resolved once, after the modules have been verified,
+   to the output that writes it and to its position in the row. A column name
+   can begin with the name of another output, e.g. EqRotPerCont and EqRotPer,
+   so only the exact name is accepted. */
+
+void InitializeOutputColumns(CONTROL *control, FILES *files, OUTPUT *output) {
+  int iBody, iCol, iOut, iStart;
+  OUTFILE *outfile;
+
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    outfile = &files->Outfile[iBody];
+    iStart  = 0;
+    for (iCol = 0; iCol < outfile->iNumCols; iCol++) {
+      outfile->iaColOut[iCol]   = -1;
+      outfile->iaColStart[iCol] = iStart;
+      for (iOut = 0; iOut < MODULEOUTEND; iOut++) {
+        if ((output[iOut].bGrid == 0 || output[iOut].bGrid == 2) &&
+            strcmp(outfile->caCol[iCol], output[iOut].cName) == 0) {
+          outfile->iaColOut[iCol] = iOut;
+          break;
+        }
+      }
+      if (outfile->iaColOut[iCol] == -1) {
+        iStart++;
+      } else {
+        iStart += output[outfile->iaColOut[iCol]].iNum;
+      }
+    }
+    outfile->iNumRowValues = iStart;
+
+    for (iCol = 0; iCol < outfile->iNumGrid; iCol++) {
+      outfile->iaGridOut[iCol] = -1;
+      for (iOut = 0; iOut < MODULEOUTEND; iOut++) {
+        if ((output[iOut].bGrid == 1 || output[iOut].bGrid == 2) &&
+            strcmp(outfile->caGrid[iCol], output[iOut].cName) == 0) {
+          outfile->iaGridOut[iCol] = iOut;
+          break;
+        }
+      }
+    }
+  }
+}
+
+/* The columns of a binary file or a container chunk are described by a JSON
+   list of their names and units. The units are those the write functions
+   return, as in the log file. */
+
+char *sOutputColumns(BODY *body, CONTROL *control, OUTPUT *output,
+                     SYSTEM *system, UPDATE *update, fnWriteOutput *fnWrite,
+                     char caName[][OPTLEN], int *iaOut, int iNumCols,
+                     int iBody) {
+  int iCol, iOut, iSubOut, iLength = 0, iNumValues = 0;
+  double dTmp[NUMOPT];
+  char cUnit[OUTLEN], *cColumns;
+
+  for (iCol = 0; iCol < iNumCols; iCol++) {
+    iNumValues += (iaOut[iCol] == -1) ? 1 : output[iaOut[iCol]].iNum;
+  }
+  cColumns = malloc(iNumValues * (OPTLEN + OUTLEN + 32) + 3);
+
+  iLength += sprintf(cColumns + iLength, "[");
+  for (iCol = 0; iCol < iNumCols; iCol++) {
+    iOut     = iaOut[iCol];
+    cUnit[0] = '\0';
+    if (iOut == -1) {
+      iLength += sprintf(cColumns + iLength,
+                         "%s{\"name\": \"%s\", \"unit\": \"\"}",
+                         iLength > 1 ? ", " : "", caName[iCol]);
+      continue;
+    }
+    fnWrite[iOut](body, control, &output[iOut], system, &control->Units[iBody],
+                  update, iBody, dTmp, cUnit);
+    for (iSubOut = 0; iSubOut < output[iOut].iNum; iSubOut++) {
+      iLength += sprintf(cColumns + iLength,
+                         "%s{\"name\": \"%s\", \"unit\": \"%s\"}",
+                         iLength > 1 ? ", " : "", caName[iCol], cUnit);
+    }
+  }
+  sprintf(cColumns + iLength, "]");
+
+  return cColumns;
+}
+
+/* End a JSON line with spaces so that the float64 values that follow it are
+   aligned to 8 bytes. */
+
+void PadOutputLine(FILE *fp) {
+  long iLength;
+
+  iLength = ftell(fp) + 1;
+  while (iLength % sizeof(double) != 0) {
+    fprintf(fp, " ");
+    iLength++;
+  }
+  fprintf(fp, "\n");
+}
+
+/* A binary output file starts with the line OUTPUTBINARYMAGIC and a line of
+   JSON describing the columns, padded with spaces so that the rows that follow
+   are aligned to 8 bytes. Each row is then the columns as little-endian
+   doubles. */
+
+void WriteBinaryHeader(BODY *body, CONTROL *control, FILES *files,
+                       OUTPUT *output, SYSTEM *system, UPDATE *update,
+                       fnWriteOutput *fnWrite, FILE *fp, int iBody) {
+  char *cColumns;
+
+  cColumns = sOutputColumns(body, control, output, system, update, fnWrite,
+                            files->Outfile[iBody].caCol,
+                            files->Outfile[iBody].iaColOut,
+                            files->Outfile[iBody].iNumCols, iBody);
+  fprintf(fp, "%s\n", OUTPUTBINARYMAGIC);
+  fprintf(fp, "{\"body\": \"%s\", \"dtype\": \"<f8\", \"columns\": %s}",
+          body[iBody].cName, cColumns);
+  PadOutputLine(fp);
+  free(cColumns);
+}
+
+void WriteBinaryRow(FILE *fp, double *daRow, int iNumCols) {
+  int iCol, iByte, iOne = 1;
+  unsigned char *cValue, cSwapped[sizeof(double)];
+
+  if (*(char *)&iOne) {
+    fwrite(daRow, sizeof(double), iNumCols, fp);
+  } else {
+    for (iCol = 0; iCol < iNumCols; iCol++) {
+      cValue = (unsigned char *)&daRow[iCol];
+      for (iByte = 0; iByte < (int)sizeof(double); iByte++) {
+        cSwapped[iByte] = cValue[sizeof(double) - 1 - iByte];
+      }
+      fwrite(cSwapped, sizeof(double), 1, fp);
+    }
+  }
+}
+
+/* With sOutputFormat Container every output file becomes a dataset of the
+   single file <sSystemName>.container, which starts with the line
+   OUTPUTCONTAINERMAGIC. The rows of a dataset are appended in chunks, each a
+   padded line of JSON that names the file it replaces and gives the shape of
+   the little-endian doubles that follow, so a reader can skip from chunk to
+   chunk without reading the data. */
+
+static void WriteContainerHeader(IO *io, char cName[], char cDtype[],
+                                 char *cColumns, int iNumRows, int iNumCols) {
+  FILE *fp;
+
+  if (io->fpContainer == NULL) {
+    fp = fpOutputFile(&io->fpContainer, io->cContainer, "ab");
+    // A restarted run appends to the existing container
+    fseek(fp, 0, SEEK_END);
+    if (ftell(fp) == 0) {
+      fprintf(fp, "%s\n", OUTPUTCONTAINERMAGIC);
+    }
+    io->iContainerSize = ftell(fp);
+  }
+  fp = io->fpContainer;
+
+  io->iContainerSize += fprintf(
+        fp, "{\"dataset\": \"%s\", \"dtype\": \"%s\", \"shape\": [%d, %d]",
+        cName, cDtype, iNumRows, iNumCols);
+  if (cColumns != NULL) {
+    io->iContainerSize += fprintf(fp, ", \"columns\": %s", cColumns);
+  }
+  io->iContainerSize += fprintf(fp, "}");
+  // Pad as PadOutputLine does, counting the bytes as a pipe has no position
+  while ((io->iContainerSize + 1) % sizeof(double) != 0) {
+    io->iContainerSize += fprintf(fp, " ");
+  }
+  io->iContainerSize += fprintf(fp, "\n");
+}
+
+void WriteContainerChunk(IO *io, char cName[], char *cColumns, double *daRows,
+                         int iNumRows, int iNumCols) {
+  WriteContainerHeader(io, cName, "<f8", cColumns, iNumRows, iNumCols);
+  WriteBinaryRow(io->fpContainer, daRows, iNumRows * iNumCols);
+  io->iContainerSize += iNumRows * iNumCols * sizeof(double);
+}
+
+/* A streamed run has no log file, so the text of the log is sent as the bytes
+   of a dataset named after the log file. */
+
+void WriteContainerText(IO *io, char cName[], char *cText, int iLen) {
+  WriteContainerHeader(io, cName, "|u1", NULL, iLen, 1);
+  fwrite(cText, 1, iLen, io->fpContainer);
+  io->iContainerSize += iLen;
+}
+
+CHUNK *InitializeChunk(char cName[], char *cColumns, int iNumCols) {
+  CHUNK *chunk;
+
+  chunk = malloc(sizeof(CHUNK));
+  strcpy(chunk->cName, cName);
+  chunk->cColumns = cColumns;
+  chunk->iNumCols = iNumCols;
+  chunk->iNumRows = 0;
+  chunk->iMaxRows = OUTPUTCHUNKSIZE / (iNumCols * sizeof(double));
+  if (chunk->iMaxRows < 1) {
+    chunk->iMaxRows = 1;
+  }
+  chunk->daRows = malloc(chunk->iMaxRows * iNumCols * sizeof(double));
+
+  return chunk;
+}
+
+void AddChunkRow(IO *io, CHUNK *chunk, double *daRow) {
+  memcpy(&chunk->daRows[chunk->iNumRows * chunk->iNumCols], daRow,
+         chunk->iNumCols * sizeof(double));
+  chunk->iNumRows++;
+  if (chunk->iNumRows == chunk->iMaxRows) {
+    FlushChunk(io, chunk);
+  }
+}
+
+void FlushChunk(IO *io, CHUNK *chunk) {
+  if (chunk != NULL && chunk->iNumRows > 0) {
+    WriteContainerChunk(io, chunk->cName, chunk->cColumns, chunk->daRows,
+                        chunk->iNumRows, chunk->iNumCols);
+    chunk->iNumRows = 0;
+  }
+}
+
+void FreeChunk(CHUNK **pChunk) {
+  if (*pChunk != NULL) {
+    free((*pChunk)->cColumns);
+    free((*pChunk)->daRows);
+    free(*pChunk);
+    *pChunk = NULL;
+  }
 }
 
 void WriteOutput(BODY *body, CONTROL *control, FILES *files, OUTPUT *output,
                  SYSTEM *system, UPDATE *update, fnWriteOutput *fnWrite,
                  double dTime, double dDt) {
-  int iBody, iCol, iOut, iSubOut, iExtra = 0, iGrid, iLat, jBody, j;
-  double dCol[NUMOPT], *dTmp, dGrid[NUMOPT];
+  int iBody, iCol, iOut, iGrid, iLat, jBody, j;
+  double dCol[NUMOPT], dTmp[1], dGrid[NUMOPT];
   FILE *fp;
+  OUTFILE *outfile;
   char cUnit[OPTLEN], cPoiseGrid[3 * NAMELEN], cLaplaceFunc[3 * NAMELEN];
 
-  /* Write out all data columns for each body. As some data may span more than
-     1 column, we search the input list sequentially, adding iExtra to the
-     total number of columns as we go. The calls to fnWrite return the column
-     value in the correct units, and output.iNum already contains the
-     number of columns. */
+  /* Write out all data columns for each body. The outputs that write them
+     were found by InitializeOutputColumns, and as some data may span more
+     than 1 column, each one writes its values directly into the row starting
+     at iaColStart. The calls to fnWrite return the column value in the
+     correct units. */
 
   for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    outfile = &files->Outfile[iBody];
 
     // Need to get orbital elements for SpiNBody in case they're being output
     if (body[iBody].bSpiNBody) {
       Bary2OrbElems(body, iBody);
     }
 
-    for (iCol = 0; iCol < files->Outfile[iBody].iNumCols; iCol++) {
-      for (iOut = 0; iOut < MODULEOUTEND; iOut++) {
-        if (output[iOut].bGrid == 0 || output[iOut].bGrid == 2) {
-          if (memcmp(files->Outfile[iBody].caCol[iCol], output[iOut].cName,
-                     strlen(output[iOut].cName)) == 0) {
-            /* Match! */
-            dTmp = malloc(output[iOut].iNum * sizeof(double));
-            fnWrite[iOut](body, control, &output[iOut], system,
-                          &control->Units[iBody], update, iBody, dTmp, cUnit);
-            for (iSubOut = 0; iSubOut < output[iOut].iNum; iSubOut++) {
-              dCol[iCol + iSubOut + iExtra] = dTmp[iSubOut];
-            }
-            iExtra += (output[iOut].iNum - 1);
-            free(dTmp);
-            dTmp = NULL;
-          }
-        }
+    for (iCol = 0; iCol < outfile->iNumCols; iCol++) {
+      iOut = outfile->iaColOut[iCol];
+      if (iOut != -1) {
+        fnWrite[iOut](body, control, &output[iOut], system,
+                      &control->Units[iBody], update, iBody,
+                      &dCol[outfile->iaColStart[iCol]], cUnit);
       }
     }
 
     /* Now write the columns */
     if (files->Outfile[iBody].iNumCols > 0) {
-      fp = fopen(files->Outfile[iBody].cOut, "a");
-      for (iCol = 0; iCol < files->Outfile[iBody].iNumCols + iExtra; iCol++) {
-        // printf("%d %d\n",iBody,iCol);
-        // fflush(stdout);
-        fprintd(fp, dCol[iCol], control->Io.iSciNot, control->Io.iDigits);
-        fprintf(fp, " ");
+      if (control->Io.iOutputFormat == OUTPUTBINARY) {
+        if (files->Outfile[iBody].fp == NULL) {
+          fp = fpOutputFile(&files->Outfile[iBody].fp,
+                            files->Outfile[iBody].cOut, "ab");
+          // A restarted run appends to the existing header
+          fseek(fp, 0, SEEK_END);
+          if (ftell(fp) == 0) {
+            WriteBinaryHeader(body, control, files, output, system, update,
+                              fnWrite, fp, iBody);
+          }
+        }
+        if (control->Io.bAsyncOutput) {
+          PushWriterRow(&control->Io, files->Outfile[iBody].fp, dCol,
+                        outfile->iNumRowValues, OUTPUTBINARY);
+        } else {
+          WriteBinaryRow(files->Outfile[iBody].fp, dCol,
+                         outfile->iNumRowValues);
+        }
+      } else if (control->Io.iOutputFormat == OUTPUTCONTAINER) {
+        if (outfile->chunk == NULL) {
+          outfile->chunk = InitializeChunk(
+                outfile->cOut,
+                sOutputColumns(body, control, output, system, update, fnWrite,
+                               outfile->caCol, outfile->iaColOut,
+                               outfile->iNumCols, iBody),
+                outfile->iNumRowValues);
+        }
+        AddChunkRow(&control->Io, outfile->chunk, dCol);
+      } else {
+        fp = fpOutputFile(&files->Outfile[iBody].fp,
+                          files->Outfile[iBody].cOut, "a");
+        if (control->Io.bAsyncOutput) {
+          PushWriterRow(&control->Io, fp, dCol, outfile->iNumRowValues,
+                        OUTPUTTEXT);
+        } else {
+          for (iCol = 0; iCol < outfile->iNumRowValues; iCol++) {
+            // printf("%d %d\n",iBody,iCol);
+            // fflush(stdout);
+            fprintd(fp, dCol[iCol], control->Io.iSciNot, control->Io.iDigits);
+            fprintf(fp, " ");
+          }
+          fprintf(fp, "\n");
+        }
       }
-      fprintf(fp, "\n");
-      fclose(fp);
     }
 
     /* Grid outputs, currently only set up for POISE */
     if (body[iBody].bPoise) {
-      dTmp = malloc(1 * sizeof(double));
       for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-        for (iGrid = 0; iGrid < files->Outfile[iBody].iNumGrid; iGrid++) {
-          for (iOut = 0; iOut < MODULEOUTEND; iOut++) {
-            if (output[iOut].bGrid == 1 || output[iOut].bGrid == 2) {
-              if (memcmp(files->Outfile[iBody].caGrid[iGrid],
-                         output[iOut].cName, strlen(output[iOut].cName)) == 0) {
-                body[iBody].iWriteLat = iLat;
-                fnWrite[iOut](body, control, &output[iOut], system,
-                              &control->Units[iBody], update, iBody, dTmp,
-                              cUnit);
-                dGrid[iGrid] = *dTmp;
-              }
-            }
+        for (iGrid = 0; iGrid < outfile->iNumGrid; iGrid++) {
+          iOut = outfile->iaGridOut[iGrid];
+          if (iOut != -1) {
+            body[iBody].iWriteLat = iLat;
+            fnWrite[iOut](body, control, &output[iOut], system,
+                          &control->Units[iBody], update, iBody, &dGrid[iGrid],
+                          cUnit);
           }
         }
         /* Now write the columns */
@@ -2287,44 +2667,41 @@ void WriteOutput(BODY *body, CONTROL *control, FILES *files, OUTPUT *output,
 
         if (control->Evolve.dTime == 0 && iLat == 0) {
           if (body[iBody].iClimateModel == SEA) {
-            WriteDailyInsol(body, control, &output[iOut], system,
+            WriteDailyInsol(body, control, output, system,
                             &control->Units[iBody], update, iBody, dTmp, cUnit);
-            WriteSeasonalTemp(body, control, &output[iOut], system,
+            WriteSeasonalTemp(body, control, output, system,
                               &control->Units[iBody], update, iBody, dTmp,
                               cUnit);
-            WriteSeasonalIceBalance(body, control, &output[iOut], system,
+            WriteSeasonalIceBalance(body, control, output, system,
                                     &control->Units[iBody], update, iBody, dTmp,
                                     cUnit);
-            WriteSeasonalFluxes(body, control, &output[iOut], system,
+            WriteSeasonalFluxes(body, control, output, system,
                                 &control->Units[iBody], update, iBody, dTmp,
                                 cUnit);
-            WritePlanckB(body, control, &output[iOut], system,
+            WritePlanckB(body, control, output, system,
                          &control->Units[iBody], update, iBody, dTmp, cUnit);
 
             if (body[iBody].dSeasOutputTime != 0) {
               body[iBody].dSeasNextOutput = body[iBody].dSeasOutputTime;
             }
           }
-          fp = fopen(cPoiseGrid, "w");
-        } else {
-          fp = fopen(cPoiseGrid, "a");
         }
 
         if (body[iBody].dSeasOutputTime != 0) {
           if (control->Evolve.dTime >= body[iBody].dSeasNextOutput &&
               iLat == 0) {
-            WriteDailyInsol(body, control, &output[iOut], system,
+            WriteDailyInsol(body, control, output, system,
                             &control->Units[iBody], update, iBody, dTmp, cUnit);
-            WriteSeasonalTemp(body, control, &output[iOut], system,
+            WriteSeasonalTemp(body, control, output, system,
                               &control->Units[iBody], update, iBody, dTmp,
                               cUnit);
-            WriteSeasonalIceBalance(body, control, &output[iOut], system,
+            WriteSeasonalIceBalance(body, control, output, system,
                                     &control->Units[iBody], update, iBody, dTmp,
                                     cUnit);
-            WriteSeasonalFluxes(body, control, &output[iOut], system,
+            WriteSeasonalFluxes(body, control, output, system,
                                 &control->Units[iBody], update, iBody, dTmp,
                                 cUnit);
-            WritePlanckB(body, control, &output[iOut], system,
+            WritePlanckB(body, control, output, system,
                          &control->Units[iBody], update, iBody, dTmp, cUnit);
 
             body[iBody].dSeasNextOutput =
@@ -2332,15 +2709,38 @@ void WriteOutput(BODY *body, CONTROL *control, FILES *files, OUTPUT *output,
           }
         }
 
-        for (iGrid = 0; iGrid < files->Outfile[iBody].iNumGrid + iExtra;
-             iGrid++) {
-          fprintd(fp, dGrid[iGrid], control->Io.iSciNot, control->Io.iDigits);
-          fprintf(fp, " ");
+        if (control->Io.iOutputFormat == OUTPUTCONTAINER) {
+          if (outfile->iNumGrid > 0) {
+            if (outfile->chunkGrid == NULL) {
+              outfile->chunkGrid = InitializeChunk(
+                    cPoiseGrid,
+                    sOutputColumns(body, control, output, system, update,
+                                   fnWrite, outfile->caGrid,
+                                   outfile->iaGridOut, outfile->iNumGrid,
+                                   iBody),
+                    outfile->iNumGrid);
+            }
+            AddChunkRow(&control->Io, outfile->chunkGrid, dGrid);
+          }
+        } else {
+          if (control->Evolve.dTime == 0 && iLat == 0) {
+            fp = fpOutputFile(&files->Outfile[iBody].fpGrid, cPoiseGrid, "w");
+          } else {
+            fp = fpOutputFile(&files->Outfile[iBody].fpGrid, cPoiseGrid, "a");
+          }
+          if (control->Io.bAsyncOutput) {
+            PushWriterRow(&control->Io, fp, dGrid, outfile->iNumGrid,
+                          OUTPUTTEXT);
+          } else {
+            for (iGrid = 0; iGrid < outfile->iNumGrid; iGrid++) {
+              fprintd(fp, dGrid[iGrid], control->Io.iSciNot,
+                      control->Io.iDigits);
+              fprintf(fp, " ");
+            }
+            fprintf(fp, "\n");
+          }
         }
-        fprintf(fp, "\n");
-        fclose(fp);
       }
-      free(dTmp);
     }
   }
 
@@ -2458,19 +2858,17 @@ void InitializeOutput(FILES *files, OUTPUT *output, fnWriteOutput fnWrite[]) {
 
   memset(files->cLog, '\0', NAMELEN);
 
+  /* Only the start of each string is written, so the entries of outputs no
+     module registers are hardly touched. */
   for (iOut = 0; iOut < MODULEOUTEND; iOut++) {
-    memset(output[iOut].cName, '\0', OPTLEN);
     sprintf(output[iOut].cName, "null");
     output[iOut].bGrid  = 0;
     output[iOut].bNeg   = 0; /* Is a negative option allowed */
     output[iOut].dNeg   = 1; /* Conversion factor for negative options */
     output[iOut].iNum   = 0; /* Number of parameters associated with option */
     output[iOut].bDoNeg = malloc(MAXFILES * sizeof(int));
-    memset(output[iOut].cDescr, '\0', OUTDESCR);
     sprintf(output[iOut].cDescr, "null");
-    memset(output[iOut].cLongDescr, '\0', OUTLONDESCR);
     sprintf(output[iOut].cLongDescr, "null");
-    memset(output[iOut].cNeg, '\0', OUTDESCR);
     sprintf(output[iOut].cNeg, "null");
     for (iBody = 0; iBody < MAXFILES; iBody++) {
       output[iOut].bDoNeg[iBody] = 0;
@@ -2507,3 +2905,16 @@ void InitializeOutput(FILES *files, OUTPUT *output, fnWriteOutput fnWrite[]) {
   }
   */
 }
+
+/**
+Free what InitializeOutput allocated for each output.
+
+@param output Outputs, themselves freed by the caller
+*/
+void FreeOutput(OUTPUT *output) {
+  int iOut;
+
+  for (iOut = 0; iOut < MODULEOUTEND; iOut++) {
+    free(output[iOut].bDoNeg);
+  }
+}
@@ -21,6 +21,19 @@
 #define EXIT_INT 5
 #define EXIT_OUTPUT 6
 
+/* Buffer of each output file, which is kept open for the whole run */
+#define OUTPUTBUFSIZE 1048576
+
+/* Output file formats */
+#define OUTPUTTEXT 0
+#define OUTPUTBINARY 1
+#define OUTPUTBINARYMAGIC "VPLANET BINARY 1"
+#define OUTPUTCONTAINER 2
+#define OUTPUTCONTAINERMAGIC "VPLANET CONTAINER 1"
+
+/* Bytes of rows collected before a chunk is appended to the container */
+#define OUTPUTCHUNKSIZE 65536
+
 /* Verbosity Level */
 
 #define VERBERR 1
@@ -122,6 +135,25 @@ void WriteOutput(BODY *, CONTROL *, FILES *, OUTPUT *, SYSTEM *, UPDATE *,
 void WriteLog(BODY *, CONTROL *, FILES *, MODULE *, OPTIONS *, OUTPUT *,
               SYSTEM *, UPDATE *, fnUpdateVariable ***, fnWriteOutput *, int);
 void InitializeOutput(FILES*,OUTPUT *, fnWriteOutput *);
+void FreeOutput(OUTPUT *);
+FILE *fpOutputFile(FILE **, char[], char[]);
+void InitializeOutputColumns(CONTROL *, FILES *, OUTPUT *);
+void FlushOutputFiles(CONTROL *, FILES *);
+int fbCloseOutputFile(FILE **);
+void CloseOutputFiles(CONTROL *, FILES *);
+void CloseStream(CONTROL *);
+char *sOutputColumns(BODY *, CONTROL *, OUTPUT *, SYSTEM *, UPDATE *,
+                     fnWriteOutput *, char[][OPTLEN], int *, int, int);
+void PadOutputLine(FILE *);
+void WriteBinaryHeader(BODY *, CONTROL *, FILES *, OUTPUT *, SYSTEM *, UPDATE *,
+                       fnWriteOutput *, FILE *, int);
+void WriteBinaryRow(FILE *, double *, int);
+void WriteContainerChunk(IO *, char[], char *, double *, int, int);
+void WriteContainerText(IO *, char[], char *, int);
+CHUNK *InitializeChunk(char[], char *, int);
+void AddChunkRow(IO *, CHUNK *, double *);
+void FlushChunk(IO *, CHUNK *);
+void FreeChunk(CHUNK **);
 void WriteTime(BODY *, CONTROL *, OUTPUT *, SYSTEM *, UNITS *, UPDATE *, int,
                double *, char[]);
 
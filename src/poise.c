@@ -1123,6 +1123,48 @@ void ReadMinIceSheetHeight(BODY *body, CONTROL *control, FILES *files,
   }
 }
 
+void ReadInsolTol(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
+                  SYSTEM *system, int iFile) {
+  /* This parameter cannot exist in primary file */
+  int lTmp = -1;
+  double dTmp;
+
+  AddOptionDouble(files->Infile[iFile].cIn, options->cName, &dTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    if (dTmp < 0) {
+      fprintf(stderr, "ERROR: %s must be non-negative.\n", options->cName);
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    body[iFile - 1].dInsolTol = dTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    if (iFile > 0) {
+      body[iFile - 1].dInsolTol = options->dDefault;
+    }
+  }
+}
+
+void ReadSeasConverge(BODY *body, CONTROL *control, FILES *files,
+                      OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter cannot exist in primary file */
+  int lTmp = -1, bTmp;
+
+  AddOptionBool(files->Infile[iFile].cIn, options->cName, &bTmp, &lTmp,
+                control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    body[iFile - 1].bSeasConverge = bTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultInt(options, &body[iFile - 1].bSeasConverge,
+                     files->iNumInputs);
+  }
+}
+
 void InitializeOptionsPoise(OPTIONS *options, fnReadOption fnRead[]) {
   sprintf(options[OPT_LATCELLNUM].cName, "iLatCellNum");
   sprintf(options[OPT_LATCELLNUM].cDescr, "Number of latitude cells used in"
@@ -1630,6 +1672,39 @@ void InitializeOptionsPoise(OPTIONS *options, fnReadOption fnRead[]) {
           "reasons. Parameter forces unphysically small values of the ice "
           "height\n"
           "to be ignored.\n");
+
+  sprintf(options[OPT_INSOLTOL].cName, "dInsolTol");
+  sprintf(options[OPT_INSOLTOL].cDescr, "Change in the orbit below which"
+                                        " insolation is not recomputed");
+  sprintf(options[OPT_INSOLTOL].cDefault, "0");
+  sprintf(options[OPT_INSOLTOL].cDimension, "nd");
+  options[OPT_INSOLTOL].dDefault   = 0;
+  options[OPT_INSOLTOL].iType      = 2;
+  options[OPT_INSOLTOL].bMultiFile = 1;
+  fnRead[OPT_INSOLTOL]             = &ReadInsolTol;
+  sprintf(options[OPT_INSOLTOL].cLongDescr,
+          "The insolation at each latitude and day is only recomputed when\n"
+          "the obliquity, eccentricity or longitude of pericenter has changed\n"
+          "by more than this amount (radians for the angles), or the\n"
+          "semi-major axis or stellar luminosity has changed by more than\n"
+          "this fraction, since it was last computed. With the default of 0\n"
+          "it is reused only if none of them has changed at all.\n");
+
+  sprintf(options[OPT_SEASCONVERGE].cName, "bSeasConverge");
+  sprintf(options[OPT_SEASCONVERGE].cDescr, "Stop the seasonal model once"
+                                            " its annual means settle?");
+  sprintf(options[OPT_SEASCONVERGE].cDefault, "0");
+  options[OPT_SEASCONVERGE].dDefault   = 0;
+  options[OPT_SEASCONVERGE].iType      = 0;
+  options[OPT_SEASCONVERGE].bMultiFile = 1;
+  fnRead[OPT_SEASCONVERGE]             = &ReadSeasConverge;
+  sprintf(options[OPT_SEASCONVERGE].cLongDescr,
+          "If set, the seasonal model stops before iNumYears orbits once the\n"
+          "annual mean land and water temperatures at every latitude change\n"
+          "by less than dSpinUpTol from one orbit to the next. The first\n"
+          "orbit is compared with the last orbit of the previous call, so a\n"
+          "climate that is already settled runs a single orbit. The daily\n"
+          "arrays of the orbits not run repeat the last one.\n");
 }
 
 void ReadOptionsPoise(BODY *body, CONTROL *control, FILES *files,
@@ -1662,7 +1737,7 @@ void VerifyAlbedo(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 options[OPT_COLDSTART].cName, options[OPT_FIXICELAT].cName,
                 options[OPT_ALBEDOZA].cName, cFile);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
 
@@ -1678,7 +1753,7 @@ void VerifyAlbedo(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 options[OPT_COLDSTART].cName, options[OPT_FIXICELAT].cName,
                 cFile);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
 
@@ -1693,7 +1768,7 @@ void VerifyAlbedo(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 options[OPT_COLDSTART].cName, options[OPT_ALBEDOZA].cName,
                 cFile);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
 
@@ -1708,7 +1783,7 @@ void VerifyAlbedo(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 options[OPT_FIXICELAT].cName, options[OPT_ALBEDOZA].cName,
                 cFile);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
 
@@ -1722,7 +1797,7 @@ void VerifyAlbedo(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 options[OPT_ALBEDOLAND].cName, options[OPT_ALBEDOWATER].cName,
                 cFile, options[OPT_SURFALBEDO].cName);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
 
@@ -1735,7 +1810,7 @@ void VerifyAlbedo(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 options[OPT_SURFALBEDO].cName, cFile,
                 options[OPT_ALBEDOLAND].cName, options[OPT_ALBEDOWATER].cName);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
   }
@@ -1749,7 +1824,7 @@ void VerifyIceSheets(BODY *body, OPTIONS *options, char cFile[], int iBody,
       fprintf(stderr, "ERROR: Cannot set %s in annual model in File:%s\n",
               options[OPT_ICESHEETS].cName, cFile);
     }
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
     // LCOV_EXCL_STOP
   }
 }
@@ -1765,7 +1840,7 @@ void VerifyOLR(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 in File:%s\n",
                 options[OPT_PLANCKA].cName, options[OPT_PLANCKB].cName, cFile);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
 
@@ -1777,7 +1852,7 @@ void VerifyOLR(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 in File:%s\n",
                 options[OPT_PCO2].cName, cFile);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
   }
@@ -1794,12 +1869,12 @@ void VerifyOrbitOblData(BODY *body, CONTROL *control, OPTIONS *options,
       fprintf(stderr, "ERROR: Must set %s if using %s for file %s\n",
               options[OPT_FILEORBITOBLDATA].cName,
               options[OPT_READORBITOBLDATA].cName, body[iBody].cName);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     } else {
       fileorb = fopen(body[iBody].cFileOrbitOblData, "r");
       if (fileorb == NULL) {
         printf("ERROR: File %s not found.\n", body[iBody].cFileOrbitOblData);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
       iNLines = 0;
       while ((c = getc(fileorb)) != EOF) {
@@ -1860,7 +1935,7 @@ void VerifyOrbitOblData(BODY *body, CONTROL *control, OPTIONS *options,
       fprintf(stderr,
               "ERROR: Cannot use variable time step (%s = 1) if %s = 1\n",
               options[OPT_VARDT].cName, options[OPT_READORBITDATA].cName);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
     if (control->Evolve.bDoForward) {
       if (body[iBody].daTimeSeries[1] != control->Evolve.dTimeStep) {
@@ -1868,7 +1943,7 @@ void VerifyOrbitOblData(BODY *body, CONTROL *control, OPTIONS *options,
                 "ERROR: Time step size (%s = 1) must match orbital data if %s "
                 "= 1\n",
                 options[OPT_TIMESTEP].cName, options[OPT_READORBITDATA].cName);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
     } else if (control->Evolve.bDoBackward) {
       if (body[iBody].daTimeSeries[1] != -1 * control->Evolve.dTimeStep) {
@@ -1876,7 +1951,7 @@ void VerifyOrbitOblData(BODY *body, CONTROL *control, OPTIONS *options,
                 "ERROR: Time step size (%s = 1) must match orbital data if %s "
                 "= 1\n",
                 options[OPT_TIMESTEP].cName, options[OPT_READORBITDATA].cName);
-        exit(EXIT_INPUT);
+        VplanetExit(EXIT_INPUT);
       }
     }
     if (iNLines < (control->Evolve.dStopTime / control->Evolve.dTimeStep + 1)) {
@@ -1884,7 +1959,7 @@ void VerifyOrbitOblData(BODY *body, CONTROL *control, OPTIONS *options,
               "ERROR: Input orbit data must at least as long as vplanet "
               "integration (%f years)\n",
               control->Evolve.dStopTime / YEARSEC);
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
     }
   }
 }
@@ -1900,12 +1975,19 @@ void InitializeLatGrid(BODY *body, int iBody) {
   int iLats;
   dDelta_x = 2.0 / body[iBody].iNumLats;
 
-  body[iBody].daLats = malloc(body[iBody].iNumLats * sizeof(double));
+  body[iBody].daLats   = malloc(body[iBody].iNumLats * sizeof(double));
+  body[iBody].daSinLat = malloc(body[iBody].iNumLats * sizeof(double));
+  body[iBody].daCosLat = malloc(body[iBody].iNumLats * sizeof(double));
+  body[iBody].daTanLat = malloc(body[iBody].iNumLats * sizeof(double));
 
   for (iLats = 0; iLats < body[iBody].iNumLats; iLats++) {
-    SinLat                    = (-1.0 + dDelta_x / 2.) + iLats * dDelta_x;
-    body[iBody].daLats[iLats] = asin(SinLat);
+    SinLat                      = (-1.0 + dDelta_x / 2.) + iLats * dDelta_x;
+    body[iBody].daLats[iLats]   = asin(SinLat);
+    body[iBody].daSinLat[iLats] = sin(body[iBody].daLats[iLats]);
+    body[iBody].daCosLat[iLats] = cos(body[iBody].daLats[iLats]);
+    body[iBody].daTanLat[iLats] = tan(body[iBody].daLats[iLats]);
   }
+  body[iBody].bInsolCached = 0;
 }
 
 void InitializeLandWater(BODY *body, int iBody) {
@@ -2034,16 +2116,13 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
     body[iBody].daPlanckBAnn = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daMClim      = malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].daMEulerAnn  = malloc(body[iBody].iNumLats * sizeof(double *));
-    body[iBody].daMEulerCopyAnn =
-          malloc(body[iBody].iNumLats * sizeof(double *));
-    body[iBody].daInvMAnn    = malloc(body[iBody].iNumLats * sizeof(double *));
+    body[iBody].daMBandAnn   = malloc(body[iBody].iNumLats * sizeof(double *));
+    body[iBody].daMLowerAnn  = malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].daSourceF    = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daTempTerms  = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daTmpTempAnn = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daTmpTempTerms = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].iaRowswapAnn   = malloc(body[iBody].iNumLats * sizeof(int));
-    body[iBody].daScaleAnn     = malloc(body[iBody].iNumLats * sizeof(double));
-    body[iBody].daUnitVAnn     = malloc(body[iBody].iNumLats * sizeof(double));
 
     body[iBody].daDiffusionAnn[0] = body[iBody].dDiffCoeff;
     for (iLat = 0; iLat <= body[iBody].iNumLats; iLat++) {
@@ -2061,21 +2140,27 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
               malloc(body[iBody].iNumLats * sizeof(double));
         body[iBody].daMEulerAnn[iLat] =
               malloc(body[iBody].iNumLats * sizeof(double));
-        body[iBody].daMEulerCopyAnn[iLat] =
-              malloc(body[iBody].iNumLats * sizeof(double));
-        body[iBody].daInvMAnn[iLat] =
-              malloc(body[iBody].iNumLats * sizeof(double));
-      }
+        body[iBody].daMBandAnn[iLat] =
+              malloc((2 * ANNBAND + 1) * sizeof(double));
+        body[iBody].daMLowerAnn[iLat] = malloc(ANNBAND * sizeof(double));
 
-      if (body[iBody].bCalcAB) {
-        /* Calculate A and B from williams and kasting 97 result */
-        body[iBody].daPlanckBAnn[iLat] = fdOLRdTwk97(body, iBody, iLat, ANN);
-        body[iBody].daPlanckAAnn[iLat] =
-              fdOLRwk97(body, iBody, iLat, ANN) -
-              body[iBody].daPlanckBAnn[iLat] * (body[iBody].daTempAnn[iLat]);
-      } else {
-        body[iBody].daPlanckBAnn[iLat] = body[iBody].dPlanckB;
-        body[iBody].daPlanckAAnn[iLat] = body[iBody].dPlanckA;
+        /* Only the band is set by fvMatrixAnnual */
+        for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
+          body[iBody].daMClim[iLat][jLat]     = 0.;
+          body[iBody].daMDiffAnn[iLat][jLat]  = 0.;
+          body[iBody].daMEulerAnn[iLat][jLat] = 0.;
+        }
+
+        if (body[iBody].bCalcAB) {
+          /* Calculate A and B from williams and kasting 97 result */
+          body[iBody].daPlanckBAnn[iLat] = fdOLRdTwk97(body, iBody, iLat, ANN);
+          body[iBody].daPlanckAAnn[iLat] =
+                fdOLRwk97(body, iBody, iLat, ANN) -
+                body[iBody].daPlanckBAnn[iLat] * (body[iBody].daTempAnn[iLat]);
+        } else {
+          body[iBody].daPlanckBAnn[iLat] = body[iBody].dPlanckB;
+          body[iBody].daPlanckAAnn[iLat] = body[iBody].dPlanckA;
+        }
       }
 
       if (body[iBody].bMEPDiff) {
@@ -2159,10 +2244,11 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
     body[iBody].daSeaIceHeight = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daMEulerSea =
           malloc(2 * body[iBody].iNumLats * sizeof(double *));
-    body[iBody].daMEulerCopySea =
+    body[iBody].daMBandSea =
+          malloc(2 * body[iBody].iNumLats * sizeof(double *));
+    body[iBody].daMLowerSea =
           malloc(2 * body[iBody].iNumLats * sizeof(double *));
-    body[iBody].daMInit   = malloc(2 * body[iBody].iNumLats * sizeof(double *));
-    body[iBody].daInvMSea = malloc(2 * body[iBody].iNumLats * sizeof(double *));
+    body[iBody].daMInit = malloc(2 * body[iBody].iNumLats * sizeof(double *));
     body[iBody].daSourceL = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daSourceW = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daSourceLW = malloc(2 * body[iBody].iNumLats * sizeof(double));
@@ -2170,8 +2256,6 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
     body[iBody].daMWater   = malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].daMDiffSea = malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].iaRowswapSea = malloc(2 * body[iBody].iNumLats * sizeof(int));
-    body[iBody].daScaleSea = malloc(2 * body[iBody].iNumLats * sizeof(double));
-    body[iBody].daUnitVSea = malloc(2 * body[iBody].iNumLats * sizeof(double));
     body[iBody].daAlbedoLand  = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daAlbedoWater = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daLambdaSea =
@@ -2195,6 +2279,9 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
     body[iBody].daAlbedoAvgL   = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daTempAvgW     = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daAlbedoAvgW   = malloc(body[iBody].iNumLats * sizeof(double));
+    body[iBody].daTempPrevL    = malloc(body[iBody].iNumLats * sizeof(double));
+    body[iBody].daTempPrevW    = malloc(body[iBody].iNumLats * sizeof(double));
+    body[iBody].bTempAvgPrev   = 0;
     body[iBody].daFluxAvg      = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daFluxDaily   = malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].daFluxInAvg   = malloc(body[iBody].iNumLats * sizeof(double));
@@ -2304,18 +2391,17 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
               malloc(2 * body[iBody].iNumLats * sizeof(double));
         body[iBody].daMInit[2 * iLat] =
               malloc(2 * body[iBody].iNumLats * sizeof(double));
-        body[iBody].daMEulerCopySea[2 * iLat] =
-              malloc(2 * body[iBody].iNumLats * sizeof(double));
-        body[iBody].daInvMSea[2 * iLat] =
-              malloc(2 * body[iBody].iNumLats * sizeof(double));
+        body[iBody].daMBandSea[2 * iLat] =
+              malloc((2 * SEABAND + 1) * sizeof(double));
+        body[iBody].daMLowerSea[2 * iLat] = malloc(SEABAND * sizeof(double));
         body[iBody].daMEulerSea[2 * iLat + 1] =
               malloc(2 * body[iBody].iNumLats * sizeof(double));
         body[iBody].daMInit[2 * iLat + 1] =
               malloc(2 * body[iBody].iNumLats * sizeof(double));
-        body[iBody].daMEulerCopySea[2 * iLat + 1] =
-              malloc(2 * body[iBody].iNumLats * sizeof(double));
-        body[iBody].daInvMSea[2 * iLat + 1] =
-              malloc(2 * body[iBody].iNumLats * sizeof(double));
+        body[iBody].daMBandSea[2 * iLat + 1] =
+              malloc((2 * SEABAND + 1) * sizeof(double));
+        body[iBody].daMLowerSea[2 * iLat + 1] =
+              malloc(SEABAND * sizeof(double));
 
         body[iBody].daIceMassTmp[iLat]    = 0.0;
         body[iBody].daIceBalanceAvg[iLat] = 0.0;
@@ -2325,15 +2411,15 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
         body[iBody].daIceHeight[iLat]     = 0.0;
         body[iBody].daDIceHeightDy[iLat]  = 0.0;
 
-        body[iBody].daScaleSea[2 * iLat]     = 0.;
-        body[iBody].daScaleSea[2 * iLat + 1] = 0.;
         for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-          body[iBody].daMInit[2 * iLat][jLat]             = 0.;
-          body[iBody].daMEulerSea[2 * iLat][jLat]         = 0.;
-          body[iBody].daMEulerCopySea[2 * iLat][jLat]     = 0.;
-          body[iBody].daMInit[2 * iLat + 1][jLat]         = 0.;
-          body[iBody].daMEulerSea[2 * iLat + 1][jLat]     = 0.;
-          body[iBody].daMEulerCopySea[2 * iLat + 1][jLat] = 0.;
+          body[iBody].daMInit[2 * iLat][jLat]         = 0.;
+          body[iBody].daMEulerSea[2 * iLat][jLat]     = 0.;
+          body[iBody].daMInit[2 * iLat + 1][jLat]     = 0.;
+          body[iBody].daMEulerSea[2 * iLat + 1][jLat] = 0.;
+        }
+        for (jLat = 0; jLat < 2 * SEABAND + 1; jLat++) {
+          body[iBody].daMBandSea[2 * iLat][jLat]     = 0.;
+          body[iBody].daMBandSea[2 * iLat + 1][jLat] = 0.;
         }
 
         if (body[iBody].bIceSheets) {
@@ -2492,7 +2578,7 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
             fprintf(stderr,"ERROR: Initial climate state failed to
         converge.\n");
           }
-          exit(EXIT_INPUT);
+          VplanetExit(EXIT_INPUT);
         }
         */
       }
@@ -2522,7 +2608,7 @@ void VerifyAstro(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 %s\n",
                 options[OPT_FORCEOBLIQ].cName, cFile);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     } else {
       body[iBody].dObliq0 = body[iBody].dObliquity;
@@ -2542,7 +2628,7 @@ void VerifyAstro(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 %s\n",
                 options[OPT_FORCEECC].cName, cFile);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     } else {
       body[iBody].dEcc0 = body[iBody].dEcc;
@@ -2575,7 +2661,7 @@ void VerifyDiffusion(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 "File:%s\n",
                 options[OPT_DIFFUSION].cName, cFile);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
     if (body[iBody].bHadley) {
@@ -2586,7 +2672,7 @@ void VerifyDiffusion(BODY *body, OPTIONS *options, char cFile[], int iBody,
                 "in File:%s\n",
                 cFile);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
   }
@@ -2604,7 +2690,7 @@ void VerifySeasOutputTime(BODY *body, CONTROL *control, OPTIONS *options,
                 options[OPT_SEASOUTPUTTIME].cName, cFile,
                 options[OPT_OUTPUTTIME].cName);
       }
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
   }
@@ -3328,68 +3414,48 @@ void WritePeakInsol(BODY *body, CONTROL *control, OUTPUT *output,
   }
 }
 
-void WriteDailyInsol(BODY *body, CONTROL *control, OUTPUT *output,
-                     SYSTEM *system, UNITS *units, UPDATE *update, int iBody,
-                     double *dTmp, char cUnit[]) {
-
-  char cOut[3 * NAMELEN];
-  FILE *fp;
-  int iLat, iDay;
-  double dTime;
+/* Write the seasonal snapshot daMatrix[iLat][iDay] with one day per row to
+   SeasonalClimateFiles/<sSystemName>.<Body>.<cQuantity>.<Time>, or to the
+   container as a dataset of that name. */
 
-  struct stat st = {0};
-  if (stat("SeasonalClimateFiles", &st) == -1) {
+void WriteSeasonalMatrix(BODY *body, CONTROL *control, SYSTEM *system,
+                         UNITS *units, int iBody, char cQuantity[],
+                         double **daMatrix, int iNumDays) {
 
-#ifdef _WIN32
-    mkdir("SeasonalClimateFiles");
-#else
-    mkdir("SeasonalClimateFiles", 0700);
-#endif
-  }
+  char cName[3 * NAMELEN], cOut[4 * NAMELEN];
+  FILE *fp;
+  int iLat, iDay, iNumLats = body[iBody].iNumLats;
+  double dTime, *daRows;
 
   dTime = control->Evolve.dTime / fdUnitsTime(units->iTime);
 
   if (dTime == 0) {
 
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.DailyInsol.0", system->cName,
-            body[iBody].cName);
+    sprintf(cName, "%s.%s.%s.0", system->cName, body[iBody].cName, cQuantity);
 
   } else if (dTime < 10000) {
 
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.DailyInsol.%.0f", system->cName,
-            body[iBody].cName, dTime);
+    sprintf(cName, "%s.%s.%s.%.0f", system->cName, body[iBody].cName,
+            cQuantity, dTime);
 
   } else {
 
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.DailyInsol.%.2e", system->cName,
-            body[iBody].cName, dTime);
+    sprintf(cName, "%s.%s.%s.%.2e", system->cName, body[iBody].cName,
+            cQuantity, dTime);
   }
 
-  fp = fopen(cOut, "w");
-  for (iDay = 0; iDay < body[iBody].iNDays; iDay++) {
-
-    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-
-      fprintd(fp, body[iBody].daInsol[iLat][iDay], control->Io.iSciNot,
-              control->Io.iDigits);
-      fprintf(fp, " ");
+  if (control->Io.iOutputFormat == OUTPUTCONTAINER) {
+    daRows = malloc(iNumDays * iNumLats * sizeof(double));
+    for (iDay = 0; iDay < iNumDays; iDay++) {
+      for (iLat = 0; iLat < iNumLats; iLat++) {
+        daRows[iDay * iNumLats + iLat] = daMatrix[iLat][iDay];
+      }
     }
-
-    fprintf(fp, "\n");
+    WriteContainerChunk(&control->Io, cName, NULL, daRows, iNumDays, iNumLats);
+    free(daRows);
+    return;
   }
 
-  fclose(fp);
-}
-
-void WritePlanckB(BODY *body, CONTROL *control, OUTPUT *output, SYSTEM *system,
-                  UNITS *units, UPDATE *update, int iBody, double *dTmp,
-                  char cUnit[]) {
-
-  char cOut[3 * NAMELEN];
-  FILE *fp;
-  int iLat, iDay;
-  double dTime;
-
   struct stat st = {0};
   if (stat("SeasonalClimateFiles", &st) == -1) {
 
@@ -3400,31 +3466,13 @@ void WritePlanckB(BODY *body, CONTROL *control, OUTPUT *output, SYSTEM *system,
 #endif
   }
 
-  dTime = control->Evolve.dTime / fdUnitsTime(units->iTime);
-
-  if (dTime == 0) {
-
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.PlanckB.0", system->cName,
-            body[iBody].cName);
-
-  } else if (dTime < 10000) {
-
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.PlanckB.%.0f", system->cName,
-            body[iBody].cName, dTime);
-
-  } else {
-
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.PlanckB.%.2e", system->cName,
-            body[iBody].cName, dTime);
-  }
-
+  sprintf(cOut, "SeasonalClimateFiles/%s", cName);
   fp = fopen(cOut, "w");
-  for (iDay = 0; iDay < body[iBody].iNumYears * body[iBody].iNStepInYear;
-       iDay++) {
+  for (iDay = 0; iDay < iNumDays; iDay++) {
 
-    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    for (iLat = 0; iLat < iNumLats; iLat++) {
 
-      fprintd(fp, body[iBody].daPlanckBDaily[iLat][iDay], control->Io.iSciNot,
+      fprintd(fp, daMatrix[iLat][iDay], control->Io.iSciNot,
               control->Io.iDigits);
       fprintf(fp, " ");
     }
@@ -3435,210 +3483,54 @@ void WritePlanckB(BODY *body, CONTROL *control, OUTPUT *output, SYSTEM *system,
   fclose(fp);
 }
 
-void WriteSeasonalTemp(BODY *body, CONTROL *control, OUTPUT *output,
-                       SYSTEM *system, UNITS *units, UPDATE *update, int iBody,
-                       double *dTmp, char cUnit[]) {
-
-  char cOut[3 * NAMELEN];
-  FILE *fp;
-  int iLat, iDay;
-  double dTime;
-
-  struct stat st = {0};
-  if (stat("SeasonalClimateFiles", &st) == -1) {
-
-#ifdef _WIN32
-    mkdir("SeasonalClimateFiles");
-#else
-    mkdir("SeasonalClimateFiles", 0700);
-#endif
-  }
-
-  dTime = control->Evolve.dTime / fdUnitsTime(units->iTime);
-
-  if (dTime == 0) {
-
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.SeasonalTemp.0", system->cName,
-            body[iBody].cName);
-
-  } else if (dTime < 10000) {
-
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.SeasonalTemp.%.0f", system->cName,
-            body[iBody].cName, dTime);
-
-  } else {
-
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.SeasonalTemp.%.2e", system->cName,
-            body[iBody].cName, dTime);
-  }
+void WriteDailyInsol(BODY *body, CONTROL *control, OUTPUT *output,
+                     SYSTEM *system, UNITS *units, UPDATE *update, int iBody,
+                     double *dTmp, char cUnit[]) {
 
-  fp = fopen(cOut, "w");
-  for (iDay = 0; iDay < body[iBody].iNumYears * body[iBody].iNStepInYear;
-       iDay++) {
+  WriteSeasonalMatrix(body, control, system, units, iBody, "DailyInsol",
+                      body[iBody].daInsol, body[iBody].iNDays);
+}
 
-    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+void WritePlanckB(BODY *body, CONTROL *control, OUTPUT *output, SYSTEM *system,
+                  UNITS *units, UPDATE *update, int iBody, double *dTmp,
+                  char cUnit[]) {
 
-      // printf("%d %d\n",iLat,iDay);
-      // printf("%d %d %lf\n",iLat,iDay,body[iBody].daTempDaily[iLat][iDay]);
-      fprintd(fp, body[iBody].daTempDaily[iLat][iDay], control->Io.iSciNot,
-              control->Io.iDigits);
-      fprintf(fp, " ");
-    }
+  WriteSeasonalMatrix(body, control, system, units, iBody, "PlanckB",
+                      body[iBody].daPlanckBDaily,
+                      body[iBody].iNumYears * body[iBody].iNStepInYear);
+}
 
-    fprintf(fp, "\n");
-  }
+void WriteSeasonalTemp(BODY *body, CONTROL *control, OUTPUT *output,
+                       SYSTEM *system, UNITS *units, UPDATE *update, int iBody,
+                       double *dTmp, char cUnit[]) {
 
-  fclose(fp);
+  WriteSeasonalMatrix(body, control, system, units, iBody, "SeasonalTemp",
+                      body[iBody].daTempDaily,
+                      body[iBody].iNumYears * body[iBody].iNStepInYear);
 }
 
 void WriteSeasonalFluxes(BODY *body, CONTROL *control, OUTPUT *output,
                          SYSTEM *system, UNITS *units, UPDATE *update,
                          int iBody, double *dTmp, char cUnit[]) {
+  int iNumDays = body[iBody].iNumYears * body[iBody].iNStepInYear;
 
-  char cOutM[3 * NAMELEN], cOutI[3 * NAMELEN], cOutO[3 * NAMELEN],
-        cOutD[3 * NAMELEN];
-  FILE *fpM, *fpI, *fpO, *fpD;
-  int iLat, iDay;
-  double dTime;
-
-  struct stat st = {0};
-  if (stat("SeasonalClimateFiles", &st) == -1) {
-
-#ifdef _WIN32
-    mkdir("SeasonalClimateFiles");
-#else
-    mkdir("SeasonalClimateFiles", 0700);
-#endif
-  }
-
-  dTime = control->Evolve.dTime / fdUnitsTime(units->iTime);
-
-  if (dTime == 0) {
-
-    sprintf(cOutM, "SeasonalClimateFiles/%s.%s.SeasonalFMerid.0", system->cName,
-            body[iBody].cName);
-    sprintf(cOutI, "SeasonalClimateFiles/%s.%s.SeasonalFIn.0", system->cName,
-            body[iBody].cName);
-    sprintf(cOutO, "SeasonalClimateFiles/%s.%s.SeasonalFOut.0", system->cName,
-            body[iBody].cName);
-    sprintf(cOutD, "SeasonalClimateFiles/%s.%s.SeasonalDivF.0", system->cName,
-            body[iBody].cName);
-
-  } else if (dTime < 10000) {
-
-    sprintf(cOutM, "SeasonalClimateFiles/%s.%s.SeasonalFMerid.%.0f",
-            system->cName, body[iBody].cName, dTime);
-    sprintf(cOutI, "SeasonalClimateFiles/%s.%s.SeasonalFIn.%.0f", system->cName,
-            body[iBody].cName, dTime);
-    sprintf(cOutO, "SeasonalClimateFiles/%s.%s.SeasonalFOut.%.0f",
-            system->cName, body[iBody].cName, dTime);
-    sprintf(cOutD, "SeasonalClimateFiles/%s.%s.SeasonalDivF.%.0f",
-            system->cName, body[iBody].cName, dTime);
-
-  } else {
-
-    sprintf(cOutM, "SeasonalClimateFiles/%s.%s.SeasonalFMerid.%.2e",
-            system->cName, body[iBody].cName, dTime);
-    sprintf(cOutI, "SeasonalClimateFiles/%s.%s.SeasonalFIn.%.2e", system->cName,
-            body[iBody].cName, dTime);
-    sprintf(cOutO, "SeasonalClimateFiles/%s.%s.SeasonalFOut.%.2e",
-            system->cName, body[iBody].cName, dTime);
-    sprintf(cOutD, "SeasonalClimateFiles/%s.%s.SeasonalDivF.%.2e",
-            system->cName, body[iBody].cName, dTime);
-  }
-
-  fpM = fopen(cOutM, "w");
-  fpI = fopen(cOutI, "w");
-  fpO = fopen(cOutO, "w");
-  fpD = fopen(cOutD, "w");
-
-  for (iDay = 0; iDay < body[iBody].iNumYears * body[iBody].iNStepInYear;
-       iDay++) {
-
-    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-
-      // printf("%d %d\n",iLat,iDay);
-      // printf("%d %d %lf\n",iLat,iDay,body[iBody].daTempDaily[iLat][iDay]);
-      fprintd(fpM, body[iBody].daFluxDaily[iLat][iDay], control->Io.iSciNot,
-              control->Io.iDigits);
-      fprintf(fpM, " ");
-
-      fprintd(fpI, body[iBody].daFluxInDaily[iLat][iDay], control->Io.iSciNot,
-              control->Io.iDigits);
-      fprintf(fpI, " ");
-
-      fprintd(fpO, body[iBody].daFluxOutDaily[iLat][iDay], control->Io.iSciNot,
-              control->Io.iDigits);
-      fprintf(fpO, " ");
-
-      fprintd(fpD, body[iBody].daDivFluxDaily[iLat][iDay], control->Io.iSciNot,
-              control->Io.iDigits);
-      fprintf(fpD, " ");
-    }
-
-    fprintf(fpM, "\n");
-    fprintf(fpI, "\n");
-    fprintf(fpO, "\n");
-    fprintf(fpD, "\n");
-  }
-
-  fclose(fpM);
-  fclose(fpI);
-  fclose(fpO);
-  fclose(fpD);
+  WriteSeasonalMatrix(body, control, system, units, iBody, "SeasonalFMerid",
+                      body[iBody].daFluxDaily, iNumDays);
+  WriteSeasonalMatrix(body, control, system, units, iBody, "SeasonalFIn",
+                      body[iBody].daFluxInDaily, iNumDays);
+  WriteSeasonalMatrix(body, control, system, units, iBody, "SeasonalFOut",
+                      body[iBody].daFluxOutDaily, iNumDays);
+  WriteSeasonalMatrix(body, control, system, units, iBody, "SeasonalDivF",
+                      body[iBody].daDivFluxDaily, iNumDays);
 }
 
 void WriteSeasonalIceBalance(BODY *body, CONTROL *control, OUTPUT *output,
                              SYSTEM *system, UNITS *units, UPDATE *update,
                              int iBody, double *dTmp, char cUnit[]) {
 
-  char cOut[3 * NAMELEN];
-  FILE *fp;
-  int iLat, iDay;
-  double dTime;
-
-  struct stat st = {0};
-  if (stat("SeasonalClimateFiles", &st) == -1) {
-
-#ifdef _WIN32
-    mkdir("SeasonalClimateFiles");
-#else
-    mkdir("SeasonalClimateFiles", 0700);
-#endif
-  }
-
-  dTime = control->Evolve.dTime / fdUnitsTime(units->iTime);
-
-  if (dTime == 0) {
-
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.SeasonalIceBalance.0",
-            system->cName, body[iBody].cName);
-
-  } else if (dTime < 10000) {
-
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.SeasonalIceBalance.%.0f",
-            system->cName, body[iBody].cName, dTime);
-
-  } else {
-
-    sprintf(cOut, "SeasonalClimateFiles/%s.%s.SeasonalIceBalance.%.2e",
-            system->cName, body[iBody].cName, dTime);
-  }
-
-  fp = fopen(cOut, "w");
-  for (iDay = 0; iDay < body[iBody].iNStepInYear; iDay++) {
-
-    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-
-      fprintd(fp, body[iBody].daIceBalance[iLat][iDay], control->Io.iSciNot,
-              control->Io.iDigits);
-      fprintf(fp, " ");
-    }
-
-    fprintf(fp, "\n");
-  }
-
-  fclose(fp);
+  WriteSeasonalMatrix(body, control, system, units, iBody,
+                      "SeasonalIceBalance", body[iBody].daIceBalance,
+                      body[iBody].iNStepInYear);
 }
 
 void WriteFluxMerid(BODY *body, CONTROL *control, OUTPUT *output,
@@ -4488,6 +4380,226 @@ void LogBodyPoise(BODY *body, CONTROL *control, OUTPUT *output, SYSTEM *system,
   }
 }
 
+/************ POISE Checkpoint Functions **************/
+
+/**
+Write or read the latitudinal grids of a body. The climate solvers start from
+the previous solution and the ice sheets carry their history, so all grids
+are saved, not only the primary variables.
+
+@param body Body struct
+@param iBody Index of body
+@param fp Checkpoint file
+@param bWrite Write (1) or read (0)?
+*/
+void CheckpointPoise(BODY *body, int iBody, FILE *fp, int bWrite) {
+  int iNumLats, iNumDaily;
+
+  iNumLats = body[iBody].iNumLats;
+
+  CheckpointData(fp, body[iBody].daAnnualInsol, sizeof(double), iNumLats,
+                 bWrite);
+  CheckpointData(fp, body[iBody].daPeakInsol, sizeof(double), iNumLats, bWrite);
+  CheckpointData(fp, body[iBody].daFlux, sizeof(double), iNumLats, bWrite);
+  CheckpointData(fp, body[iBody].daFluxIn, sizeof(double), iNumLats, bWrite);
+  CheckpointData(fp, body[iBody].daFluxOut, sizeof(double), iNumLats, bWrite);
+  CheckpointData(fp, body[iBody].daDivFlux, sizeof(double), iNumLats, bWrite);
+  CheckpointData(fp, body[iBody].daIceHeight, sizeof(double), iNumLats, bWrite);
+  CheckpointData(fp, body[iBody].daIceFlow, sizeof(double), iNumLats, bWrite);
+  CheckpointData(fp, body[iBody].daIceFlowMid, sizeof(double), iNumLats + 1,
+                 bWrite);
+  CheckpointData(fp, body[iBody].daDIceHeightDy, sizeof(double), iNumLats,
+                 bWrite);
+  CheckpointData(fp, body[iBody].daDeclination, sizeof(double),
+                 body[iBody].iNDays, bWrite);
+  CheckpointMatrix(fp, body[iBody].daInsol, iNumLats, body[iBody].iNDays,
+                   bWrite);
+  CheckpointData(fp, body[iBody].daTGrad, sizeof(double), iNumLats, bWrite);
+  CheckpointData(fp, body[iBody].daDMidPt, sizeof(double), iNumLats, bWrite);
+  CheckpointData(fp, body[iBody].daDeltaTempL, sizeof(double), iNumLats,
+                 bWrite);
+  CheckpointData(fp, body[iBody].daDeltaTempW, sizeof(double), iNumLats,
+                 bWrite);
+  CheckpointData(fp, body[iBody].daEnergyResL, sizeof(double), iNumLats,
+                 bWrite);
+  CheckpointData(fp, body[iBody].daEnergyResW, sizeof(double), iNumLats,
+                 bWrite);
+  CheckpointData(fp, body[iBody].daEnerResLAnn, sizeof(double), iNumLats,
+                 bWrite);
+  CheckpointData(fp, body[iBody].daEnerResWAnn, sizeof(double), iNumLats,
+                 bWrite);
+
+  if (body[iBody].iClimateModel == ANN || body[iBody].bSkipSeasEnabled) {
+    CheckpointData(fp, body[iBody].daDiffusionAnn, sizeof(double),
+                   iNumLats + 1, bWrite);
+    CheckpointData(fp, body[iBody].daLambdaAnn, sizeof(double), iNumLats + 1,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daAlbedoAnn, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTempAnn, sizeof(double), iNumLats, bWrite);
+    CheckpointData(fp, body[iBody].daPlanckAAnn, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daPlanckBAnn, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daSourceF, sizeof(double), iNumLats, bWrite);
+    CheckpointData(fp, body[iBody].daTempTerms, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTmpTempAnn, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTmpTempTerms, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].iaRowswapAnn, sizeof(int), iNumLats, bWrite);
+    CheckpointMatrix(fp, body[iBody].daMClim, iNumLats, iNumLats, bWrite);
+    CheckpointMatrix(fp, body[iBody].daMDiffAnn, iNumLats, iNumLats, bWrite);
+    CheckpointMatrix(fp, body[iBody].daMEulerAnn, iNumLats, iNumLats, bWrite);
+    CheckpointMatrix(fp, body[iBody].daMBandAnn, iNumLats, 2 * ANNBAND + 1,
+                     bWrite);
+    CheckpointMatrix(fp, body[iBody].daMLowerAnn, iNumLats, ANNBAND, bWrite);
+  }
+
+  if (body[iBody].iClimateModel == SEA) {
+    iNumDaily = body[iBody].iNumYears * body[iBody].iNStepInYear;
+
+    CheckpointData(fp, body[iBody].daXBoundary, sizeof(double), iNumLats + 1,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daYBoundary, sizeof(double), iNumLats + 1,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daLambdaSea, sizeof(double), iNumLats + 1,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daDiffusionSea, sizeof(double),
+                   iNumLats + 1, bWrite);
+    CheckpointData(fp, body[iBody].daBasalFlowMid, sizeof(double),
+                   iNumLats + 1, bWrite);
+    CheckpointData(fp, body[iBody].daIceSheetDiff, sizeof(double),
+                   iNumLats + 1, bWrite);
+
+    CheckpointData(fp, body[iBody].daTempLand, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTempWater, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTempLW, sizeof(double), iNumLats, bWrite);
+    CheckpointData(fp, body[iBody].daTempMaxLW, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTempMaxLand, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTempMaxWater, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTempMinLW, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daFluxOutLand, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daFluxOutWater, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daFluxInLand, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daFluxInWater, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daSeaIceHeight, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daSeaIceK, sizeof(double), iNumLats, bWrite);
+    CheckpointData(fp, body[iBody].daFluxSeaIce, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daSourceL, sizeof(double), iNumLats, bWrite);
+    CheckpointData(fp, body[iBody].daSourceW, sizeof(double), iNumLats, bWrite);
+    CheckpointData(fp, body[iBody].daAlbedoLand, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daAlbedoWater, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daAlbedoLW, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTempAvg, sizeof(double), iNumLats, bWrite);
+    CheckpointData(fp, body[iBody].daTempAvgL, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTempAvgW, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTempPrevL, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTempPrevW, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daAlbedoAvg, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daAlbedoAvgL, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daAlbedoAvgW, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daFluxAvg, sizeof(double), iNumLats, bWrite);
+    CheckpointData(fp, body[iBody].daFluxInAvg, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daFluxOutAvg, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daDivFluxAvg, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daIceMass, sizeof(double), iNumLats, bWrite);
+    CheckpointData(fp, body[iBody].daIceMassTmp, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daIceBalanceAnnual, sizeof(double),
+                   iNumLats, bWrite);
+    CheckpointData(fp, body[iBody].daIceBalanceTmp, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daIceBalanceAvg, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daIceFlowAvg, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daIceAccumTot, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daIceAblateTot, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daSedShear, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daBasalVel, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daBasalFlow, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daIcePropsTmp, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daIceGamTmp, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daBedrockH, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daBedrockHEq, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daPlanckASea, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daPlanckBSea, sizeof(double), iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daPlanckBAvg, sizeof(double), iNumLats,
+                   bWrite);
+
+    CheckpointData(fp, body[iBody].daSourceLW, sizeof(double), 2 * iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].daTmpTempSea, sizeof(double), 2 * iNumLats,
+                   bWrite);
+    CheckpointData(fp, body[iBody].iaRowswapSea, sizeof(int), 2 * iNumLats,
+                   bWrite);
+
+    CheckpointMatrix(fp, body[iBody].daTempDaily, iNumLats, iNumDaily, bWrite);
+    CheckpointMatrix(fp, body[iBody].daFluxDaily, iNumLats, iNumDaily, bWrite);
+    CheckpointMatrix(fp, body[iBody].daFluxInDaily, iNumLats, iNumDaily,
+                     bWrite);
+    CheckpointMatrix(fp, body[iBody].daFluxOutDaily, iNumLats, iNumDaily,
+                     bWrite);
+    CheckpointMatrix(fp, body[iBody].daDivFluxDaily, iNumLats, iNumDaily,
+                     bWrite);
+    CheckpointMatrix(fp, body[iBody].daPlanckBDaily, iNumLats, iNumDaily,
+                     bWrite);
+    CheckpointMatrix(fp, body[iBody].daIceBalance, iNumLats,
+                     body[iBody].iNStepInYear, bWrite);
+    CheckpointMatrix(fp, body[iBody].daMLand, iNumLats, iNumLats, bWrite);
+    CheckpointMatrix(fp, body[iBody].daMWater, iNumLats, iNumLats, bWrite);
+    CheckpointMatrix(fp, body[iBody].daMDiffSea, iNumLats, iNumLats, bWrite);
+    CheckpointMatrix(fp, body[iBody].daIceSheetMat, iNumLats, iNumLats,
+                     bWrite);
+    CheckpointMatrix(fp, body[iBody].daMEulerSea, 2 * iNumLats, 2 * iNumLats,
+                     bWrite);
+    CheckpointMatrix(fp, body[iBody].daMInit, 2 * iNumLats, 2 * iNumLats,
+                     bWrite);
+    CheckpointMatrix(fp, body[iBody].daMBandSea, 2 * iNumLats,
+                     2 * SEABAND + 1, bWrite);
+    CheckpointMatrix(fp, body[iBody].daMLowerSea, 2 * iNumLats, SEABAND,
+                     bWrite);
+  }
+}
+
 /************* MODULE Functions ***********/
 
 void AddModulePoise(CONTROL *control, MODULE *module, int iBody, int iModule) {
@@ -4708,26 +4820,44 @@ XXX This should really be removed or modified in order to be consistent with
 other ice coverage functions!!!! XXX
 */
 void fvSnowball(BODY *body, int iBody) {
-  int iLat, iNum = 0;
-
-  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-    if (body[iBody].bSeaIceModel) {
-      if (body[iBody].daSeaIceHeight[iLat] >= body[iBody].dMinIceHeight) {
-        iNum++;
-      }
-    } else {
-      if (body[iBody].daTempMaxWater[iLat] <= body[iBody].dFrzTSeaIce) {
-        iNum++;
-      }
-    }
-  }
-  if (iNum == body[iBody].iNumLats) {
+  if (fiNumSnowballLats(body, iBody) == body[iBody].iNumLats) {
     body[iBody].bSnowball = 1;
   } else {
     body[iBody].bSnowball = 0;
   }
 }
 
+/**
+Is the sea at a latitude frozen, as counted by fvSnowball?
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@param iLat Latitude cell in question
+@return 1 if frozen, 0 if not
+*/
+int fbSnowballLat(BODY *body, int iBody, int iLat) {
+  if (body[iBody].bSeaIceModel) {
+    return body[iBody].daSeaIceHeight[iLat] >= body[iBody].dMinIceHeight;
+  }
+  return body[iBody].daTempMaxWater[iLat] <= body[iBody].dFrzTSeaIce;
+}
+
+/**
+Counts the latitudes whose sea is frozen, as counted by fvSnowball
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@return Number of frozen latitudes
+*/
+int fiNumSnowballLats(BODY *body, int iBody) {
+  int iLat, iNum = 0;
+
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    iNum += fbSnowballLat(body, iBody, iLat);
+  }
+  return iNum;
+}
+
 /**
 Is all the land on the planet covered in ice?
 
@@ -4819,7 +4949,7 @@ void fvNorthIceCapLand(BODY *body, int iBody, double *dLatIceEdge,
   }
   // LCOV_EXCL_START
   fprintf(stderr, "ERROR: Failure in fvNorthIceCapLand.\n");
-  exit(EXIT_INT);
+  VplanetExit(EXIT_INT);
   // LCOV_EXCL_STOP
 }
 
@@ -4865,7 +4995,7 @@ void fvNorthIceCapSea(BODY *body, int iBody, double *dLatIceEdge,
   }
   // LCOV_EXCL_START
   fprintf(stderr, "ERROR: Failure in fvNorthIceCapSea.\n");
-  exit(EXIT_INT);
+  VplanetExit(EXIT_INT);
   // LCOV_EXCL_STOP
 }
 
@@ -4912,7 +5042,7 @@ void fvSouthIceCapLand(BODY *body, int iBody, double *dLatIceEdge,
   }
   // LCOV_EXCL_START
   fprintf(stderr, "ERROR: Failure in fvSouthIceCapLand.\n");
-  exit(EXIT_INT);
+  VplanetExit(EXIT_INT);
   // LCOV_EXCL_STOP
 }
 
@@ -4958,7 +5088,7 @@ void fvSouthIceCapSea(BODY *body, int iBody, double *dLatIceEdge,
   }
   // LCOV_EXCL_START
   fprintf(stderr, "ERROR: Failure in fvSouthIceCapSea.\n");
-  exit(EXIT_INT);
+  VplanetExit(EXIT_INT);
   // LCOV_EXCL_STOP
 }
 
@@ -5312,6 +5442,9 @@ void ForceBehaviorPoise(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
 
   int iLat;
 
+  // The climate is solved again every step, and the derivatives read it
+  evolve->bFSAL = 0;
+
   // XXX Conflicts here
 
   if (body[iBody].bEqtide) {
@@ -5442,7 +5575,8 @@ Calculates insolation at each latitude for a single "iNday" of the year/orbit
 void fvDailyInsolation(BODY *body, int iBody, int iDay) {
 
   int iLat;
-  double dSconst, dSinDelta, dCosDelta, dTanDelta, dDelta, HA;
+  double dSconst, dSinDelta, dCosDelta, dTanDelta, dDelta, HA, dDist2;
+  double *daSinLat, *daCosLat;
 
   // HA = dHourAngle ,dSconst = dStellarConst,dSinDelta = dSinDelta,
   // dCosDelta =
@@ -5456,14 +5590,17 @@ void fvDailyInsolation(BODY *body, int iBody, int iDay) {
   dDelta    = asin(dSinDelta);
   body[iBody].daDeclination[iDay] = dDelta;
 
+  dDist2   = body[iBody].dAstroDist * body[iBody].dAstroDist;
+  daSinLat = body[iBody].daSinLat;
+  daCosLat = body[iBody].daCosLat;
+
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     if (dDelta > 0.0) {
       /* Northern summer */
       if (body[iBody].daLats[iLat] >= (PI / 2. - dDelta)) {
         /* white night/no sunset */
         body[iBody].daInsol[iLat][iDay] =
-              dSconst * sin(body[iBody].daLats[iLat]) * dSinDelta /
-              (body[iBody].dAstroDist * body[iBody].dAstroDist);
+              dSconst * daSinLat[iLat] * dSinDelta / dDist2;
 
       } else if (-body[iBody].daLats[iLat] >= (PI / 2. - dDelta) &&
                  body[iBody].daLats[iLat] < 0.0) {
@@ -5471,12 +5608,12 @@ void fvDailyInsolation(BODY *body, int iBody, int iDay) {
         body[iBody].daInsol[iLat][iDay] = 0.0;
       } else {
         /* regular iNday/night cycle */
-        HA = acos(-tan(body[iBody].daLats[iLat]) * dTanDelta);
+        HA = acos(-body[iBody].daTanLat[iLat] * dTanDelta);
         body[iBody].daInsol[iLat][iDay] =
               dSconst *
-              (HA * sin(body[iBody].daLats[iLat]) * dSinDelta +
-               cos(body[iBody].daLats[iLat]) * dCosDelta * sin(HA)) /
-              (PI * (body[iBody].dAstroDist * body[iBody].dAstroDist));
+              (HA * daSinLat[iLat] * dSinDelta +
+               daCosLat[iLat] * dCosDelta * sin(HA)) /
+              (PI * dDist2);
       }
     } else {
       /* Southern summer */
@@ -5484,8 +5621,7 @@ void fvDailyInsolation(BODY *body, int iBody, int iDay) {
           body[iBody].daLats[iLat] < 0.0) {
         /* white night/no sunset */
         body[iBody].daInsol[iLat][iDay] =
-              dSconst * sin(body[iBody].daLats[iLat]) * dSinDelta /
-              (body[iBody].dAstroDist * body[iBody].dAstroDist);
+              dSconst * daSinLat[iLat] * dSinDelta / dDist2;
 
       } else if (body[iBody].daLats[iLat] >= (PI / 2. + dDelta)) {
         /* polar darkness/no sunrise */
@@ -5494,17 +5630,44 @@ void fvDailyInsolation(BODY *body, int iBody, int iDay) {
       } else {
 
         /* regular iNday/night cycle */
-        HA = acos(-tan(body[iBody].daLats[iLat]) * dTanDelta);
+        HA = acos(-body[iBody].daTanLat[iLat] * dTanDelta);
         body[iBody].daInsol[iLat][iDay] =
               dSconst *
-              (HA * sin(body[iBody].daLats[iLat]) * dSinDelta +
-               cos(body[iBody].daLats[iLat]) * dCosDelta * sin(HA)) /
-              (PI * (body[iBody].dAstroDist * body[iBody].dAstroDist));
+              (HA * daSinLat[iLat] * dSinDelta +
+               daCosLat[iLat] * dCosDelta * sin(HA)) /
+              (PI * dDist2);
       }
     }
   }
 }
 
+/**
+Can the insolation from the last call to fvAnnualInsolation be reused? It
+can if the orbit, obliquity and luminosity are within dInsolTol of those it
+was computed for.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@param dEcc Eccentricity
+@param dLongP Pericenter, relative to direction of planet at spring equinox
+@return 1 if the insolation arrays are still valid, 0 if not
+*/
+int fbInsolCached(BODY *body, int iBody, double dEcc, double dLongP) {
+  double dTol = body[iBody].dInsolTol;
+
+  if (!body[iBody].bInsolCached ||
+      body[iBody].iInsolNDays != body[iBody].iNDays) {
+    return 0;
+  }
+  return fabs(body[iBody].dObliquity - body[iBody].dInsolObliq) <= dTol &&
+         fabs(dEcc - body[iBody].dInsolEcc) <= dTol &&
+         fabs(dLongP - body[iBody].dInsolLongP) <= dTol &&
+         fabs(body[iBody].dSemi - body[iBody].dInsolSemi) <=
+               dTol * body[iBody].dInsolSemi &&
+         fabs(body[0].dLuminosity - body[iBody].dInsolLum) <=
+               dTol * body[iBody].dInsolLum;
+}
+
 /**
 Calculates insolation at each latitude over the entire year/orbit
 
@@ -5512,7 +5675,7 @@ Calculates insolation at each latitude over the entire year/orbit
 @param iBody Body in question
 */
 void fvAnnualInsolation(BODY *body, int iBody) {
-  int iDays, iLat;
+  int iDays, iLat, bCached;
   double dLongP, dTrueA, dEccA, dMeanL, dEcc;
   // dLongP
   // Pericenter, relative to direction of planet at spring equinox
@@ -5533,9 +5696,14 @@ void fvAnnualInsolation(BODY *body, int iBody) {
   dEccA                  = fdEccTrueAnomaly(dTrueA, dEcc);
   dMeanL                 = dEccA - dEcc * sin(dEccA) + dLongP;
 
-  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-    body[iBody].daAnnualInsol[iLat] = 0.0;
-    body[iBody].daPeakInsol[iLat]   = 0.0;
+  /* The orbit is still followed through the year, so the position of the
+     planet ends up the same, but the insolation arrays are kept. */
+  bCached = fbInsolCached(body, iBody, dEcc, dLongP);
+  if (!bCached) {
+    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+      body[iBody].daAnnualInsol[iLat] = 0.0;
+      body[iBody].daPeakInsol[iLat]   = 0.0;
+    }
   }
 
   for (iDays = 0; iDays < body[iBody].iNDays; iDays++) {
@@ -5571,17 +5739,30 @@ void fvAnnualInsolation(BODY *body, int iBody) {
     // planet-star distance (units of semi-major axis):
     body[iBody].dAstroDist = (1.0 - (dEcc * dEcc)) / (1.0 + dEcc * cos(dTrueA));
 
-    fvDailyInsolation(body, iBody, iDays);
+    if (!bCached) {
+      fvDailyInsolation(body, iBody, iDays);
 
-    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-      body[iBody].daAnnualInsol[iLat] +=
-            body[iBody].daInsol[iLat][iDays] / ((double)body[iBody].iNDays);
+      for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+        body[iBody].daAnnualInsol[iLat] +=
+              body[iBody].daInsol[iLat][iDays] / ((double)body[iBody].iNDays);
 
-      if (body[iBody].daInsol[iLat][iDays] > body[iBody].daPeakInsol[iLat]) {
-        body[iBody].daPeakInsol[iLat] = body[iBody].daInsol[iLat][iDays];
+        if (body[iBody].daInsol[iLat][iDays] >
+            body[iBody].daPeakInsol[iLat]) {
+          body[iBody].daPeakInsol[iLat] = body[iBody].daInsol[iLat][iDays];
+        }
       }
     }
   }
+
+  if (!bCached) {
+    body[iBody].bInsolCached = 1;
+    body[iBody].dInsolObliq  = body[iBody].dObliquity;
+    body[iBody].dInsolEcc    = dEcc;
+    body[iBody].dInsolLongP  = dLongP;
+    body[iBody].dInsolSemi   = body[iBody].dSemi;
+    body[iBody].dInsolLum    = body[0].dLuminosity;
+    body[iBody].iInsolNDays  = body[iBody].iNDays;
+  }
 }
 
 /**
@@ -5620,65 +5801,89 @@ void fvAlbedoAnnual(BODY *body, int iBody) {
 }
 
 /**
-Inverts the matrix for the annual EBM
+Factors the matrix for the annual EBM. Diffusion only couples neighboring
+latitudes, so the matrix is tridiagonal and only the band is decomposed.
 
 @param body Struct containing all body information and variables
 @param iBody Body in question
 */
-void fvMatrixInvertAnnual(BODY *body, int iBody) {
-  int iLat, jLat;
-
-  LUDecomp(body[iBody].daMEulerAnn, body[iBody].daMEulerCopyAnn,
-           body[iBody].daScaleAnn, body[iBody].iaRowswapAnn,
-           body[iBody].iNumLats);
+void fvMatrixFactorAnnual(BODY *body, int iBody) {
+  int iLat, jLat, iCol;
 
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-    for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-      if (jLat == iLat) {
-        body[iBody].daUnitVAnn[jLat] = 1.0;
+    for (jLat = 0; jLat < 2 * ANNBAND + 1; jLat++) {
+      iCol = iLat - ANNBAND + jLat;
+      if (iCol >= 0 && iCol < body[iBody].iNumLats) {
+        body[iBody].daMBandAnn[iLat][jLat] =
+              body[iBody].daMEulerAnn[iLat][iCol];
       } else {
-        body[iBody].daUnitVAnn[jLat] = 0.0;
+        body[iBody].daMBandAnn[iLat][jLat] = 0.0;
       }
     }
-
-    LUSolve(body[iBody].daMEulerCopyAnn, body[iBody].daUnitVAnn,
-            body[iBody].iaRowswapAnn, body[iBody].iNumLats);
-
-    for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-      body[iBody].daInvMAnn[jLat][iLat] = body[iBody].daUnitVAnn[jLat];
-    }
   }
+
+  BandLUDecomp(body[iBody].daMBandAnn, body[iBody].daMLowerAnn,
+               body[iBody].iaRowswapAnn, body[iBody].iNumLats, ANNBAND,
+               ANNBAND);
 }
 
 /**
-Inverts the matrix for the seasonal EBM
+Solves the factored matrix of the annual EBM. daTmpTempAnn holds the
+right-hand side on entry and the temperatures on exit.
 
 @param body Struct containing all body information and variables
 @param iBody Body in question
 */
-void fvMatrixInvertSeasonal(BODY *body, int iBody) {
-  int iLat, jLat;
+void fvMatrixSolveAnnual(BODY *body, int iBody) {
+  BandLUSolve(body[iBody].daMBandAnn, body[iBody].daMLowerAnn,
+              body[iBody].daTmpTempAnn, body[iBody].iaRowswapAnn,
+              body[iBody].iNumLats, ANNBAND, ANNBAND);
+}
+
+/**
+Factors the matrix for the seasonal EBM. Land and water points alternate, so
+the matrix is a band with SEABAND sub- and superdiagonals and only the band
+is decomposed.
 
-  LUDecomp(body[iBody].daMEulerSea, body[iBody].daMEulerCopySea,
-           body[iBody].daScaleSea, body[iBody].iaRowswapSea,
-           2 * body[iBody].iNumLats);
+@param body Struct containing all body information and variables
+@param iBody Body in question
+*/
+void fvMatrixFactorSeasonal(BODY *body, int iBody) {
+  int iLat, jLat, iCol;
 
   for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      if (jLat == iLat) {
-        body[iBody].daUnitVSea[jLat] = 1.0;
+    for (jLat = 0; jLat < 2 * SEABAND + 1; jLat++) {
+      iCol = iLat - SEABAND + jLat;
+      if (iCol >= 0 && iCol < 2 * body[iBody].iNumLats) {
+        body[iBody].daMBandSea[iLat][jLat] =
+              body[iBody].daMEulerSea[iLat][iCol];
       } else {
-        body[iBody].daUnitVSea[jLat] = 0.0;
+        body[iBody].daMBandSea[iLat][jLat] = 0.0;
       }
     }
+  }
 
-    LUSolve(body[iBody].daMEulerCopySea, body[iBody].daUnitVSea,
-            body[iBody].iaRowswapSea, 2 * body[iBody].iNumLats);
+  BandLUDecomp(body[iBody].daMBandSea, body[iBody].daMLowerSea,
+               body[iBody].iaRowswapSea, 2 * body[iBody].iNumLats, SEABAND,
+               SEABAND);
+}
 
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      body[iBody].daInvMSea[jLat][iLat] = body[iBody].daUnitVSea[jLat];
-    }
+/**
+Takes one step of the seasonal EBM: solves the factored matrix for the
+temperatures, daTmpTempSea, with daSourceLW on the right-hand side.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+*/
+void fvMatrixSolveSeasonal(BODY *body, int iBody) {
+  int iLat;
+
+  for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
+    body[iBody].daTmpTempSea[iLat] = body[iBody].daSourceLW[iLat];
   }
+  BandLUSolve(body[iBody].daMBandSea, body[iBody].daMLowerSea,
+              body[iBody].daTmpTempSea, body[iBody].iaRowswapSea,
+              2 * body[iBody].iNumLats, SEABAND, SEABAND);
 }
 
 /**
@@ -5731,7 +5936,8 @@ void fvTempGradientSea(BODY *body, double dDelta_x, int iBody) {
 
 /**
 Calculates the backwards-Euler matrix that integrates the annual EBM. Each
-operation of the inverse matrix is a "time-step".
+solve with the factored matrix is a "time-step". Only the tridiagonal band is
+set, the other elements stay zero.
 
 @param body Struct containing all body information and variables
 @param iBody Body in question
@@ -5746,44 +5952,42 @@ void fvMatrixAnnual(BODY *body, int iBody) {
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     body[iBody].daTempTerms[iLat] = 0.0;
 
-    for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-      if (jLat == iLat) {
+    for (jLat = iLat - ANNBAND; jLat <= iLat + ANNBAND; jLat++) {
+      if (jLat >= 0 && jLat < body[iBody].iNumLats) {
+        if (jLat == iLat) {
 
-        body[iBody].daMClim[iLat][jLat] = (-body[iBody].daPlanckBAnn[iLat] -
-                                           body[iBody].daLambdaAnn[iLat + 1] -
-                                           body[iBody].daLambdaAnn[iLat]) /
-                                          body[iBody].dHeatCapAnn;
+          body[iBody].daMClim[iLat][jLat] =
+                (-body[iBody].daPlanckBAnn[iLat] -
+                 body[iBody].daLambdaAnn[iLat + 1] -
+                 body[iBody].daLambdaAnn[iLat]) /
+                body[iBody].dHeatCapAnn;
 
-        body[iBody].daMDiffAnn[iLat][jLat] =
-              (-body[iBody].daLambdaAnn[iLat + 1] -
-               body[iBody].daLambdaAnn[iLat]);
+          body[iBody].daMDiffAnn[iLat][jLat] =
+                (-body[iBody].daLambdaAnn[iLat + 1] -
+                 body[iBody].daLambdaAnn[iLat]);
 
-        body[iBody].daMEulerAnn[iLat][jLat] = -1.0 / dDelta_t;
+          body[iBody].daMEulerAnn[iLat][jLat] = -1.0 / dDelta_t;
 
-      } else if (jLat == (iLat + 1)) {
-        body[iBody].daMClim[iLat][jLat] =
-              body[iBody].daLambdaAnn[jLat] / body[iBody].dHeatCapAnn;
+        } else if (jLat == (iLat + 1)) {
+          body[iBody].daMClim[iLat][jLat] =
+                body[iBody].daLambdaAnn[jLat] / body[iBody].dHeatCapAnn;
 
-        body[iBody].daMDiffAnn[iLat][jLat]  = body[iBody].daLambdaAnn[jLat];
-        body[iBody].daMEulerAnn[iLat][jLat] = 0.0;
+          body[iBody].daMDiffAnn[iLat][jLat]  = body[iBody].daLambdaAnn[jLat];
+          body[iBody].daMEulerAnn[iLat][jLat] = 0.0;
 
-      } else if (jLat == (iLat - 1)) {
-        body[iBody].daMClim[iLat][jLat] =
-              body[iBody].daLambdaAnn[iLat] / body[iBody].dHeatCapAnn;
+        } else {
+          body[iBody].daMClim[iLat][jLat] =
+                body[iBody].daLambdaAnn[iLat] / body[iBody].dHeatCapAnn;
 
-        body[iBody].daMDiffAnn[iLat][jLat]  = body[iBody].daLambdaAnn[iLat];
-        body[iBody].daMEulerAnn[iLat][jLat] = 0.0;
+          body[iBody].daMDiffAnn[iLat][jLat]  = body[iBody].daLambdaAnn[iLat];
+          body[iBody].daMEulerAnn[iLat][jLat] = 0.0;
+        }
+        body[iBody].daMEulerAnn[iLat][jLat] +=
+              0.5 * body[iBody].daMClim[iLat][jLat];
 
-      } else {
-        body[iBody].daMClim[iLat][jLat]     = 0.0;
-        body[iBody].daMDiffAnn[iLat][jLat]  = 0.0;
-        body[iBody].daMEulerAnn[iLat][jLat] = 0.0;
+        body[iBody].daTempTerms[iLat] +=
+              body[iBody].daMClim[iLat][jLat] * body[iBody].daTempAnn[jLat];
       }
-      body[iBody].daMEulerAnn[iLat][jLat] +=
-            0.5 * body[iBody].daMClim[iLat][jLat];
-
-      body[iBody].daTempTerms[iLat] +=
-            body[iBody].daMClim[iLat][jLat] * body[iBody].daTempAnn[jLat];
     }
 
     body[iBody].daSourceF[iLat] = ((1.0 - body[iBody].daAlbedoAnn[iLat]) *
@@ -5867,32 +6071,33 @@ void PoiseAnnual(BODY *body, int iBody) {
     body[iBody].dTGlobal += body[iBody].daTempAnn[iLat] / body[iBody].iNumLats;
   }
   fvMatrixAnnual(body, iBody);
-  fvMatrixInvertAnnual(body, iBody);
+  fvMatrixFactorAnnual(body, iBody);
 
   /* Relaxation to equilibrium */
   iIter       = 1;
   dTempChange = 1.0;
   while (fabs(dTempChange) > 1e-12) {
+    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+      body[iBody].daTmpTempAnn[iLat] =
+            -(0.5 * (body[iBody].daTempTerms[iLat] +
+                     body[iBody].daSourceF[iLat]) +
+              body[iBody].daTempAnn[iLat] / dDelta_t);
+    }
+    fvMatrixSolveAnnual(body, iBody);
+
     dTmpTGlobal = 0.0;
     for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-      body[iBody].daTmpTempAnn[iLat] = 0.0;
-
-      for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-        body[iBody].daTmpTempAnn[iLat] +=
-              -body[iBody].daInvMAnn[iLat][jLat] *
-              (0.5 * (body[iBody].daTempTerms[jLat] +
-                      body[iBody].daSourceF[jLat]) +
-               body[iBody].daTempAnn[jLat] / dDelta_t);
-      }
       dTmpTGlobal += body[iBody].daTmpTempAnn[iLat] / body[iBody].iNumLats;
     }
 
     for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
       body[iBody].daTmpTempTerms[iLat] = body[iBody].daSourceF[iLat];
 
-      for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-        body[iBody].daTmpTempTerms[iLat] +=
-              body[iBody].daMClim[iLat][jLat] * body[iBody].daTmpTempAnn[jLat];
+      for (jLat = iLat - ANNBAND; jLat <= iLat + ANNBAND; jLat++) {
+        if (jLat >= 0 && jLat < body[iBody].iNumLats) {
+          body[iBody].daTmpTempTerms[iLat] += body[iBody].daMClim[iLat][jLat] *
+                                              body[iBody].daTmpTempAnn[jLat];
+        }
       }
     }
 
@@ -5914,7 +6119,7 @@ void PoiseAnnual(BODY *body, int iBody) {
     if (iIter >= iIterMax) {
       fprintf(stderr,
               "POISE solution not converged before max iterations reached.\n");
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
     if (body[iBody].bCalcAB == 1) {
@@ -5968,7 +6173,7 @@ void PoiseAnnual(BODY *body, int iBody) {
         }
       }
       fvMatrixAnnual(body, iBody);
-      fvMatrixInvertAnnual(body, iBody);
+      fvMatrixFactorAnnual(body, iBody);
     }
     iIter++;
   }
@@ -5985,8 +6190,8 @@ void PoiseAnnual(BODY *body, int iBody) {
 
     body[iBody].daFlux[iLat] =
           -2. * PI * (body[iBody].dRadius * body[iBody].dRadius) *
-          sqrt(1.0 - (sin(body[iBody].daLats[iLat]) *
-                      sin(body[iBody].daLats[iLat]))) *
+          sqrt(1.0 - (body[iBody].daSinLat[iLat] *
+                      body[iBody].daSinLat[iLat])) *
           body[iBody].daDMidPt[iLat] * body[iBody].daTGrad[iLat];
 
     body[iBody].daFluxIn[iLat] = (1.0 - body[iBody].daAlbedoAnn[iLat]) *
@@ -6003,9 +6208,11 @@ void PoiseAnnual(BODY *body, int iBody) {
           body[iBody].daFluxOut[iLat] / body[iBody].iNumLats;
 
     body[iBody].daDivFlux[iLat] = 0.0;
-    for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-      body[iBody].daDivFlux[iLat] +=
-            -body[iBody].daMDiffAnn[iLat][jLat] * body[iBody].daTempAnn[jLat];
+    for (jLat = iLat - ANNBAND; jLat <= iLat + ANNBAND; jLat++) {
+      if (jLat >= 0 && jLat < body[iBody].iNumLats) {
+        body[iBody].daDivFlux[iLat] += -body[iBody].daMDiffAnn[iLat][jLat] *
+                                       body[iBody].daTempAnn[jLat];
+      }
     }
     body[iBody].dAlbedoGlobal +=
           body[iBody].daAlbedoAnn[iLat] / body[iBody].iNumLats;
@@ -6629,9 +6836,12 @@ void fvSeaIce(BODY *body, int iBody) {
   dCw_dt = (body[iBody].dHeatCapWater * body[iBody].dMeanMotion / (2 * PI)) /
            body[iBody].dSeasDeltat;
 
+  // Only the band of the matrix is non-zero
   for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      body[iBody].daMEulerSea[iLat][jLat] = body[iBody].daMInit[iLat][jLat];
+    for (jLat = iLat - SEABAND; jLat <= iLat + SEABAND; jLat++) {
+      if (jLat >= 0 && jLat < 2 * body[iBody].iNumLats) {
+        body[iBody].daMEulerSea[iLat][jLat] = body[iBody].daMInit[iLat][jLat];
+      }
     }
   }
 
@@ -6653,15 +6863,8 @@ void fvSeaIce(BODY *body, int iBody) {
       }
     }
   }
-  fvMatrixInvertSeasonal(body, iBody);
-
-  for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
-    body[iBody].daTmpTempSea[iLat] = 0.0;
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      body[iBody].daTmpTempSea[iLat] +=
-            body[iBody].daInvMSea[iLat][jLat] * body[iBody].daSourceLW[jLat];
-    }
-  }
+  fvMatrixFactorSeasonal(body, iBody);
+  fvMatrixSolveSeasonal(body, iBody);
 
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     // temp change this time step
@@ -6687,10 +6890,13 @@ void fvSeaIce(BODY *body, int iBody) {
                   (body[iBody].daTmpTempSea[2 * iLat + 1] -
                    body[iBody].daTempLand[iLat]);
 
-      for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-        body[iBody].daFluxSeaIce[iLat] +=
-              body[iBody].daMDiffSea[iLat][jLat] *
-              body[iBody].daTmpTempSea[2 * jLat + 1];
+      // Diffusion only couples neighboring latitudes
+      for (jLat = iLat - 1; jLat <= iLat + 1; jLat++) {
+        if (jLat >= 0 && jLat < body[iBody].iNumLats) {
+          body[iBody].daFluxSeaIce[iLat] +=
+                body[iBody].daMDiffSea[iLat][jLat] *
+                body[iBody].daTmpTempSea[2 * jLat + 1];
+        }
       }
       if (body[iBody].daLats[iLat] >= 0) {
         dNhicearea += body[iBody].daWaterFrac[iLat];
@@ -6741,7 +6947,7 @@ void fvSeaIce(BODY *body, int iBody) {
 
 /**
 Calculates the backwards-Euler matrix that integrates the seasonal EBM. Each
-operation of the inverse matrix is a "time-step".
+solve with the factored matrix is a "time-step".
 
 @param body Struct containing all body information and variables
 @param iBody Body in question
@@ -6822,12 +7028,10 @@ void fvMatrixSeasonal(BODY *body, int iBody) {
   for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
     for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
       body[iBody].daMEulerSea[iLat][jLat] = body[iBody].daMInit[iLat][jLat];
-      body[iBody].daMEulerCopySea[iLat][jLat] =
-            body[iBody].daMEulerCopySea[iLat][jLat];
     }
   }
 
-  fvMatrixInvertSeasonal(body, iBody);
+  fvMatrixFactorSeasonal(body, iBody);
 }
 
 /**
@@ -7071,8 +7275,8 @@ void fvFluxesByLatitude(BODY *body, int iBody, int iNyear, int iNstep) {
                                         body[iBody].daDiffusionSea[iLat]);
     body[iBody].daFlux[iLat] =
           -2. * PI * (body[iBody].dRadius * body[iBody].dRadius) *
-          sqrt(1.0 - (sin(body[iBody].daLats[iLat]) *
-                      sin(body[iBody].daLats[iLat]))) *
+          sqrt(1.0 - (body[iBody].daSinLat[iLat] *
+                      body[iBody].daSinLat[iLat])) *
           body[iBody].daDMidPt[iLat] * body[iBody].daTGrad[iLat];
     body[iBody].daFluxAvg[iLat] +=
           body[iBody].daFlux[iLat] / body[iBody].iNStepInYear;
@@ -7080,9 +7284,11 @@ void fvFluxesByLatitude(BODY *body, int iBody, int iNyear, int iNstep) {
           body[iBody].daFlux[iLat];
 
     body[iBody].daDivFlux[iLat] = 0.0;
-    for (int jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-      body[iBody].daDivFlux[iLat] +=
-            -body[iBody].daMDiffSea[iLat][jLat] * body[iBody].daTempLW[jLat];
+    for (int jLat = iLat - 1; jLat <= iLat + 1; jLat++) {
+      if (jLat >= 0 && jLat < body[iBody].iNumLats) {
+        body[iBody].daDivFlux[iLat] +=
+              -body[iBody].daMDiffSea[iLat][jLat] * body[iBody].daTempLW[jLat];
+      }
     }
     body[iBody].daDivFluxAvg[iLat] +=
           body[iBody].daDivFlux[iLat] / body[iBody].iNStepInYear;
@@ -7227,7 +7433,6 @@ void fvPoiseGlobalProps(BODY *body, int iBody) {
 
 void fvFinishSeaIce(BODY *body, double dStepsize, int iBody, int iLat,
                     int iNyear, int iNday, int iNstep) {
-  fvSnowball(body, iBody);
   // ice growth/ablation
   if (body[iBody].bIceSheets) {
     fvCalculateIceSheets(body, dStepsize, iBody, iLat, iNstep);
@@ -7242,8 +7447,14 @@ void fvFinishSeaIce(BODY *body, double dStepsize, int iBody, int iLat,
 
 void fvCalculateSeaIce(BODY *body, double dStepsize, int iBody, int iNyear,
                        int iNday, int iNstep) {
+  int iNumFrozen, bFrozen;
+
   fvSeaIce(body, iBody);
+  /* The snowball state is updated latitude by latitude, as each sea ice
+     height changes, by keeping count of the frozen latitudes. */
+  iNumFrozen = fiNumSnowballLats(body, iBody);
   for (int iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    bFrozen = fbSnowballLat(body, iBody, iLat);
     if (body[iBody].daSeaIceHeight[iLat] > 0) {
       // adjust height of present sea ice
       body[iBody].daSeaIceHeight[iLat] -= body[iBody].dSeasDeltat /
@@ -7262,6 +7473,8 @@ void fvCalculateSeaIce(BODY *body, double dStepsize, int iBody, int iNyear,
               (body[iBody].daTempWater[iLat] - body[iBody].dFrzTSeaIce);
       }
     }
+    iNumFrozen += fbSnowballLat(body, iBody, iLat) - bFrozen;
+    body[iBody].bSnowball = (iNumFrozen == body[iBody].iNumLats);
 
     fvFinishSeaIce(body, dStepsize, iBody, iLat, iNyear, iNday, iNstep);
   }
@@ -7269,15 +7482,12 @@ void fvCalculateSeaIce(BODY *body, double dStepsize, int iBody, int iNyear,
 
 void fvStaticSeaIce(BODY *body, double dStepsize, int iBody, int iNyear,
                     int iNday, int iNstep) {
-  int iLat, jLat;
+  int iLat, iNumFrozen, bFrozen;
 
-  for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
-    body[iBody].daTmpTempSea[iLat] = 0.0;
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      body[iBody].daTmpTempSea[iLat] +=
-            body[iBody].daInvMSea[iLat][jLat] * body[iBody].daSourceLW[jLat];
-    }
-  }
+  fvMatrixSolveSeasonal(body, iBody);
+  /* The snowball state is updated latitude by latitude, as each maximum
+     water temperature changes, by keeping count of the frozen latitudes. */
+  iNumFrozen = fiNumSnowballLats(body, iBody);
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     // temp change this time step
     body[iBody].daDeltaTempL[iLat] =
@@ -7288,7 +7498,77 @@ void fvStaticSeaIce(BODY *body, double dStepsize, int iBody, int iNyear,
     body[iBody].daTempLand[iLat]  = body[iBody].daTmpTempSea[2 * iLat];
     body[iBody].daTempWater[iLat] = body[iBody].daTmpTempSea[2 * iLat + 1];
 
+    body[iBody].bSnowball = (iNumFrozen == body[iBody].iNumLats);
+    bFrozen               = fbSnowballLat(body, iBody, iLat);
     fvFinishSeaIce(body, dStepsize, iBody, iLat, iNyear, iNday, iNstep);
+    iNumFrozen += fbSnowballLat(body, iBody, iLat) - bFrozen;
+  }
+}
+
+/**
+Compares the annual mean land and water temperatures of the orbit just run
+with those of the previous orbit, which may have been run by the previous
+call, and keeps them for the next comparison.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@return 1 if no temperature changed by more than dSpinUpTol, otherwise 0
+*/
+int fbSeasonalConverged(BODY *body, int iBody) {
+  int iLat, bConverged;
+
+  bConverged = body[iBody].bTempAvgPrev;
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    if (fabs(body[iBody].daTempAvgL[iLat] - body[iBody].daTempPrevL[iLat]) >
+              body[iBody].dSpinUpTol ||
+        fabs(body[iBody].daTempAvgW[iLat] - body[iBody].daTempPrevW[iLat]) >
+              body[iBody].dSpinUpTol) {
+      bConverged = 0;
+    }
+    body[iBody].daTempPrevL[iLat] = body[iBody].daTempAvgL[iLat];
+    body[iBody].daTempPrevW[iLat] = body[iBody].daTempAvgW[iLat];
+  }
+  body[iBody].bTempAvgPrev = 1;
+
+  return bConverged;
+}
+
+/**
+Fills the orbits after iNyear, which PoiseSeasonal did not run because the
+climate had settled, with the cycle of orbit iNyear, and scales the ice
+accumulated and ablated over the orbits that were run up to iNumYears.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@param iNyear Last orbit run
+*/
+void fvSeasonalSkipAhead(BODY *body, int iBody, int iNyear) {
+  int iLat, iStep, iFrom, iStart, iEnd;
+
+  iStart = iNyear * body[iBody].iNStepInYear;
+  iEnd   = body[iBody].iNumYears * body[iBody].iNStepInYear;
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    for (iStep = iStart + body[iBody].iNStepInYear; iStep < iEnd; iStep++) {
+      iFrom = iStart + iStep % body[iBody].iNStepInYear;
+      body[iBody].daTempDaily[iLat][iStep] =
+            body[iBody].daTempDaily[iLat][iFrom];
+      body[iBody].daFluxInDaily[iLat][iStep] =
+            body[iBody].daFluxInDaily[iLat][iFrom];
+      body[iBody].daFluxOutDaily[iLat][iStep] =
+            body[iBody].daFluxOutDaily[iLat][iFrom];
+      body[iBody].daPlanckBDaily[iLat][iStep] =
+            body[iBody].daPlanckBDaily[iLat][iFrom];
+      body[iBody].daFluxDaily[iLat][iStep] =
+            body[iBody].daFluxDaily[iLat][iFrom];
+      body[iBody].daDivFluxDaily[iLat][iStep] =
+            body[iBody].daDivFluxDaily[iLat][iFrom];
+    }
+    if (body[iBody].bIceSheets) {
+      body[iBody].daIceAccumTot[iLat] *=
+            (double)body[iBody].iNumYears / (iNyear + 1);
+      body[iBody].daIceAblateTot[iLat] *=
+            (double)body[iBody].iNumYears / (iNyear + 1);
+    }
   }
 }
 
@@ -7301,7 +7581,7 @@ to be in "equilibrium" though not in "steady-state".
 @param iBody Body in question
 */
 void PoiseSeasonal(BODY *body, int iBody) {
-  int iLat, jLat, iNstep, iNyear, iNday;
+  int iLat, jLat, iNstep, iNyear, iNday, bConverged, bLastYear;
   double dStepsize;
 
   dStepsize = 2 * PI / body[iBody].dMeanMotion / body[iBody].iNStepInYear;
@@ -7311,7 +7591,8 @@ void PoiseSeasonal(BODY *body, int iBody) {
   // XXX Needs to be broken down into functions!
 
   /* main loop */
-  for (iNyear = 0; iNyear < body[iBody].iNumYears; iNyear++) {
+  bConverged = 0;
+  for (iNyear = 0; iNyear < body[iBody].iNumYears && !bConverged; iNyear++) {
     fvPoiseSeasonalInitialize(body, iBody, iNyear);
 
     fvAlbedoSeasonal(body, iBody, 0);
@@ -7342,9 +7623,15 @@ void PoiseSeasonal(BODY *body, int iBody) {
       }
     }
 
+    if (body[iBody].bSeasConverge) {
+      bConverged = fbSeasonalConverged(body, iBody);
+    }
+    bLastYear = (bConverged || iNyear == body[iBody].iNumYears - 1);
+
     if (body[iBody].bIceSheets) {
       for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-        if (iNyear != 0) {
+        if (iNyear != 0 || bLastYear) {
+          // the last year keeps its leading half-step even if it is the first
           body[iBody].daIceBalanceAnnual[iLat] +=
                 dStepsize / 2. * (body[iBody].daIceBalance[iLat][0]) /
                 (body[iBody].iNumYears * 2 * PI / body[iBody].dMeanMotion);
@@ -7359,7 +7646,7 @@ void PoiseSeasonal(BODY *body, int iBody) {
                 (body[iBody].iNumYears * 2 * PI / body[iBody].dMeanMotion);
           // above gets yearly average over NumYears
         }
-        if (iNyear != (body[iBody].iNumYears - 1)) {
+        if (!bLastYear) {
           body[iBody].daIceBalanceAnnual[iLat] +=
                 dStepsize / 2. * (body[iBody].daIceBalance[iLat][iNstep - 1]) /
                 (body[iBody].iNumYears * 2 * PI / body[iBody].dMeanMotion);
@@ -7367,6 +7654,10 @@ void PoiseSeasonal(BODY *body, int iBody) {
       }
     }
   }
+
+  if (bConverged) {
+    fvSeasonalSkipAhead(body, iBody, iNyear - 1);
+  }
 }
 
 /**
@@ -7442,7 +7733,7 @@ void IceSheetTriDiag(BODY *body, int iBody) {
     // LCOV_EXCL_START
     if (bTmp == 0) {
       fprintf(stderr, "Ice sheet tri-diagonal solution failed\n");
-      exit(EXIT_INPUT);
+      VplanetExit(EXIT_INPUT);
       // LCOV_EXCL_STOP
     }
     body[iBody].daIceHeight[iLat] = (body[iBody].daIcePropsTmp[iLat] -
@@ -29,6 +29,11 @@
 #define UNIFORM3 0
 #define MODERN 1
 
+/* Sub- and superdiagonals of the annual matrix */
+#define ANNBAND 1
+/* Sub- and superdiagonals of the seasonal matrix, land and water alternating */
+#define SEABAND 2
+
 // Constants for the ice model
 #define LFICE 3.34e5  // ???
 #define RHOICE 916.7  // density of ice I
@@ -111,6 +116,8 @@
 #define OPT_ECCAMP 1968
 #define OPT_ECCPER 1969
 #define OPT_MINICEHEIGHT 1970
+#define OPT_INSOLTOL 1971
+#define OPT_SEASCONVERGE 1972
 
 #define OPT_OLRMODEL 1998
 #define OPT_CLIMATEMODEL 1999
@@ -184,6 +191,7 @@
 void AddModulePoise(CONTROL *, MODULE *, int, int);
 void BodyCopyPoise(BODY *, BODY *, int, int, int);
 void InitializeUpdateTmpBodyPoise(BODY *, CONTROL *, UPDATE *, int);
+void CheckpointPoise(BODY *, int, FILE *, int);
 
 /* Options Functions */
 void HelpOptionsPoise(OPTIONS *);
@@ -222,6 +230,8 @@ void WriteAlbedoLat(BODY *, CONTROL *, OUTPUT *, SYSTEM *, UNITS *, UPDATE *,
                     int, double *, char[]);
 void WriteAnnualInsol(BODY *, CONTROL *, OUTPUT *, SYSTEM *, UNITS *, UPDATE *,
                       int, double *, char[]);
+void WriteSeasonalMatrix(BODY *, CONTROL *, SYSTEM *, UNITS *, int, char[],
+                         double **, int);
 void WriteDailyInsol(BODY *, CONTROL *, OUTPUT *, SYSTEM *, UNITS *, UPDATE *,
                      int, double *, char[]);
 void WritePlanckB(BODY *, CONTROL *, OUTPUT *, SYSTEM *, UNITS *, UPDATE *, int,
@@ -271,13 +281,20 @@ void PoiseSeasonal(BODY *, int);
 void PoiseIceSheets(BODY *, EVOLVE *, int);
 void fvSeaIce(BODY *, int);
 void fvMatrixSeasonal(BODY *, int);
-void fvMatrixInvertSeasonal(BODY *, int);
+void fvMatrixFactorAnnual(BODY *, int);
+void fvMatrixSolveAnnual(BODY *, int);
+void fvMatrixFactorSeasonal(BODY *, int);
+void fvMatrixSolveSeasonal(BODY *, int);
 void fvTempGradientAnn(BODY *, double, int);
 void fvTempGradientSea(BODY *, double, int);
 void fvMatrixAnnual(BODY *, int);
 
 void fvSourceFSeas(BODY *, int, int);
 void fvSnowball(BODY *, int); // XXX Should change to int fbSnowball
+int fbSnowballLat(BODY *, int, int);
+int fiNumSnowballLats(BODY *, int);
+int fbSeasonalConverged(BODY *, int);
+void fvSeasonalSkipAhead(BODY *, int, int);
 int fbSnowballLand(BODY *, int);
 int fbSnowballSea(BODY *, int);
 int fbIceFree(BODY *, int);
@@ -292,6 +309,7 @@ void fvPropsAuxPoise(BODY *, EVOLVE *, IO *, UPDATE *, int);
 void fvForceObliq(BODY *, EVOLVE *, int);
 void fvForceEcc(BODY *, EVOLVE *, int);
 void fvDailyInsolation(BODY *, int, int);
+int fbInsolCached(BODY *, int, double, double);
 void fvAlbedoTOAhm16(BODY *, double, int, int);
 
 
@@ -7,9 +7,10 @@
 
 #ifdef VPLANET_PYTHON_INTERFACE
 
-#include "vplanet.h"
+// Python.h first, as it must not see the allocation macros of vplanet.h
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include "vplanet.h"
 
 // Get the code version, passed in as a macro
 #ifndef VPLANET_VERSION
@@ -44,16 +45,73 @@ static PyObject *vplanet_core_run(PyObject *self, PyObject *args) {
     return NULL;
   }
 
-  // Run vplanet
-  main_impl(argc, &argv);
+  // Run vplanet. Errors return here rather than ending the interpreter, and
+  // other Python threads run meanwhile, as the run frees all it allocates.
+  int iCode;
+  Py_BEGIN_ALLOW_THREADS
+  iCode = main_impl(argc, &argv);
+  fflush(stdout);
+  Py_END_ALLOW_THREADS
+
+  // Return the exit code
+  return PyLong_FromLong(iCode);
+}
+
+static PyObject *vplanet_core_run_inputs(PyObject *self, PyObject *args) {
+
+  // A dict of input file names to dicts of their options, then the options
+  PyObject *pInputs, *pFile, *pOptions, *pName, *pValue;
+  Py_ssize_t iFile = 0, iOption;
+  const char *cFile, *cName, *cValue;
+  int argc = PyTuple_GET_SIZE(args) - 1;
+  const char *argv[9];
+  int iCode;
+  if (!PyArg_ParseTuple(args, "O!|sssssssss", &PyDict_Type, &pInputs,
+                        &argv[0], &argv[1], &argv[2], &argv[3], &argv[4],
+                        &argv[5], &argv[6], &argv[7], &argv[8])) {
+    return NULL;
+  }
+
+  // The options go straight into the tables the input files are read into
+  while (PyDict_Next(pInputs, &iFile, &pFile, &pOptions)) {
+    if (!PyDict_Check(pOptions)) {
+      PyErr_SetString(PyExc_TypeError, "The options of a file must be a dict.");
+      FreeInputTables();
+      return NULL;
+    }
+    iOption = 0;
+    while (PyDict_Next(pOptions, &iOption, &pName, &pValue)) {
+      cFile  = PyUnicode_AsUTF8(pFile);
+      cName  = PyUnicode_AsUTF8(pName);
+      cValue = PyUnicode_AsUTF8(pValue);
+      if (cFile == NULL || cName == NULL || cValue == NULL) {
+        FreeInputTables();
+        return NULL;
+      }
+      if (!fbAddInputOption((char *)cFile, (char *)cName, (char *)cValue)) {
+        PyErr_Format(PyExc_ValueError, "Option %s of %s is too long.", cName,
+                     cFile);
+        FreeInputTables();
+        return NULL;
+      }
+    }
+  }
+
+  // Run vplanet on these options, as vplanet_core_run does
+  Py_BEGIN_ALLOW_THREADS
+  iCode = main_impl(argc, &argv);
+  fflush(stdout);
+  Py_END_ALLOW_THREADS
+
+  // A run frees the tables when it ends, but it may not have started
+  FreeInputTables();
 
-  // Return None
-  Py_INCREF(Py_None);
-  return Py_None;
+  return PyLong_FromLong(iCode);
 }
 
 static PyMethodDef VplanetCoreMethods[] = {
       {"run", vplanet_core_run, METH_VARARGS, NULL},
+      {"run_inputs", vplanet_core_run_inputs, METH_VARARGS, NULL},
       {"version", vplanet_core_version, METH_VARARGS, NULL},
       {NULL, NULL, 0, NULL}};
 
@@ -2964,7 +2964,7 @@ void fvRadheatExit(FILES *files, char cSpecies[16], int iFile) {
   fprintf(stderr, "ERROR: Radheat called, but no %s option provided.\n",
           cSpecies);
   fprintf(stderr, "\tFile: %s\n", files->Infile[iFile].cIn);
-  exit(EXIT_INPUT);
+  VplanetExit(EXIT_INPUT);
 }
 
 
@@ -23,8 +23,6 @@ void BodyCopySpiNBody(BODY *dest, BODY *src, int iFoo, int iNumBodies,
   dest[iBody].dPositionY = src[iBody].dPositionY;
   dest[iBody].dPositionZ = src[iBody].dPositionZ;
 
-  dest[iBody].iGravPertsSpiNBody = src[iBody].iGravPertsSpiNBody;
-
   iGravPerts = src[iBody].iGravPertsSpiNBody;
   for (jBody = 0; jBody < iGravPerts; jBody++) {
     // dest[iBody].dDistance3[jBody]  = src[iBody].dDistance3[jBody];
@@ -38,6 +36,8 @@ void InitializeUpdateTmpBodySpiNBody(BODY *body, CONTROL *control,
                                      UPDATE *update, int iBody) {
   int jBody;
   // This replaces malloc'ing the destination body in BodyCopySpiNBody
+  control->Evolve.tmpBody[iBody].iGravPertsSpiNBody =
+        body[iBody].iGravPertsSpiNBody;
   control->Evolve.tmpBody[iBody].dDistance3 =
         malloc(control->Evolve.iNumBodies * sizeof(double));
   control->Evolve.tmpBody[iBody].dDistanceX =
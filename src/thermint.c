@@ -5450,7 +5450,7 @@ double cubicroot(int type, BODY *body, int iBody) {
                   27.0 * pow(a, 2.0) * d; // cubic root component (wikip)
   if ((pow(delta1, 2.0) - 4.0 * cube(delta0)) < 0) {
     //        printf("imaginary cubic root!\n");
-    //        exit(1);
+    //        VplanetExit(1);
     return 0; // imaginary root implies no intersection, no melt layer?
   }
   double croot =
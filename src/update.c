@@ -86,7 +86,7 @@ void AddPrimaryVariable(BODY *body,CONTROL *control,MODULE *module,UPDATE *updat
       update[iBody].iaModule[*iVar] =
             malloc(iNumPrimaryVariable * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[*iVar] =
               dTmpPrimaryVariable;
         control->Evolve.tmpUpdate[iBody].iNumBodies[*iVar] =
@@ -99,7 +99,7 @@ void AddPrimaryVariable(BODY *body,CONTROL *control,MODULE *module,UPDATE *updat
               malloc(iNumPrimaryVariable * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[*iVar] =
               malloc(iNumPrimaryVariable * sizeof(int *));
-        for (int iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (int iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][*iVar] =
                   malloc(update[iBody].iNumVars * sizeof(double));
         }
@@ -233,7 +233,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     update[iBody].iaBody     = malloc(update[iBody].iNumVars * sizeof(int **));
 
     // May also have to allocate space for the temp UPDATE
-    if (control->Evolve.iOneStep == RUNGEKUTTA) {
+    if (control->Evolve.iOneStep != EULER) {
       control->Evolve.tmpUpdate[iBody].iaVar =
             malloc(update[iBody].iNumVars * sizeof(int));
       control->Evolve.tmpUpdate[iBody].iNumEqns =
@@ -253,9 +253,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       control->Evolve.tmpUpdate[iBody].iaBody =
             malloc(update[iBody].iNumVars * sizeof(int **));
     }
-    for (iSubStep = 0; iSubStep < 4; iSubStep++) {
-      control->Evolve.daDeriv[iSubStep][iBody] =
-            malloc(update[iBody].iNumVars * sizeof(double));
+    for (iSubStep = 0; iSubStep < NUMSTAGES; iSubStep++) {
       control->Evolve.daDerivProc[iSubStep][iBody] =
             malloc(update[iBody].iNumVars * sizeof(double*));
     }
@@ -280,7 +278,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumVelX * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dVelX;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -293,7 +291,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumVelX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumVelX * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -324,7 +322,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumVelY * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dVelY;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -337,7 +335,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumVelY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumVelY * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -368,7 +366,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumVelZ * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dVelZ;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -381,7 +379,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumVelZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumVelZ * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -413,7 +411,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumPositionX * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dPositionX;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -426,7 +424,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumPositionX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumPositionX * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -458,7 +456,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumPositionY * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dPositionY;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -471,7 +469,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumPositionY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumPositionY * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -503,7 +501,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumPositionZ * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dPositionZ;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -516,7 +514,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumPositionZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumPositionZ * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -550,7 +548,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dWaterMassMOAtm;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -563,7 +561,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -595,7 +593,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumWaterMassSol * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dWaterMassSol;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -608,7 +606,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumWaterMassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumWaterMassSol * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -640,7 +638,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumSurfTemp * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dSurfTemp;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -653,7 +651,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumSurfTemp * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumSurfTemp * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -685,7 +683,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumSolidRadius * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dSolidRadius;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -698,7 +696,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumSolidRadius * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumSolidRadius * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -730,7 +728,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumPotTemp * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dPotTemp;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -743,7 +741,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumPotTemp * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumPotTemp * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -775,7 +773,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dOxygenMassMOAtm;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -788,7 +786,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -820,7 +818,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumOxygenMassSol * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dOxygenMassSol;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -833,7 +831,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumOxygenMassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumOxygenMassSol * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -865,7 +863,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dHydrogenMassSpace;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -878,7 +876,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -910,7 +908,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumOxygenMassSpace * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dOxygenMassSpace;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -923,7 +921,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumOxygenMassSpace * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumOxygenMassSpace * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -955,7 +953,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCO2MassMOAtm;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -968,7 +966,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1000,7 +998,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumCO2MassSol * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCO2MassSol;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1013,7 +1011,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumCO2MassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumCO2MassSol * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1049,7 +1047,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum26AlCore * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d26AlNumCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1062,7 +1060,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum26AlCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum26AlCore * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1095,7 +1093,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum26AlMan * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d26AlNumMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1108,7 +1106,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum26AlMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum26AlMan * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1141,7 +1139,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum40KCore * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d40KNumCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1154,7 +1152,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum40KCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum40KCore * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1187,7 +1185,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum40KMan * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d40KNumMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1200,7 +1198,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum40KMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum40KMan * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1233,7 +1231,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum40KCrust * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d40KNumCrust;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1246,7 +1244,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum40KCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum40KCrust * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1279,7 +1277,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum232ThCore * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d232ThNumCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1292,7 +1290,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum232ThCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum232ThCore * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1325,7 +1323,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum232ThMan * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d232ThNumMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1338,7 +1336,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum232ThMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum232ThMan * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1371,7 +1369,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum232ThCrust * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d232ThNumCrust;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1384,7 +1382,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum232ThCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum232ThCrust * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1417,7 +1415,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum235UCore * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d235UNumCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1430,7 +1428,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum235UCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum235UCore * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1463,7 +1461,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum235UMan * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d235UNumMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1476,7 +1474,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum235UMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum235UMan * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1509,7 +1507,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum235UCrust * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d235UNumCrust;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1522,7 +1520,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum235UCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum235UCrust * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1555,7 +1553,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum238UCore * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d238UNumCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1568,7 +1566,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum238UCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum238UCore * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1601,7 +1599,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum238UMan * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d238UNumMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1614,7 +1612,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum238UMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum238UMan * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1647,7 +1645,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNum238UCrust * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d238UNumCrust;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1660,7 +1658,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNum238UCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNum238UCrust * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1693,7 +1691,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumEnvelopeMass * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dEnvelopeMass;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1706,7 +1704,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumEnvelopeMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumEnvelopeMass * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1745,7 +1743,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumDynEllip * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dDynEllip;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1758,7 +1756,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumDynEllip * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumDynEllip * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1790,7 +1788,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumHecc * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dHecc;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1803,7 +1801,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumHecc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumHecc * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1835,7 +1833,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumKecc * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dKecc;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1848,7 +1846,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumKecc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumKecc * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1887,7 +1885,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumLuminosity * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dLuminosity;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1900,7 +1898,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumLuminosity * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumLuminosity * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -1931,7 +1929,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     malloc(update[iBody].iNumObl*sizeof(int)); update[iBody].iaModule[iVar] =
     malloc(update[iBody].iNumObl*sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
     &control->Evolve.tmpBody[iBody].dObliquity;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1971,7 +1969,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumPinc * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dPinc;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -1984,7 +1982,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumPinc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumPinc * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2016,7 +2014,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumQinc * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dQinc;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2029,7 +2027,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumQinc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumQinc * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2062,7 +2060,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumRadius * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dRadius;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2075,7 +2073,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumRadius * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumRadius * sizeof(int *));
-      for (iSubStep=0; iSubStep < 4; iSubStep++) {
+      for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2107,7 +2105,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumMass * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dMass;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2120,7 +2118,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumMass * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2152,7 +2150,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumRot * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dRotRate;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2165,7 +2163,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumRot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumRot * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2197,7 +2195,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumSemi * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dSemi;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2210,7 +2208,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumSemi * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumSemi * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2247,7 +2245,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dSurfaceWaterMass;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2260,7 +2258,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2293,7 +2291,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumOxygenMass * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dOxygenMass;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2306,7 +2304,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumOxygenMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumOxygenMass * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }              
@@ -2339,7 +2337,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumOxygenMantleMass * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dOxygenMantleMass;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2352,7 +2350,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumOxygenMantleMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumOxygenMantleMass * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2385,7 +2383,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumTemperature * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dTemperature;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2398,7 +2396,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumTemperature * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumTemperature * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2431,7 +2429,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumRadGyra * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dRadGyra;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2444,7 +2442,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumRadGyra * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumRadGyra * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2477,7 +2475,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumTCore * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dTCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2490,7 +2488,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumTCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumTCore * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2522,7 +2520,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumTMan * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dTMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2535,7 +2533,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumTMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumTMan * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2567,7 +2565,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumXobl * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dXobl;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2581,7 +2579,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumXobl * sizeof(int *));
         control->Evolve.tmpUpdate[iBody].iXobl = iVar;
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2613,7 +2611,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumYobl * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dYobl;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2627,7 +2625,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumYobl * sizeof(int *));
         control->Evolve.tmpUpdate[iBody].iYobl = iVar;
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2659,7 +2657,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumZobl * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dZobl;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2673,7 +2671,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumZobl * sizeof(int *));
         control->Evolve.tmpUpdate[iBody].iZobl = iVar;
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2707,7 +2705,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumCBPR * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPR;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2720,7 +2718,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumCBPR * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumCBPR * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2753,7 +2751,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumCBPZ * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPZ;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2766,7 +2764,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumCBPZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumCBPZ * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2800,7 +2798,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumCBPPhi * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPPhi;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2813,7 +2811,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumCBPPhi * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumCBPPhi * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2847,7 +2845,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumCBPRDot * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPRDot;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2860,7 +2858,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumCBPRDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumCBPRDot * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2894,7 +2892,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumCBPZDot * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPZDot;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2907,7 +2905,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumCBPZDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumCBPZDot * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2941,7 +2939,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumCBPPhiDot * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPPhiDot;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -2954,7 +2952,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumCBPPhiDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumCBPPhiDot * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -2995,7 +2993,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     //         update[iBody].iaModule[iVar] =
     //         malloc(update[iBody].iNumIceMass*sizeof(int));
     //
-    //         if (control->Evolve.iOneStep == RUNGEKUTTA) {
+    //         if (control->Evolve.iOneStep != EULER) {
     //
     //           control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
     //           &control->Evolve.tmpBody[iBody].daIceMass[iLat];
@@ -3037,7 +3035,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumEccX * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dEccX;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -3050,7 +3048,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumEccX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumEccX * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -3082,7 +3080,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumEccY * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dEccY;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -3095,7 +3093,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumEccY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumEccY * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -3127,7 +3125,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumEccZ * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dEccZ;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -3140,7 +3138,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumEccZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumEccZ * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -3173,7 +3171,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumAngMX * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dAngMX;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -3186,7 +3184,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumAngMX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumAngMX * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -3219,7 +3217,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumAngMY * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dAngMY;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -3232,7 +3230,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumAngMY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumAngMY * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -3265,7 +3263,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumAngMZ * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dAngMZ;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -3278,7 +3276,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumAngMZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumAngMZ * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -3317,7 +3315,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumLXUV * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dLXUV;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -3330,7 +3328,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumLXUV * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumLXUV * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -3363,7 +3361,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumLostAngMom * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dLostAngMom;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -3376,7 +3374,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumLostAngMom * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumLostAngMom * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
@@ -3409,7 +3407,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaModule[iVar] =
             malloc(update[iBody].iNumLostEng * sizeof(int));
 
-      if (control->Evolve.iOneStep == RUNGEKUTTA) {
+      if (control->Evolve.iOneStep != EULER) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dLostEng;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
@@ -3422,7 +3420,7 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               malloc(update[iBody].iNumLostEng * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
               malloc(update[iBody].iNumLostEng * sizeof(int *));
-        for (iSubStep=0; iSubStep < 4; iSubStep++) {
+        for (iSubStep=0; iSubStep < NUMSTAGES; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
                   malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
         }
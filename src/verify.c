@@ -50,14 +50,14 @@ int bFileExists(const char *filename) {
 void OverwriteExit(char cName[], char cFile[]) {
   fprintf(stderr, "ERROR: %s is false and %s exists.\n", cName, cFile);
   fprintf(stderr, "\tOveride with \"-f\" on the command line.\n");
-  exit(EXIT_INPUT);
+  VplanetExit(EXIT_INPUT);
 }
 
 /* XXX Should these be iLine+1? */
 void DoubleLineExit(char cFile1[], char cFile2[], int iLine1, int iLine2) {
   fprintf(stderr, "\tFile: %s, Line: %d.\n", cFile1, iLine1 + 1);
   fprintf(stderr, "\tFile: %s, Line: %d.\n", cFile2, iLine2 + 1);
-  exit(EXIT_INPUT);
+  VplanetExit(EXIT_INPUT);
 }
 
 void VerifyOrbitExit(char cName1[], char cName2[], char cFile1[], char cFile2[],
@@ -67,7 +67,7 @@ void VerifyOrbitExit(char cName1[], char cName2[], char cFile1[], char cFile2[],
     fprintf(stderr, "\tFile: %s, Line: %d.\n", cFile1, iLine1);
     fprintf(stderr, "\tFile: %s, Line: %d.\n", cFile2, iLine2);
   }
-  exit(EXIT_INPUT);
+  VplanetExit(EXIT_INPUT);
 }
 
 void VerifyBodyExit(char cName1[], char cName2[], char cFile[], int iLine1,
@@ -78,7 +78,7 @@ void VerifyBodyExit(char cName1[], char cName2[], char cFile[], int iLine1,
             cName2);
     fprintf(stderr, "\tFile: %s, Lines: %d and %d\n", cFile, iLine1, iLine2);
   }
-  exit(EXIT_INPUT);
+  VplanetExit(EXIT_INPUT);
 }
 
 /** Print three lines that are in conflict
@@ -88,7 +88,7 @@ void VerifyBodyExit(char cName1[], char cName2[], char cFile[], int iLine1,
 void TripleLineExit(char cFile[], int iLine1, int iLine2, int iLine3) {
   fprintf(stderr, "\tFile: %s, Lines: %d, %d and %d.\n", cFile, iLine1, iLine2,
           iLine3);
-  exit(EXIT_INPUT);
+  VplanetExit(EXIT_INPUT);
 }
 
 /* Do we need both these? */
@@ -245,7 +245,7 @@ void VerifyOrbit(BODY *body, CONTROL *control, FILES files, OPTIONS *options,
     fprintf(stderr, "ERROR: Must set one of %s, %s or %s.\n",
             options[OPT_ORBSEMI].cName, options[OPT_ORBMEANMOTION].cName,
             options[OPT_ORBPER].cName);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   /* If Semi set, was anything else? */
@@ -409,8 +409,11 @@ void VerifyIntegration(BODY *body, CONTROL *control, FILES *files,
     control->Evolve.iDir = 1;
   }
 
-  /* Check for file existence */
-  for (iFile = 0; iFile < files->iNumInputs - 1; iFile++) {
+  /* Check for file existence. A restarted run continues its output files, and
+     a streamed run does not write them. */
+  for (iFile = 0; iFile < files->iNumInputs - 1 && !control->Io.bRestart &&
+                  !control->Io.bStream;
+       iFile++) {
     if (bFileExists(files->Outfile[iFile].cOut)) {
       if (!control->Io.bOverwrite) {
         OverwriteExit(options[OPT_OVERWRITE].cName, files->Outfile[iFile].cOut);
@@ -422,6 +425,26 @@ void VerifyIntegration(BODY *body, CONTROL *control, FILES *files,
     }
   }
 
+  if (control->Io.bStream) {
+    control->Io.iOutputFormat = OUTPUTCONTAINER;
+  } else if (control->Io.iOutputFormat == OUTPUTCONTAINER) {
+    if (snprintf(control->Io.cContainer, NAMELEN, "%s.container",
+                 system->cName) >= NAMELEN) {
+      fprintf(stderr, "ERROR: Container file name %s.container is too long.\n",
+              system->cName);
+      LineExit(files->Infile[0].cIn, options[OPT_SYSTEMNAME].iLine[0]);
+    }
+    if (!control->Io.bRestart && bFileExists(control->Io.cContainer)) {
+      if (!control->Io.bOverwrite) {
+        OverwriteExit(options[OPT_OVERWRITE].cName, control->Io.cContainer);
+      }
+      if (control->Io.iVerbose >= VERBINPUT) {
+        fprintf(stderr, "WARNING: %s exists.\n", control->Io.cContainer);
+      }
+      unlink(control->Io.cContainer);
+    }
+  }
+
   /* Was DoBackward or DoForward NOT set? */
   if (!control->Evolve.bDoBackward && !control->Evolve.bDoForward) {
     for (iFile = 0; iFile < files->iNumInputs; iFile++) {
@@ -473,6 +496,10 @@ void VerifyIntegration(BODY *body, CONTROL *control, FILES *files,
     *fnOneStep = &EulerStep;
   } else if (control->Evolve.iOneStep == RUNGEKUTTA) {
     *fnOneStep = &RungeKutta4Step;
+  } else if (control->Evolve.iOneStep == RK45) {
+    *fnOneStep = &RungeKutta45Step;
+  } else if (control->Evolve.iOneStep == ROSENBROCK) {
+    *fnOneStep = &RosenbrockStep;
   } else {
     /* Assign Default */
     strcpy(cTmp, options[OPT_INTEGRATIONMETHOD].cDefault);
@@ -491,6 +518,22 @@ void VerifyIntegration(BODY *body, CONTROL *control, FILES *files,
     }
   }
 
+  /* Dense output interpolates across the Runge-Kutta stages */
+  if (control->Io.bDenseOutput && control->Evolve.iOneStep != RUNGEKUTTA &&
+      control->Evolve.iOneStep != RK45) {
+    if (control->Io.iVerbose >= VERBERR) {
+      fprintf(stderr,
+              "ERROR: %s = 1 requires %s = Runge-Kutta4 or RK45.\n",
+              options[OPT_DENSEOUTPUT].cName,
+              options[OPT_INTEGRATIONMETHOD].cName);
+    }
+    for (iFile = 0; iFile < files->iNumInputs; iFile++) {
+      if (options[OPT_DENSEOUTPUT].iLine[iFile] > -1) {
+        LineExit(files->Infile[iFile].cIn, options[OPT_DENSEOUTPUT].iLine[iFile]);
+      }
+    }
+  }
+
   /* Make sure output interval is less than stop time */
   if (control->Evolve.dStopTime < control->Io.dOutputTime) {
     fprintf(stderr, "ERROR: %s < %s is not allowed.\n",
@@ -543,7 +586,7 @@ void VerifyMassRad(BODY *body, CONTROL *control, OPTIONS *options, char cFile[],
               options[OPT_MASS].cName, options[OPT_RADIUS].cName,
               options[OPT_DENSITY].cName);
     }
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   /* Were all set? */
@@ -554,7 +597,7 @@ void VerifyMassRad(BODY *body, CONTROL *control, OPTIONS *options, char cFile[],
                      options[OPT_DENSITY].cName, options[OPT_MASS].iLine[iFile],
                      options[OPT_RADIUS].iLine[iFile],
                      options[OPT_DENSITY].iLine[iFile], cFile, iVerbose);
-    exit(EXIT_INPUT);
+    VplanetExit(EXIT_INPUT);
   }
 
   /* Was mass set? */
@@ -1164,12 +1207,24 @@ void VerifyOptions(BODY *body, CONTROL *control, FILES *files, MODULE *module,
     }
 
     /* Must allocate memory in control struct for all perturbing bodies */
-    if (control->Evolve.iOneStep == RUNGEKUTTA) {
+    if (control->Evolve.iOneStep != EULER) {
       InitializeUpdateBodyPerts(control, update, iBody);
       InitializeUpdateTmpBody(body, control, module, update, iBody);
     }
   }
 
+  if (control->Evolve.iOneStep != EULER) {
+    InitializeStateVector(control, update);
+  }
+  // Only RK45 reuses its last stage
+  control->Evolve.bFSAL = 0;
+  if (control->Evolve.iOneStep == RK45) {
+    InitializeRungeKutta45(control, update, *fnUpdate);
+  } else if (control->Evolve.iOneStep == ROSENBROCK) {
+    InitializeRosenbrock(control, update);
+  }
+  InitializeDerivativeTasks(control, update);
+
   // Verify multi-module parameters
   for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
     if (body[iBody].bEqtide) {
@@ -1177,6 +1232,9 @@ void VerifyOptions(BODY *body, CONTROL *control, FILES *files, MODULE *module,
     }
   }
 
+  // Outputs removed by the modules above can no longer be matched
+  InitializeOutputColumns(control, files, output);
+
   // Initialize angular momentum and energy prior to logging/integration
   InitializeConstants(body, update, control, system, options);
 
@@ -23,7 +23,9 @@ const double dTINY = 1. / DBL_MAX; // This is the smallest possibled double
 
 /*!
 Actual implementation of the main function; called from in `int main()` below.
-We need this wrapper so we can call `main_impl` from Python.
+We need this wrapper so we can call `main_impl` from Python. Errors return
+here through VplanetExit, so the caller gets the exit code instead of the
+process ending.
 
  */
 int main_impl(int argc, char *argv[]) {
@@ -48,20 +50,16 @@ int main_impl(int argc, char *argv[]) {
   dStartTime = time(NULL);
   */
 
-  int iOption, iVerbose, iQuiet, iOverwrite;
+  int iOption, iVerbose, iQuiet, iOverwrite, iRestart, iTable, iJobs, iNumJobs;
+  int iStream, iLockstep, iCode;
+  jmp_buf jmpError;
   OPTIONS *options;
   OUTPUT *output;
-  CONTROL control;
-  UPDATE *update;
-  BODY *body;
-  MODULE module;
+  CONTROL control, *controlPrevious;
   FILES files;
-  SYSTEM system;
   char infile[NAMELEN];
   fnReadOption fnRead[MODULEOPTEND]; // XXX Pointers?
   fnWriteOutput fnWrite[MODULEOUTEND];
-  fnUpdateVariable ***fnUpdate;
-  fnIntegrate fnOneStep;
 
 #ifdef GITVERSION
   strcpy(control.sGitVersion, GITVERSION);
@@ -81,6 +79,23 @@ int main_impl(int argc, char *argv[]) {
   output = malloc(MODULEOUTEND * sizeof(OUTPUT));
   InitializeOutput(&files, output, fnWrite);
 
+  control.Io.fpContainer  = NULL;
+  control.Io.writer       = NULL;
+  control.pjmpErrorReturn = &jmpError;
+  control.iErrorCode      = 0;
+  control.bRunAllocs      = 0;
+  control.allocs          = NULL;
+  controlPrevious         = SetRunControl(&control);
+  if (setjmp(jmpError) != 0) {
+    EndRun(&control);
+    SetRunControl(controlPrevious);
+    FreeOptions(options);
+    free(options);
+    FreeOutput(output);
+    free(output);
+    return control.iErrorCode;
+  }
+
   /* Set to IntegrationMethod to 0, so default can be
      assigned if necessary */
   control.Evolve.iOneStep = 0;
@@ -91,16 +106,26 @@ int main_impl(int argc, char *argv[]) {
   if (argc == 1) {
     fprintf(stderr,
             "Usage: %s [-v, -verbose] [-q, -quiet] [-h, -help] [-H, -Help] "
+            "[-r, -restart] [-e <table> [-j <jobs>] [-l]] [-s <stream>] "
             "<file>\n",
             argv[0]);
-    exit(EXIT_EXE);
+    VplanetExit(EXIT_EXE);
   }
 
-  iVerbose              = -1;
-  iQuiet                = -1;
-  iOverwrite            = -1;
-  control.Io.iVerbose   = -1;
-  control.Io.bOverwrite = -1;
+  iVerbose                 = -1;
+  iQuiet                   = -1;
+  iOverwrite               = -1;
+  iRestart                 = -1;
+  iTable                   = -1;
+  iJobs                    = -1;
+  iNumJobs                 = 0;
+  iStream                  = -1;
+  iLockstep                = -1;
+  control.Io.iVerbose      = -1;
+  control.Io.bOverwrite    = -1;
+  control.Io.bRestart      = 0;
+  control.Io.iOutputFormat = OUTPUTTEXT;
+  control.Io.bStream       = 0;
 
   /* Check for flags */
   for (iOption = 1; iOption < argc; iOption++) {
@@ -116,80 +141,242 @@ int main_impl(int argc, char *argv[]) {
       control.Io.bOverwrite = 1;
       iOverwrite            = iOption;
     }
+    if (memcmp(argv[iOption], "-r", 2) == 0) {
+      control.Io.bRestart = 1;
+      iRestart            = iOption;
+    }
     if (memcmp(argv[iOption], "-h", 2) == 0) {
       Help(options, output, files.cExe, 0);
     }
     if (memcmp(argv[iOption], "-H", 2) == 0) {
       Help(options, output, files.cExe, 1);
     }
+    if (memcmp(argv[iOption], "-e", 2) == 0) {
+      if (iOption + 1 >= argc) {
+        fprintf(stderr, "ERROR: -e requires an ensemble table.\n");
+        VplanetExit(EXIT_EXE);
+      }
+      iTable = iOption;
+    }
+    if (memcmp(argv[iOption], "-j", 2) == 0) {
+      if (iOption + 1 >= argc || atoi(argv[iOption + 1]) < 1) {
+        fprintf(stderr, "ERROR: -j requires a positive number of jobs.\n");
+        VplanetExit(EXIT_EXE);
+      }
+      iJobs    = iOption;
+      iNumJobs = atoi(argv[iOption + 1]);
+    }
+    if (memcmp(argv[iOption], "-l", 2) == 0) {
+      iLockstep = iOption;
+    }
+    if (memcmp(argv[iOption], "-s", 2) == 0) {
+      if (iOption + 1 >= argc) {
+        fprintf(stderr, "ERROR: -s requires a file to stream to.\n");
+        VplanetExit(EXIT_EXE);
+      }
+      iStream = iOption;
+    }
+  }
+
+  if (iJobs != -1 && iTable == -1) {
+    fprintf(stderr, "ERROR: -j can only be set with -e.\n");
+    VplanetExit(EXIT_EXE);
+  }
+
+  if (iLockstep != -1 && iTable == -1) {
+    fprintf(stderr, "ERROR: -l can only be set with -e.\n");
+    VplanetExit(EXIT_EXE);
+  }
+
+  if (iRestart != -1 && iTable != -1) {
+    fprintf(stderr, "ERROR: -r and -e cannot be set simultaneously.\n");
+    VplanetExit(EXIT_EXE);
+  }
+
+  if (iStream != -1 && iTable != -1) {
+    fprintf(stderr, "ERROR: -s and -e cannot be set simultaneously.\n");
+    VplanetExit(EXIT_EXE);
   }
 
   if (iQuiet != -1 && iVerbose != -1) {
     fprintf(stderr, "ERROR: -v and -q cannot be set simultaneously.\n");
-    exit(EXIT_EXE);
+    VplanetExit(EXIT_EXE);
   }
 
   /* Now identify input file, usually vpl.in */
   for (iOption = 1; iOption < argc; iOption++) {
-    if (iOption != iVerbose && iOption != iQuiet && iOption != iOverwrite) {
+    if (iOption != iVerbose && iOption != iQuiet && iOption != iOverwrite &&
+        iOption != iRestart && iOption != iTable && iOption != iTable + 1 &&
+        iOption != iJobs && iOption != iJobs + 1 && iOption != iLockstep &&
+        iOption != iStream && iOption != iStream + 1) {
       strcpy(infile, argv[iOption]);
     }
   }
 
+  /* With -s every output is sent, in the container format, to one file that
+     is usually a pipe to the Python wrapper, and no output files are
+     written. A pipe cannot be positioned, so the container starts here. */
+  if (iStream != -1) {
+    control.Io.bStream = 1;
+    if (strlen(argv[iStream + 1]) >= NAMELEN) {
+      fprintf(stderr, "ERROR: -s file name %s is too long.\n",
+              argv[iStream + 1]);
+      VplanetExit(EXIT_EXE);
+    }
+    strcpy(control.Io.cContainer, argv[iStream + 1]);
+    fpOutputFile(&control.Io.fpContainer, control.Io.cContainer, "wb");
+    control.Io.iContainerSize =
+          fprintf(control.Io.fpContainer, "%s\n", OUTPUTCONTAINERMAGIC);
+  }
+
+  if (iTable != -1) {
+    iCode = RunEnsemble(&control, &files, options, output, fnRead, fnWrite,
+                        infile, argv[iTable + 1], iNumJobs, iLockstep != -1);
+  } else {
+    iCode = RunVplanet(&control, &files, options, output, fnRead, fnWrite,
+                       infile);
+  }
+
+  SetRunControl(controlPrevious);
+  FreeOptions(options);
+  free(options);
+  FreeOutput(output);
+  free(output);
+  return iCode;
+}
+
+/*!
+Free everything a run left: the writer thread, the input tables, the
+container if it is still open, and every allocation the run made. Called when
+a run ends, on success or error.
+ */
+void EndRun(CONTROL *control) {
+  StopWriter(&control->Io.writer);
+  fbCloseOutputFile(&control->Io.fpContainer);
+  FreeInputTables();
+  FreeRunAllocs(control);
+}
+
+
+/*!
+Read and verify the system in infile, and write the input log, so the system
+is ready to evolve.
+ */
+void InitializeRun(CONTROL *control, FILES *files, OPTIONS *options,
+                   OUTPUT *output, fnReadOption fnRead[],
+                   fnWriteOutput fnWrite[], char infile[], BODY **body,
+                   MODULE *module, SYSTEM *system, UPDATE **update,
+                   fnUpdateVariable ****fnUpdate, fnIntegrate *fnOneStep) {
   /* Read input files */
-  ReadOptions(&body, &control, &files, &module, options, output, &system,
-              &update, fnRead, infile);
+  ReadOptions(body, control, files, module, options, output, system, update,
+              fnRead, infile);
 
-  if (control.Io.iVerbose >= VERBINPUT) {
+  if (control->Io.iVerbose >= VERBINPUT) {
     printf("Input files read.\n");
   }
 
   /* Check that user options are mutually compatible */
-  VerifyOptions(body, &control, &files, &module, options, output, &system,
-                update, &fnOneStep, &fnUpdate);
+  VerifyOptions(*body, control, files, module, options, output, system,
+                *update, fnOneStep, fnUpdate);
 
-  if (control.Io.iVerbose >= VERBINPUT) {
+  if (control->Io.iVerbose >= VERBINPUT) {
     printf("Input files verified.\n");
   }
 
-  control.Evolve.dTime      = 0;
-  control.Evolve.bFirstStep = 1;
+  control->Evolve.dTime      = 0;
+  control->Evolve.bFirstStep = 1;
 
-  if (control.Io.bLog) {
-    WriteLog(body, &control, &files, &module, options, output, &system, update,
-             fnUpdate, fnWrite, 0);
-    if (control.Io.iVerbose >= VERBPROG) {
+  /* A restarted run continues the log written by the original run. A
+     streamed run has no log file to continue, so it sends the initial log
+     again, which the checkpoint has not yet replaced. */
+  if (control->Io.bLog && (!control->Io.bRestart || control->Io.bStream)) {
+    WriteLog(*body, control, files, module, options, output, system, *update,
+             *fnUpdate, fnWrite, 0);
+    if (control->Io.iVerbose >= VERBPROG) {
       printf("Log file written.\n");
     }
   }
+}
 
-  /* Perform evolution */
-
-  if (control.Evolve.bDoForward || control.Evolve.bDoBackward) {
-    Evolve(body, &control, &files, &module, output, &system, update, fnUpdate,
-           fnWrite, fnOneStep);
+/*!
+Close the output files of a run, and log the final state if it evolved.
+ */
+void FinishRun(CONTROL *control, FILES *files, OPTIONS *options,
+               OUTPUT *output, fnWriteOutput fnWrite[], BODY *body,
+               MODULE *module, SYSTEM *system, UPDATE *update,
+               fnUpdateVariable ***fnUpdate) {
+  CloseOutputFiles(control, files);
 
-    /* If evolution performed, log final system parameters */
-    if (control.Io.bLog) {
-      WriteLog(body, &control, &files, &module, options, output, &system,
-               update, fnUpdate, fnWrite, 1);
-      if (control.Io.iVerbose >= VERBPROG) {
-        printf("Log file updated.\n");
-      }
+  /* If evolution performed, log final system parameters */
+  if ((control->Evolve.bDoForward || control->Evolve.bDoBackward) &&
+      control->Io.bLog) {
+    WriteLog(body, control, files, module, options, output, system, update,
+             fnUpdate, fnWrite, 1);
+    if (control->Io.iVerbose >= VERBPROG) {
+      printf("Log file updated.\n");
     }
   }
+  CloseStream(control);
 
   // gettimeofday(&end, NULL);
 
-  if (control.Io.iVerbose >= VERBPROG) {
+  if (control->Io.iVerbose >= VERBPROG) {
     printf("Simulation completed.\n");
     // printf("Total time: %.4e [sec]\n",
     // difftime(end.tv_usec,start.tv_usec)/1e6);
   }
-  exit(0);
+}
+
+/*!
+Read, verify and integrate the system in infile. The options and outputs must
+already be initialized, and the command line flags set in control. An error
+anywhere in the run returns here, and the output files are closed with the
+rows written so far. Either way, everything the run allocated is freed, so a
+process can run many systems.
+
+@return 0, or the EXIT_* code of the error that ended the run
+ */
+int RunVplanet(CONTROL *control, FILES *files, OPTIONS *options,
+               OUTPUT *output, fnReadOption fnRead[], fnWriteOutput fnWrite[],
+               char infile[]) {
+  UPDATE *update;
+  BODY *body;
+  MODULE module;
+  SYSTEM system;
+  fnUpdateVariable ***fnUpdate;
+  fnIntegrate fnOneStep;
+  jmp_buf jmpError, *pjmpPrevious;
+
+  files->Outfile           = NULL;
+  pjmpPrevious             = control->pjmpErrorReturn;
+  control->pjmpErrorReturn = &jmpError;
+  BeginRunAllocs(control);
+  if (setjmp(jmpError) != 0) {
+    // An error while closing must not return here again
+    control->pjmpErrorReturn = pjmpPrevious;
+    CloseOutputFiles(control, files);
+    EndRun(control);
+    return control->iErrorCode;
+  }
+
+  InitializeRun(control, files, options, output, fnRead, fnWrite, infile,
+                &body, &module, &system, &update, &fnUpdate, &fnOneStep);
+
+  /* Perform evolution */
+
+  if (control->Evolve.bDoForward || control->Evolve.bDoBackward) {
+    Evolve(body, control, files, &module, output, &system, update, fnUpdate,
+           fnWrite, fnOneStep);
+  }
+  FinishRun(control, files, options, output, fnWrite, body, &module, &system,
+            update, fnUpdate);
+
+  control->pjmpErrorReturn = pjmpPrevious;
+  EndRun(control);
+  return 0;
 }
 
 
 int main(int argc, char *argv[]) {
-  main_impl(argc, argv);
+  return main_impl(argc, argv);
 }
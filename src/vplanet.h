@@ -10,6 +10,7 @@
 #include <ctype.h>
 #include <float.h>
 #include <math.h>
+#include <setjmp.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -26,6 +27,20 @@
 #else
 #include <unistd.h>
 #endif
+/* Functions that never return, e.g. VplanetExit */
+#if defined(__GNUC__)
+#define NORETURN __attribute__((noreturn))
+#elif defined(_MSC_VER)
+#define NORETURN __declspec(noreturn)
+#else
+#define NORETURN
+#endif
+/* Variables with one copy for each thread, e.g. the run of each thread */
+#if defined(_MSC_VER)
+#define THREADLOCAL __declspec(thread)
+#else
+#define THREADLOCAL _Thread_local
+#endif
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -159,6 +174,7 @@ This is necessary in order to add pointers to structs into typedef'd functions
 */
 
 typedef struct BODY BODY;
+typedef struct CHUNK CHUNK;
 typedef struct CONTROL CONTROL;
 typedef struct EVOLVE EVOLVE;
 typedef struct FILES FILES;
@@ -169,9 +185,11 @@ typedef struct MODULE MODULE;
 typedef struct OPTIONS OPTIONS;
 typedef struct OUTFILE OUTFILE;
 typedef struct OUTPUT OUTPUT;
+typedef union RUNALLOC RUNALLOC;
 typedef struct SYSTEM SYSTEM;
 typedef struct UNITS UNITS;
 typedef struct UPDATE UPDATE;
+typedef struct WRITER WRITER;
 typedef struct VERIFY VERIFY;
 
 /*! \brief BODY contains all the physical parameters for every object in the
@@ -704,12 +722,25 @@ struct BODY {
   double dTGlobalTmp;  /**< Mean global surface temp */
   int iWriteLat; /**< Stores index of latitude to be written in write fxn */
   double dMinIceHeight; /**< Minimum ice thickness to count as icy */
+  double dInsolTol;     /**< Orbit change below which insolation is reused */
+  int bInsolCached;     /**< Do the insolation arrays hold the orbit below? */
+  double dInsolObliq;   /**< Obliquity of the insolation arrays */
+  double dInsolEcc;     /**< Eccentricity of the insolation arrays */
+  double dInsolLongP;   /**< Pericenter from equinox of the insolation arrays */
+  double dInsolSemi;    /**< Semi-major axis of the insolation arrays */
+  double dInsolLum;     /**< Stellar luminosity of the insolation arrays */
+  int iInsolNDays;      /**< Days per orbit of the insolation arrays */
+  int bSeasConverge;    /**< Stop seasonal model once it has settled? */
+  int bTempAvgPrev;     /**< Do daTempPrevL/W hold an earlier orbit? */
 
   /* Arrays used by seasonal and annual */
   double *daAnnualInsol; /**< Annually averaged insolation at each latitude */
   double *daDivFlux;     /**< Divergence of surface flux */
   double *daDMidPt;      /**< Diffusion at edges of grid points */
   double **daInsol;      /**< Daily insolation at each latitude */
+  double *daSinLat;      /**< Sine of each latitude */
+  double *daCosLat;      /**< Cosine of each latitude */
+  double *daTanLat;      /**< Tangent of each latitude */
   double *daFlux;        /**< Meridional surface heat flux */
   double *daFluxIn;      /**< Incoming surface flux (insolation) */
   double *daFluxOut;     /**< Outgoing surface flux (longwave) */
@@ -722,21 +753,19 @@ struct BODY {
   double
         *daDiffusionAnn; /**< Diffusion coefficient of each latitude boundary */
   double **daMEulerAnn;  /**< Matrix used for Euler step in annual model */
-  double **daMEulerCopyAnn; /**< Temp copy of Euler matrix */
-  double **daInvMAnn;       /**< Inverted matrix for annual model */
+  double **daMBandAnn;   /**< LU factored band of Euler matrix (annual) */
+  double **daMLowerAnn;  /**< Multipliers of the band LU factors (annual) */
   double *daLambdaAnn;      /**< Diffusion terms for annual matrix */
   double **daMClim;         /**< Raw climate matrix for annual model */
   double **daMDiffAnn;      /**< Diffusion matrix for annual model */
   double *daPlanckAAnn;     /**< Array of Planck A values for ann model */
   double *daPlanckBAnn;     /**< Array of Planck B values for ann model */
-  int *iaRowswapAnn;      /**< Array of interchanged rows in matrix inversion */
-  double *daScaleAnn;     /**< Used in matrix inversion routine */
+  int *iaRowswapAnn;      /**< Array of interchanged rows in band LU */
   double *daSourceF;      /**< Heating terms in EBM */
   double *daTempAnn;      /**< Surface temperature in each cell */
   double *daTempTerms;    /**< Temperature dependent terms in matrix */
   double *daTmpTempAnn;   /**< Temporary copy of temperature */
   double *daTmpTempTerms; /**< Temporary copy of temp dependent terms */
-  double *daUnitVAnn;     /**< Unit vector used in matrix inversion */
 
   /* Arrays for seasonal model */
   double *daAlbedoAvg;    /**< Orbit average albedo by latitude */
@@ -790,23 +819,21 @@ struct BODY {
   double *daIcePropsTmp;    /**< Temporary array used in ice sheet matrix */
   double *daIceSheetDiff;   /**< Diffusion coefficient of ice sheet flow */
   double **daIceSheetMat;   /**< Matrix used in ice sheet flow */
-  double **daInvMSea;       /**< Inverted matrix in seasonal EBM */
   double *daLambdaSea;      /**< Diffusion terms in seasonal EBM matrix */
   double dLandFrac;         /**< Land fraction input by user */
   double *daLandFrac;       /**< Fraction of cell which is land */
   double **daMDiffSea;      /**< Diffusion only matrix in seasonal EBM */
-  double **daMEulerCopySea; /**< Temporary copy of Euler time step matrix
-                               (seasonal) */
+  double **daMBandSea;      /**< LU factored band of Euler matrix (seasonal) */
   double **daMEulerSea;     /**< Euler time step matrix in seasonal EBM */
   double **daMInit;  /**< Temporary matrix used in constructing Euler matrix */
   double **daMLand;  /**< Land terms in seasonal matrix */
+  double **daMLowerSea; /**< Multipliers of the band LU factors (seasonal) */
   double **daMWater; /**< Water terms in seasonal matrix */
   double *daPlanckASea;    /**< Array of Planck A values in seasonal model */
   double *daPlanckBSea;    /**< Array of Planck B values in seasonal model */
   double **daPlanckBDaily; /**< Array of Planck B values over seasonal cycle */
   double *daPlanckBAvg; /**< Orbit averaged Planck B values in seasonal model */
-  int *iaRowswapSea;    /**< Interchanged rows in seasonal matrix inversion */
-  double *daScaleSea;   /**< Used in matrix inversion routine */
+  int *iaRowswapSea;    /**< Interchanged rows in seasonal band LU */
   double *daSeaIceHeight; /**< Sea ice height by latitude */
   double *daSeaIceK;      /**< Heat conductivity of sea ice */
   double *daSedShear;     /**< sediment shear stress (for ice sheets) */
@@ -817,6 +844,8 @@ struct BODY {
   double *daTempAvg;     /**< Temperature averaged over orbit and land/water */
   double *daTempAvgL;    /**< Land temp averaged over orbit */
   double *daTempAvgW;    /**< Water temp averaged over orbit */
+  double *daTempPrevL;   /**< Land temp averaged over previous orbit */
+  double *daTempPrevW;   /**< Water temp averaged over previous orbit */
   double **daTempDaily;  /**< Daily temp over seasonal cycle */
   double *daTempLand;    /**< Temperature over land (by latitude) */
   double *daTempLW;      /**< Surface temperature (avg over land & water) */
@@ -826,7 +855,6 @@ struct BODY {
   double *daTempMinLW;    /**< Minimum temperature over year */
   double *daTempWater;    /**< Temperature over ocean (by lat) */
   double *daTmpTempSea; /**< Temporary copy of temp dependent terms (sea EBM)*/
-  double *daUnitVSea;   /**< Unit vector used in matrix routines */
   double *daWaterFrac;  /**< Fraction of cell which is water */
   double *daXBoundary;  /**< Locations of grid boundaries in x = sin(lat) */
   double *daYBoundary;  /**< Locations of grid boundaries in y = R*lat */
@@ -1724,6 +1752,16 @@ struct UNITS {
    have to be generalized for other modules. */
 typedef void (*fnBodyCopyModule)(BODY *, BODY *, int, int, int);
 
+/* Derivative of a primary variable. Declared here as the integrator state
+   in EVOLVE keeps copies of these pointers. */
+typedef double (*fnUpdateVariable)(BODY *, SYSTEM *, int *);
+
+/* The same derivative for many systems at once, see the lockstep ensembles
+   in ensemble.c: the BODY arrays of the systems, the bodies of the equation
+   in each system, the number of systems, and where to write each system's
+   derivative. */
+typedef void (*fnUpdateLanes)(BODY **, int **, int, double *);
+
 /* Integration parameters */
 struct EVOLVE {
   int bDoForward;    /**< Perform Forward Integration? */
@@ -1745,11 +1783,79 @@ struct EVOLVE {
   // These are to store midpoint derivative info in RK4.
   BODY *tmpBody;     /**< Temporary BODY struct */
   UPDATE *tmpUpdate; /**< Temporary UPDATE struct */
-  double ***daDeriv; /**< The Matrix of Time Derivatives. First dimension is
-                        Body #, second is the Primary variable number, third is
-                        the equation number.  */
   double ****daDerivProc; /**< Derivatives over a timestep */
 
+  /* Packed state vector. All primary variables of all bodies are stored
+     contiguously, body by body, so the integrators' stage arithmetic runs
+     over flat arrays. Values are gathered from and scattered to BODY
+     through the cached pdVar pointers. */
+  int iNumState;          /**< Total number of primary variables */
+  int *iaStateOffset;     /**< Index of each body's first primary variable */
+  int *iaStateBody;       /**< Body number of each state element */
+  int *iaStateVar;        /**< Primary variable number of each element */
+  int *iaStateType;       /**< Type (iaType[iVar][0]) of each element */
+  int *baStateExplicit;   /**< Is the element an explicit function of time? */
+  double **pdStateVar;    /**< update[iBody].pdVar[iVar] of each element */
+  double **pdStateTmpVar; /**< tmpUpdate[iBody].pdVar[iVar] of each element */
+  double *daStateStart;   /**< State at the start of the step */
+  double *daStateStage;   /**< State at which a stage is evaluated */
+  double *daStateEnd;     /**< State at the end of the step (dense output) */
+  double *daStateDense;   /**< Interpolated state of a dense output */
+  double *daAgeEnd;       /**< Ages at the end of the step (dense output) */
+  double **daStateDeriv;  /**< Stage derivatives, [iStage][iState] */
+  int iNumStateProc;      /**< Total number of processes of all variables */
+  int *iaStateProcOffset; /**< Index of each element's first process */
+  double **daStateProc;   /**< Stage process derivatives, [iStage][iProc] */
+
+  /* The per-process derivatives in UPDATE are tagged with the version of the
+     state they were computed for, so they are only evaluated again once the
+     step, ForceBehavior, the output or the auxiliary properties have changed
+     BODY. */
+  int iStateVersion; /**< Incremented whenever BODY is changed */
+  int iDerivVersion; /**< State version of update[].daDerivProc */
+  int bAuxDerivs;    /**< Do the auxiliary properties read daDerivProc? */
+
+  /* Derivative evaluation tasks. Every (iBody, iVar, iEqn) is listed once.
+     The first iNumOwnEqns only read their own body and are grouped by body,
+     with iaOwnEqnOffset[iBody] the first one of iBody. The remaining
+     equations couple bodies and are evaluated after all own-body ones. */
+  int iNumThreads;     /**< Threads evaluating the derivatives */
+  int iNumEqnTasks;    /**< Total number of equations */
+  int iNumOwnEqns;     /**< Number of equations reading only their body */
+  int *iaOwnEqnOffset; /**< First own-body equation of each body */
+  int *iaEqnBody;      /**< Body of each equation */
+  int *iaEqnVar;       /**< Primary variable of each equation */
+  int *iaEqnNum;       /**< Process number of each equation */
+
+  // Adaptive RK45 (Dormand-Prince) step control
+  double dRelTol;       /**< Relative error tolerance per primary variable */
+  double dAbsTol;       /**< Absolute error tolerance per primary variable */
+  double dProposedDt;   /**< Step size proposed by the error controller */
+  int iNumRejected;     /**< Number of rejected RK45 steps */
+  int bFSAL;            /**< Is the last stage valid as next first stage? */
+  double *daFSALState;  /**< State at end of last accepted step */
+  fnUpdateVariable ***fnFSALUpdate; /**< fnUpdate at end of last step */
+  fnUpdateVariable ***fnVerifyUpdate; /**< fnUpdate as VerifyOptions built it */
+
+  // Rosenbrock stiff integrator
+  int iNumStiffVars;       /**< Number of integrated primary variables */
+  int *iaStiffState;       /**< State index of each integrated variable */
+  double **daJacobian;     /**< Finite difference Jacobian of derivatives */
+  double **daStiffMatrix;  /**< 1/(gamma*dt) - Jacobian */
+  double **daStiffLU;      /**< LU decomposition of daStiffMatrix */
+  double *daStiffScale;    /**< Row scaling used by LUDecomp */
+  int *iaStiffRowswap;     /**< Row swaps of the LU decomposition */
+  double **daStiffStage;   /**< Stage vectors of the Rosenbrock step */
+  double *daStiffState;    /**< Primary variables at the start of the step */
+  double *daStiffWork;     /**< Work vector for perturbed/stage states */
+  double *daStiffDeriv0;   /**< Derivatives at the start of the step */
+  double *daStiffDeriv;    /**< Derivatives at a stage */
+  double *daStiffDfDt;     /**< Finite difference derivative wrt age */
+  double dStiffLUDt;       /**< Timestep of the current LU decomposition */
+  double dStiffFirstDt;    /**< First timestep, the scale of the underflow */
+  int iJacobianAge;        /**< Accepted steps since the Jacobian was built */
+  int bJacobianValid;      /**< Does daJacobian hold a usable Jacobian? */
+
   // Module-specific parameters
   int *iNumModules; /**< Number of Modules per Primary Variable */
 
@@ -1782,16 +1888,31 @@ struct IO {
                    4=units; 5=all */
   double dOutputTime; /**< Integration Output Interval */
   double dNextOutput; /**< Time of next output */
+  double dCheckpointTime; /**< Interval between checkpoints; 0 = never */
+  double dNextCheckpoint; /**< Time of next checkpoint */
+  int bRestart;           /**< Resume from the checkpoint? */
+  int bDenseOutput;       /**< Interpolate outputs instead of stepping to them? */
+  int bAsyncOutput;       /**< Write output rows on a background thread? */
+  WRITER *writer;         /**< Background writer, started with the first row */
 
   int bLog; /**< Write Log File? */
 
   /* Output Notation */
   int iDigits; /**< Number of Digits After Decimal */
+  int iOutputFormat; /**< Format of the output files, OUTPUTTEXT,
+                        OUTPUTBINARY or OUTPUTCONTAINER */
   int iSciNot; /**< Crossover Decade to Switch between Standard and Scientific
                   Notation */
 
   int bOverwrite; /**< Allow files to be overwritten? */
 
+  char cContainer[NAMELEN]; /**< File that holds all outputs with
+                               OUTPUTCONTAINER */
+  FILE *fpContainer;        /**< The container, open for the run */
+  long iContainerSize; /**< Bytes written to the container, which may be a
+                          pipe that cannot report its position */
+  int bStream; /**< Are the outputs streamed to the container set by -s? */
+
   /* The following record whether an error message that should only be reported
      once has been printed. */
   /*! Has the message for DeltaTime on the first timestep been printed? */
@@ -1812,7 +1933,6 @@ struct IO {
    halts, units, and the integration, including manipulating the UPDATE
    matrix through fnForceBehavior. */
 
-typedef double (*fnUpdateVariable)(BODY *, SYSTEM *, int *);
 typedef void (*fnPropsAuxModule)(BODY *, EVOLVE *, IO *, UPDATE *, int);
 typedef void (*fnForceBehaviorModule)(BODY *, MODULE *, EVOLVE *, IO *,
                                       SYSTEM *, UPDATE *, fnUpdateVariable ***,
@@ -1858,6 +1978,24 @@ struct CONTROL {
   int bOutputEigen;   /**< Output eigen values? */
 
   int bOrbiters; /**< Does this simulation have orbiting bodies? */
+
+  /* The run in progress, see control.c */
+  jmp_buf *pjmpErrorReturn; /**< Where VplanetExit returns to, NULL to exit */
+  int iErrorCode;           /**< EXIT_* code of the error that ended the run */
+  int bRunAllocs;           /**< Are allocations recorded in allocs? */
+  RUNALLOC *allocs;         /**< Allocations of the run, freed at its end */
+};
+
+/*! \brief Header of every allocation. The allocations made during a run are
+    kept in a list, so that they can all be freed when it ends. */
+union RUNALLOC {
+  struct {
+    RUNALLOC *next;
+    RUNALLOC *prev;
+    RUNALLOC **phead; /**< List of the allocation, NULL if not in a run */
+    size_t iSize;     /**< Size requested */
+  } link;
+  long double dAlign; /**< Keep the allocation aligned for any type */
 };
 
 
@@ -1907,6 +2045,18 @@ struct INFILE {
   /* Array of Vapor pressure file */
 };
 
+/* With sOutputFormat Container, the rows of each output file are collected
+ * in a CHUNK and appended to the container when it is full. */
+
+struct CHUNK {
+  char cName[3 * NAMELEN]; /**< Name of the file the rows replace */
+  char *cColumns;          /**< JSON list of the columns and their units */
+  int iNumCols;            /**< Number of values in a row */
+  int iNumRows;            /**< Number of rows collected */
+  int iMaxRows;            /**< Number of rows in a full chunk */
+  double *daRows;          /**< The rows collected so far */
+};
+
 /* The OUTFILE struct contains all the information
  * regarding the output files. */
 
@@ -1917,6 +2067,14 @@ struct OUTFILE {
   int bNeg[MODULEOUTEND];            /**< Use Negative Option Units? */
   int iNumGrid;                      /**< Number of grid outputs */
   char caGrid[MODULEOUTEND][OPTLEN]; /**< Gridded output name */
+  int iaColOut[MODULEOUTEND];        /**< Output that writes each column */
+  int iaColStart[MODULEOUTEND];      /**< First value of each column in a row */
+  int iNumRowValues;                 /**< Number of values in a row */
+  int iaGridOut[MODULEOUTEND];       /**< Output that writes each grid column */
+  FILE *fp;                          /**< Output file, open for the run */
+  FILE *fpGrid;                      /**< Gridded (.Climate) output file */
+  CHUNK *chunk;                      /**< Rows bound for the container */
+  CHUNK *chunkGrid;                  /**< Grid rows bound for the container */
 };
 
 
@@ -1954,7 +2112,7 @@ struct OPTIONS {
   int iMultiIn;
   int *iLine; /**< Option's Line number in Input File */
   char *iFile;
-  char cFile[MAXFILES][OPTLEN]; /**< File Name Where Set */
+  char (*cFile)[OPTLEN]; /**< File Name Where Set, shared until it is set */
   int bNeg;                     /**< Is There a Negative Option? */
   char cNeg[OPTDESCR];          /**< Description of Negative Unit Conversion */
   int iFileType; /**< What type of file can option be in? 0 = primary only, 1 =
@@ -2378,13 +2536,100 @@ struct MODULE {
 typedef void (*fnIntegrate)(BODY *, CONTROL *, SYSTEM *, UPDATE *,
                             fnUpdateVariable ***, double *, int);
 
+/* ENSEMBLE holds a parameter table: one row per member system, one
+ * column per overridden option of the template input files. */
+typedef struct {
+  char cTable[NAMELEN]; /**< Name of the parameter table */
+  char cDir[NAMELEN];   /**< Directory that holds the member directories */
+  int iNumJobs;         /**< Number of members run at once */
+
+  int iNumFiles;                   /**< Number of template input files */
+  char saFile[MAXFILES][NAMELEN]; /**< Template input files */
+
+  int iNumCols;       /**< Number of overridden options */
+  int *iaColFile;     /**< Index of each column's file in saFile */
+  char **saColOption; /**< Option name of each column */
+
+  int iNumMembers;   /**< Number of member systems */
+  char ***saaValue;  /**< Option value of each member and column */
+  int *iaStatus;     /**< Exit status of each member */
+  int iWidth;        /**< Digits of the member directory names */
+
+  int bLockstep;     /**< Integrate blocks of members in lockstep? */
+  int iBlockSize;    /**< Members per block */
+} ENSEMBLE;
+
+/* Most members a lockstep block integrates together */
+#define ENSEMBLELANES 64
+
+/* MEMBER is one system of a lockstep block, with everything RunVplanet
+ * keeps for its run. */
+typedef struct {
+  CONTROL control;
+  FILES files;
+  MODULE module;
+  SYSTEM system;
+  BODY *body;
+  UPDATE *update;
+  fnUpdateVariable ***fnUpdate;
+  fnIntegrate fnOneStep;
+  double dDt;    /**< Timestep */
+  int iDir;      /**< Direction of the integration */
+  int nSteps;    /**< Steps since the last output */
+  int iMember;   /**< Index of the member in the table */
+  char cDir[2 * NAMELEN + 1]; /**< Directory of the member's output */
+  int *iaDoNeg;  /**< The member's output[].bDoNeg, which the next read
+                      overwrites */
+  int bEnding;   /**< Are the member's files being closed? */
+} MEMBER;
+
+/* LOCKSTEP integrates the members of a block in one process. The members
+ * that share one layout of primary variables and equations take their
+ * 4th order Runge-Kutta steps together, each lane with its own timestep:
+ * lane iLane holds member iaLane[iLane], or -1 once the member has ended.
+ * The state and stage derivatives of all lanes are stored variable by
+ * variable, [iState*ENSEMBLELANES+iLane], so each is one vector. */
+typedef struct {
+  ENSEMBLE *ensemble;       /**< Ensemble of the block */
+  CONTROL *controlBase;     /**< Control struct of the block process */
+  FILES *filesBase;         /**< Files struct the members start from */
+  OPTIONS *options;         /**< Options, reset for every member */
+  OUTPUT *output;           /**< Outputs */
+  fnReadOption *fnRead;     /**< Functions that read the options */
+  fnWriteOutput *fnWrite;   /**< Functions that write the outputs */
+  char *cInfile;            /**< Primary input file of the template */
+
+  MEMBER *member;    /**< The members */
+  int iNumMembers;   /**< Members in the block */
+  int iNumSetUp;     /**< Members read so far */
+  int iCurrent;      /**< Member in progress, which an error ends */
+  int iBaseFd;       /**< Descriptor of the working directory */
+  jmp_buf jmpError;  /**< Where the errors of every member return to */
+
+  int iNumLanes;                  /**< Members integrated in lockstep */
+  int iaLane[ENSEMBLELANES];      /**< Member of each lane */
+  BODY *pbody[ENSEMBLELANES];     /**< Bodies of the stage in progress */
+  double daDt[ENSEMBLELANES];     /**< Timestep of each lane */
+  int iNumState;                  /**< Primary variables of each lane */
+  int *baExplicit;                /**< Is a primary variable explicit? */
+  double *daStart;                /**< State at the start of the step */
+  double *daStage;                /**< State of the stage in progress */
+  double *daaDeriv[4];            /**< Derivatives of the 4 stages */
+  double *daDeriv;                /**< Derivatives the step takes */
+  int iStage;  /**< Stage in progress, or 4 once the step is taken */
+  int iPhase;  /**< 0 before the stage's derivatives, 1 after */
+  int iLane;   /**< Lane in progress, where an error resumes the step */
+} LOCKSTEP;
+
 /*
  * Other Header Files - These are primarily for function declarations
  */
 
 /* Top-level files */
 #include "body.h"
+#include "checkpoint.h"
 #include "control.h"
+#include "ensemble.h"
 #include "evolve.h"
 #include "halt.h"
 #include "module.h"
@@ -2393,6 +2638,7 @@ typedef void (*fnIntegrate)(BODY *, CONTROL *, SYSTEM *, UPDATE *,
 #include "system.h"
 #include "update.h"
 #include "verify.h"
+#include "writer.h"
 
 /* module files */
 #include "atmesc.h"
@@ -2408,3 +2654,10 @@ typedef void (*fnIntegrate)(BODY *, CONTROL *, SYSTEM *, UPDATE *,
 #include "spinbody.h"
 #include "stellar.h"
 #include "thermint.h"
+
+/* Every allocation goes through control.c, which records those made during a
+   run so that the run can free them all when it ends, see fvRunMalloc. */
+#define malloc(iSize) fvRunMalloc(iSize)
+#define calloc(iNum, iSize) fvRunCalloc(iNum, iSize)
+#define realloc(pv, iSize) fvRunRealloc(pv, iSize)
+#define free(pv) RunFree(pv)
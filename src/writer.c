@@ -0,0 +1,353 @@
+/**
+  @file writer.c
+  @brief Format and write output rows on a background thread.
+
+  With bAsyncOutput the evolution loop only computes each row of a .forward,
+  .backward or .Climate file and copies its values into a ring, and a writer
+  thread formats them and writes them to the file. The ring has one producer,
+  the evolution loop, and one consumer, the writer, so each side advances its
+  own counter and reads the other's: no lock is taken while rows flow. The
+  writer sleeps on a condition variable only when the ring is empty, and the
+  loop sleeps on another only when it is full or waits for the writer to
+  finish. The files are opened, and binary headers written, by the loop
+  before the first row is pushed; the writer only appends rows, in the order
+  they were pushed. Write errors stay on the files, which CloseOutputFiles
+  checks.
+
+  Without POSIX threads, i.e. on Windows, rows are written as they are
+  pushed.
+
+  @author Rory Barnes ([RoryBarnes](https://github.com/RoryBarnes/))
+  @date Oct 17 2026
+*/
+
+#include "vplanet.h"
+
+/* One row in the ring. Its values start at iStart in the value ring. */
+typedef struct {
+  FILE *fp;
+  int iFormat;
+  int iNumValues;
+  int iSciNot;
+  int iDigits;
+  size_t iStart;
+} WRITERROW;
+
+/**
+Write one row in its output format.
+
+@param row Row to write
+@param daValues Values of the row, contiguous
+*/
+void WriteWriterRow(WRITERROW *row, double *daValues) {
+  int iValue;
+
+  if (row->iFormat == OUTPUTBINARY) {
+    WriteBinaryRow(row->fp, daValues, row->iNumValues);
+  } else {
+    for (iValue = 0; iValue < row->iNumValues; iValue++) {
+      fprintd(row->fp, daValues[iValue], row->iSciNot, row->iDigits);
+      fprintf(row->fp, " ");
+    }
+    fprintf(row->fp, "\n");
+  }
+}
+
+#ifndef VPLANET_ON_WINDOWS
+#include <pthread.h>
+#include <stdatomic.h>
+
+struct WRITER {
+  WRITERROW *rows;
+  double *daValues;
+  /* Rows pushed, written by the loop only */
+  atomic_size_t iHead;
+  /* Rows written, and the values they held, written by the writer only */
+  atomic_size_t iTail;
+  atomic_size_t iValueTail;
+  /* Values pushed, only used by the loop */
+  size_t iValueHead;
+  /* Values of the row being written, only used by the writer */
+  double *daRow;
+  atomic_int bWaiting;
+  atomic_int bLoopWaiting;
+  atomic_int bStop;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  pthread_cond_t condLoop;
+  pthread_t thread;
+};
+
+/* Writer of this run, drained at exit so an error exit keeps its rows */
+static WRITER *writerRunning = NULL;
+
+/**
+Wake the writer if it is asleep. The writer announces that it is going to
+sleep before it checks the ring for the last time, so either it sees the
+new row or the loop sees that it is waiting.
+
+@param writer Writer
+*/
+void WakeWriter(WRITER *writer) {
+  if (atomic_load(&writer->bWaiting)) {
+    pthread_mutex_lock(&writer->mutex);
+    pthread_cond_signal(&writer->cond);
+    pthread_mutex_unlock(&writer->mutex);
+  }
+}
+
+/**
+Wake the loop if it waits for the writer. As in WakeWriter, the loop
+announces that it is waiting before it checks the counters for the last
+time.
+
+@param writer Writer
+*/
+void WakeWriterLoop(WRITER *writer) {
+  if (atomic_load(&writer->bLoopWaiting)) {
+    pthread_mutex_lock(&writer->mutex);
+    pthread_cond_signal(&writer->condLoop);
+    pthread_mutex_unlock(&writer->mutex);
+  }
+}
+
+/**
+Body of the writer thread: write rows until stopped and the ring is empty.
+
+@param arg Writer
+@return NULL
+*/
+void *fvRunWriter(void *arg) {
+  WRITER *writer = arg;
+  WRITERROW *row;
+  size_t iTail, iValue;
+  double *daRow = writer->daRow;
+
+  iTail = atomic_load(&writer->iTail);
+  while (1) {
+    if (iTail == atomic_load(&writer->iHead)) {
+      pthread_mutex_lock(&writer->mutex);
+      atomic_store(&writer->bWaiting, 1);
+      while (iTail == atomic_load(&writer->iHead) &&
+             !atomic_load(&writer->bStop)) {
+        pthread_cond_wait(&writer->cond, &writer->mutex);
+      }
+      atomic_store(&writer->bWaiting, 0);
+      pthread_mutex_unlock(&writer->mutex);
+      if (iTail == atomic_load(&writer->iHead)) {
+        // Stopped, and the loop pushes nothing after stopping
+        break;
+      }
+    }
+
+    row = &writer->rows[iTail % WRITERNUMROWS];
+    for (iValue = 0; iValue < (size_t)row->iNumValues; iValue++) {
+      daRow[iValue] =
+            writer->daValues[(row->iStart + iValue) % WRITERNUMVALUES];
+    }
+    WriteWriterRow(row, daRow);
+
+    atomic_store(&writer->iValueTail, row->iStart + row->iNumValues);
+    iTail++;
+    atomic_store(&writer->iTail, iTail);
+    WakeWriterLoop(writer);
+  }
+
+  return NULL;
+}
+
+/**
+Write the pushed rows before the process exits, e.g. on an error exit in the
+middle of a run. The files themselves are flushed by exit.
+*/
+void DrainRunningWriter(void) {
+  /* The writer cannot wait for itself if it ends the process */
+  if (writerRunning != NULL &&
+      pthread_equal(pthread_self(), writerRunning->thread)) {
+    return;
+  }
+  DrainWriter(writerRunning);
+}
+
+/**
+Allocate the ring and start the writer thread.
+
+@return Writer
+*/
+WRITER *StartWriter(void) {
+  static int bAtExit = 0;
+  WRITER *writer;
+
+  writer           = malloc(sizeof(WRITER));
+  writer->rows     = malloc(WRITERNUMROWS * sizeof(WRITERROW));
+  writer->daValues = malloc(WRITERNUMVALUES * sizeof(double));
+  writer->daRow    = malloc(NUMOPT * sizeof(double));
+  atomic_init(&writer->iHead, 0);
+  atomic_init(&writer->iTail, 0);
+  atomic_init(&writer->iValueTail, 0);
+  writer->iValueHead = 0;
+  atomic_init(&writer->bWaiting, 0);
+  atomic_init(&writer->bLoopWaiting, 0);
+  atomic_init(&writer->bStop, 0);
+  pthread_mutex_init(&writer->mutex, NULL);
+  pthread_cond_init(&writer->cond, NULL);
+  pthread_cond_init(&writer->condLoop, NULL);
+
+  if (pthread_create(&writer->thread, NULL, fvRunWriter, writer) != 0) {
+    fprintf(stderr, "ERROR: Unable to start the output writer.\n");
+    VplanetExit(EXIT_WRITE);
+  }
+  writerRunning = writer;
+  if (!bAtExit) {
+    atexit(DrainRunningWriter);
+    bAtExit = 1;
+  }
+
+  return writer;
+}
+
+/**
+Is the writer more than iMaxRows rows behind, or without room for
+iNumValues more values?
+
+@param writer Writer
+@param iMaxRows Number of unwritten rows allowed
+@param iNumValues Number of values to be pushed
+@return 1 if the loop must wait, 0 otherwise
+*/
+int fbWriterBehind(WRITER *writer, size_t iMaxRows, size_t iNumValues) {
+  return atomic_load(&writer->iHead) - atomic_load(&writer->iTail) >
+               iMaxRows ||
+         writer->iValueHead + iNumValues - atomic_load(&writer->iValueTail) >
+               WRITERNUMVALUES;
+}
+
+/**
+Sleep until the writer is at most iMaxRows rows behind and has room for
+iNumValues more values.
+
+@param writer Writer
+@param iMaxRows Number of unwritten rows allowed
+@param iNumValues Number of values to be pushed
+*/
+void WaitForWriter(WRITER *writer, size_t iMaxRows, size_t iNumValues) {
+  if (!fbWriterBehind(writer, iMaxRows, iNumValues)) {
+    return;
+  }
+  WakeWriter(writer);
+  pthread_mutex_lock(&writer->mutex);
+  atomic_store(&writer->bLoopWaiting, 1);
+  while (fbWriterBehind(writer, iMaxRows, iNumValues)) {
+    pthread_cond_wait(&writer->condLoop, &writer->mutex);
+  }
+  atomic_store(&writer->bLoopWaiting, 0);
+  pthread_mutex_unlock(&writer->mutex);
+}
+
+/**
+Copy one row into the ring, waiting while the ring is full. The writer is
+started with the first row.
+
+@param io IO struct
+@param fp File the row is written to
+@param daRow Values of the row
+@param iNumValues Number of values in the row
+@param iFormat OUTPUTTEXT or OUTPUTBINARY
+*/
+void PushWriterRow(IO *io, FILE *fp, double *daRow, int iNumValues,
+                   int iFormat) {
+  WRITER *writer;
+  WRITERROW *row;
+  size_t iHead, iValue;
+
+  if (io->writer == NULL) {
+    io->writer = StartWriter();
+  }
+  writer = io->writer;
+  WaitForWriter(writer, WRITERNUMROWS - 1, iNumValues);
+  iHead = atomic_load(&writer->iHead);
+
+  row             = &writer->rows[iHead % WRITERNUMROWS];
+  row->fp         = fp;
+  row->iFormat    = iFormat;
+  row->iNumValues = iNumValues;
+  row->iSciNot    = io->iSciNot;
+  row->iDigits    = io->iDigits;
+  row->iStart     = writer->iValueHead;
+  for (iValue = 0; iValue < (size_t)iNumValues; iValue++) {
+    writer->daValues[(writer->iValueHead + iValue) % WRITERNUMVALUES] =
+          daRow[iValue];
+  }
+  writer->iValueHead += iNumValues;
+
+  atomic_store(&writer->iHead, iHead + 1);
+  WakeWriter(writer);
+}
+
+/**
+Wait until every pushed row has been written to its file. The files still
+have to be flushed.
+
+@param writer Writer, or NULL if no row has been pushed
+*/
+void DrainWriter(WRITER *writer) {
+  if (writer == NULL) {
+    return;
+  }
+  WaitForWriter(writer, 0, 0);
+}
+
+/**
+Write the remaining rows, stop the writer thread and free the ring.
+
+@param pwriter Writer, set to NULL
+*/
+void StopWriter(WRITER **pwriter) {
+  WRITER *writer = *pwriter;
+
+  if (writer == NULL) {
+    return;
+  }
+  writerRunning = NULL;
+  pthread_mutex_lock(&writer->mutex);
+  atomic_store(&writer->bStop, 1);
+  pthread_cond_signal(&writer->cond);
+  pthread_mutex_unlock(&writer->mutex);
+  pthread_join(writer->thread, NULL);
+
+  pthread_mutex_destroy(&writer->mutex);
+  pthread_cond_destroy(&writer->cond);
+  pthread_cond_destroy(&writer->condLoop);
+  free(writer->rows);
+  free(writer->daValues);
+  free(writer->daRow);
+  free(writer);
+  *pwriter = NULL;
+}
+
+#else
+
+WRITER *StartWriter(void) {
+  return NULL;
+}
+
+void PushWriterRow(IO *io, FILE *fp, double *daRow, int iNumValues,
+                   int iFormat) {
+  WRITERROW row;
+
+  row.fp         = fp;
+  row.iFormat    = iFormat;
+  row.iNumValues = iNumValues;
+  row.iSciNot    = io->iSciNot;
+  row.iDigits    = io->iDigits;
+  WriteWriterRow(&row, daRow);
+}
+
+void DrainWriter(WRITER *writer) {
+}
+
+void StopWriter(WRITER **pwriter) {
+  *pwriter = NULL;
+}
+
+#endif
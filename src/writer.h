@@ -0,0 +1,15 @@
+/**
+  @file writer.h
+  @brief Format and write output rows on a background thread.
+  @author Rory Barnes ([RoryBarnes](https://github.com/RoryBarnes/))
+  @date Oct 17 2026
+*/
+
+/* Capacity of the ring, in values and in rows */
+#define WRITERNUMVALUES 1048576
+#define WRITERNUMROWS 16384
+
+WRITER *StartWriter(void);
+void PushWriterRow(IO *, FILE *, double *, int, int);
+void DrainWriter(WRITER *);
+void StopWriter(WRITER **);
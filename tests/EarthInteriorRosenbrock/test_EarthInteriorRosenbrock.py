@@ -0,0 +1,60 @@
+import glob
+import os
+
+import astropy.units as u
+import numpy as np
+import pytest
+import vplanet
+from benchmark import Benchmark, benchmark
+
+
+@benchmark(
+    {
+        "log.final.system.TotAngMom": {
+            "value": 1.4744557587303011e42,
+            "unit": (u.kg * u.m ** 2) / u.sec,
+        },
+        "log.final.earth.TMan": {"value": 2256.0644845808510581, "unit": u.K},
+        "log.final.earth.TCore": {"value": 4998.8048963972387355, "unit": u.K},
+        "log.final.earth.HflowUMan": {"value": 32.9537908003451179, "unit": u.TW},
+        "log.final.earth.HflowCMB": {"value": 13.4031969034811294, "unit": u.TW},
+        "log.final.earth.RIC": {"value": 1238.5109098133650605, "unit": u.km},
+    }
+)
+class TestEarthInteriorRosenbrock(Benchmark):
+    pass
+
+
+def run_tolerance(path, method, tol):
+    # Run vpl.in with another integrator and dRelTol under its own name
+    with open(os.path.join(path, "vpl.in")) as f:
+        lines = f.readlines()
+    name = "%s%d" % (method.lower(), round(-np.log10(tol)))
+    infile = os.path.join(path, name + ".in")
+    with open(infile, "w") as f:
+        for line in lines:
+            if line.startswith("sSystemName"):
+                line = "sSystemName %s\n" % name
+            elif line.startswith("sIntegrationMethod"):
+                line = "sIntegrationMethod %s\n" % method
+            elif line.startswith("dRelTol"):
+                line = "dRelTol %g\n" % tol
+            f.write(line)
+    output = vplanet.run(infile, quiet=True, clobber=True, C=True)
+    for file in glob.glob(os.path.join(path, name + ".*")):
+        os.remove(file)
+    return output
+
+
+def test_EarthInteriorRosenbrockTolerance():
+    # A tighter tolerance takes smaller steps and lands closer to a tight
+    # RK45 run
+    path = os.path.abspath(os.path.dirname(__file__))
+    ref = run_tolerance(path, "RK45", 1e-12).log.final
+    loose = run_tolerance(path, "Rosenbrock", 1e-5).log.final
+    tight = run_tolerance(path, "Rosenbrock", 1e-7).log.final
+
+    assert tight.system.DeltaTime < loose.system.DeltaTime / 2
+    err_loose = abs(loose.earth.TMan - ref.earth.TMan)
+    err_tight = abs(tight.earth.TMan - ref.earth.TMan)
+    assert err_tight < err_loose / 10
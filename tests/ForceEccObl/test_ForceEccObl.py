@@ -1,5 +1,10 @@
+import glob
+import os
+
 import astropy.units as u
+import numpy as np
 import pytest
+import vplanet
 from benchmark import Benchmark, benchmark
 
 
@@ -468,3 +473,66 @@ from benchmark import Benchmark, benchmark
 )
 class TestForceEccObl(Benchmark):
     pass
+
+
+def run_option(path, name, option):
+    # Rerun the seasonal model every 10 years for 100 years, so that each
+    # run sees an orbit close to the last, with option added to earth.in
+    with open(os.path.join(path, "vpl.in")) as f:
+        lines = f.readlines()
+    infile = os.path.join(path, name + ".in")
+    with open(infile, "w") as f:
+        for line in lines:
+            if line.startswith("sSystemName"):
+                line = "sSystemName %s\n" % name
+            elif line.startswith("saBodyFiles"):
+                line = "saBodyFiles sun.in %s_earth.in\n" % name
+            elif line.startswith("dStopTime"):
+                line = "dStopTime 100\n"
+            elif line.startswith("dOutputTime"):
+                line = "dOutputTime 10\n"
+            f.write(line)
+    with open(os.path.join(path, "earth.in")) as f:
+        lines = f.readlines()
+    with open(os.path.join(path, name + "_earth.in"), "w") as f:
+        for line in lines:
+            if line.startswith("iReRunSeas"):
+                line = "iReRunSeas 10\n"
+            f.write(line)
+        f.write(option + "\n")
+    output = vplanet.run(infile, quiet=True, clobber=True, C=True)
+    seasonal = os.path.join(path, "SeasonalClimateFiles")
+    for file in glob.glob(os.path.join(path, name + "[._]*")) + glob.glob(
+        os.path.join(seasonal, name + ".*")
+    ):
+        os.remove(file)
+    if os.path.isdir(seasonal) and not os.listdir(seasonal):
+        os.rmdir(seasonal)
+    return output.earth
+
+
+def compare_climate(earth, ref):
+    # Every output of the run is within a tolerance of the reference run
+    assert np.allclose(earth.TGlobal.value, ref.TGlobal.value, rtol=0, atol=0.05)
+    assert np.allclose(
+        earth.AlbedoGlobal.value, ref.AlbedoGlobal.value, rtol=1e-3
+    )
+    assert np.allclose(
+        earth.FluxOutGlobal.value, ref.FluxOutGlobal.value, rtol=1e-3
+    )
+
+
+def test_ForceEccOblInsolTol():
+    # Insolation kept while the orbit moves less than dInsolTol
+    path = os.path.abspath(os.path.dirname(__file__))
+    ref = run_option(path, "insoltol0", "dInsolTol 0")
+    earth = run_option(path, "insoltol", "dInsolTol 1e-2")
+    compare_climate(earth, ref)
+
+
+def test_ForceEccOblSeasConverge():
+    # Seasonal model stopped once its annual means settle
+    path = os.path.abspath(os.path.dirname(__file__))
+    ref = run_option(path, "seasconverge0", "bSeasConverge 0")
+    earth = run_option(path, "seasconverge", "bSeasConverge 1")
+    compare_climate(earth, ref)
@@ -0,0 +1,52 @@
+import glob
+import os
+import subprocess
+
+import numpy as np
+
+# Values from the annual model's solver before it was banded, which explicitly
+# inverted the dense matrix of the diffusion equation
+FORWARD = {
+    # Time, TGlobal, AlbedoGlobal, FluxOutGlobal, Snowball, Obliq
+    2000: [2.00000000e03, 5.93757520, 0.365761590, 221.297791, 0.0, 26.6933257],
+    5000: [5.00000000e03, 5.41161293, 0.372913910, 220.253746, 0.0, 22.5014528],
+    10000: [1.00000000e04, 5.36993200, 0.372913910, 220.191784, 0.0, 22.8733399],
+}
+CLIMATE = {
+    # Time, Latitude, TempLat, AlbedoLat, AnnInsol, FluxMerid, DivFlux
+    (5000, 0): [5000, -83.4023523, -23.6600056, 0.6, 169.281037, -1.47177383, -99.5672625],
+    (5000, 10): [5000, -59.4208434, -11.9019766, 0.6, 238.592170, -6.85235732, -94.5148272],
+    (5000, 75): [5000, 0.0, 18.3220792, 0.33, 418.903902, 0.0, 38.5660137],
+    (10000, 0): [10000, -83.4023523, -23.5414209, 0.6, 171.811565, -1.46026142, -98.7884344],
+    (10000, 10): [10000, -59.4208434, -11.8596819, 0.6, 239.214815, -6.81921731, -94.3454712],
+    (10000, 75): [10000, 0.0, 18.2150243, 0.33, 418.370199, 0.0, 38.3730318],
+}
+# Number of ice covered latitudes at each output, which follows the obliquity
+ICE = [20, 20, 20, 22, 24, 24, 24, 22, 22, 24, 24]
+
+
+def test_IceBeltsAnnual():
+    # IceBelts with the annual model, A and B of the outgoing flux from
+    # Williams & Kasting (1997) and an oscillating obliquity. The log is off,
+    # as it would write outputs of the seasonal model.
+    path = os.path.abspath(os.path.dirname(__file__))
+    exe = os.path.join(path, "..", "..", "bin", "vplanet")
+    subprocess.check_output([exe, "vpl.in", "-q"], cwd=path)
+    try:
+        forward = np.loadtxt(os.path.join(path, "annual.earth.forward"))
+        climate = np.loadtxt(os.path.join(path, "annual.earth.Climate"))
+    finally:
+        for file in glob.glob(f"{path}/annual.*"):
+            os.remove(file)
+
+    for time, row in FORWARD.items():
+        assert np.allclose(forward[forward[:, 0] == time][0], row, rtol=1e-6)
+
+    climate = climate.reshape(len(ICE), -1, climate.shape[1])
+    for (time, lat), row in CLIMATE.items():
+        values = climate[time // 1000, lat]
+        # Temperatures agree to the tolerance of the iteration; the fluxes
+        # are differences of them
+        assert np.allclose(values[:5], row[:5], rtol=1e-6, atol=1e-4)
+        assert np.allclose(values[5:7], row[5:7], rtol=1e-4, atol=1e-6)
+    assert [int(np.sum(climate[i, :, 3] > 0.4)) for i in range(len(ICE))] == ICE
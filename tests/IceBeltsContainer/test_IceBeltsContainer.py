@@ -0,0 +1,32 @@
+import pathlib
+
+import numpy as np
+
+from vplanet.output import get_container
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+
+def test_IceBeltsContainer(vplanet_output):
+    # Every output lands in the container, not in files of its own
+    assert not (path / "SeasonalClimateFiles").exists()
+    assert not (path / "icebelt.earth.forward").exists()
+    assert not (path / "icebelt.earth.Climate").exists()
+
+    # The seasonal snapshots hold the same values as IceBelts writes as text
+    datasets = get_container(path / "icebelt.container")
+    insol = datasets["icebelt.earth.DailyInsol.0"][1]
+    assert np.isclose(insol[0][1], 1055.352482)
+    assert np.isclose(insol[75][1], 329.47451)
+    temp = datasets["icebelt.earth.SeasonalTemp.0"][1]
+    assert np.isclose(temp[0][1], 22.591643)
+    assert np.isclose(temp[75][1], 8.998626)
+    fout = datasets["icebelt.earth.SeasonalFOut.0"][1]
+    assert np.isclose(fout[0][1], 250.516533)
+    assert np.isclose(fout[75][1], 222.107129)
+
+    # The forward rows and the climate grid are read back by get_output
+    assert np.isclose(vplanet_output.earth.Time[-1].value, 1.0)
+    assert np.isclose(vplanet_output.earth.TGlobal[-1].value, 7.082835)
+    assert len(vplanet_output.earth.TempLat) == 302
+    assert np.isclose(vplanet_output.earth.TempLat[-1].value, 9.357899)
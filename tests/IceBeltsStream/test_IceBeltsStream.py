@@ -0,0 +1,42 @@
+import pathlib
+
+import numpy as np
+
+import vplanet
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+
+def test_IceBeltsStream():
+    rows = {}
+
+    def callback(dataset, row):
+        rows.setdefault(dataset, []).append(row.copy())
+
+    output = vplanet.stream(path / "vpl.in", callback=callback, quiet=True, C=True)
+
+    # The outputs and the log only pass through the pipe
+    assert not (path / "icebelt.log").exists()
+    assert not (path / "SeasonalClimateFiles").exists()
+    assert not (path / "icebelt.earth.forward").exists()
+    assert not (path / "icebelt.earth.Climate").exists()
+    assert not (path / "icebelt.container").exists()
+
+    # The callback saw every row, in order
+    assert len(rows["icebelt.earth.forward"]) == len(output.earth.Time)
+    assert rows["icebelt.earth.forward"][-1][0] == output.earth.Time[-1].value
+    assert len(rows["icebelt.earth.Climate"]) == 302
+    assert np.isclose(rows["icebelt.earth.DailyInsol.0"][0][1], 1055.352482)
+
+    # The output is the same as IceBelts writes to files
+    assert np.isclose(output.earth.Time[-1].value, 1.0)
+    assert np.isclose(output.earth.TGlobal[-1].value, 7.082835)
+    assert np.isclose(output.earth.TempLat[-1].value, 9.357899)
+    assert np.isclose(output.log.final.earth.TGlobal.value, 7.082835)
+
+    # The same run in this process streams the same output
+    inprocess = vplanet.stream(path / "vpl.in", quiet=True)
+    assert not (path / "icebelt.log").exists()
+    assert np.array_equal(inprocess.earth.TGlobal, output.earth.TGlobal)
+    assert np.array_equal(inprocess.earth.TempLat, output.earth.TempLat)
+    assert inprocess.log.final.earth.TGlobal == output.log.final.earth.TGlobal
@@ -0,0 +1,24 @@
+import astropy.units as u
+import pytest
+from benchmark import Benchmark, benchmark
+
+
+@benchmark(
+    {
+        "log.final.system.TotAngMom": {
+            "value": 3.2779886138681122e43,
+            "unit": (u.kg * u.m ** 2) / u.sec,
+        },
+        "log.final.Mercury.Eccentricity": {"value": 0.2071831856090079},
+        "log.final.Venus.Obliquity": {"value": 3.0962887257374678, "unit": u.rad},
+        "log.final.Venus.PrecA": {"value": 4.5386441782992133, "unit": u.rad},
+        "log.final.Earth.Obliquity": {"value": 0.3945759885950297, "unit": u.rad},
+        "log.final.Earth.PrecA": {"value": 2.4672154037148157, "unit": u.rad},
+        "log.final.Earth.Inc": {"value": 0.0205615865614887, "unit": u.rad},
+        "log.final.Mars.Obliquity": {"value": 0.4378324454574044, "unit": u.rad},
+        "log.final.Jupiter.Eccentricity": {"value": 0.0585171197177980},
+        "log.final.Neptune.Inc": {"value": 0.0312978388091484, "unit": u.rad},
+    }
+)
+class TestSSDistOrbDistRotThreads(Benchmark):
+    pass
@@ -0,0 +1,28 @@
+import glob
+import os
+
+import vplanet
+
+
+def test_TideLockAsync():
+    path = os.path.abspath(os.path.dirname(__file__))
+    infile = os.path.join(path, "vpl.in")
+    output = vplanet.run(infile, quiet=True, clobber=True, C=True)
+
+    # The writer thread writes every row, in order, before the run returns
+    assert len(output.d.Time) == 11
+    for i, time in enumerate(output.d.Time):
+        assert time.value == i * 1e7
+    assert len(output.gl581.Time) == 11
+
+    # The rows are the same text as without bAsyncOutput
+    with open(os.path.join(path, "gl581.d.forward")) as f:
+        rows = f.readlines()
+    assert rows[-1] == (
+        "1.0000000000000000e+08 44.6585831280041035 18.8396075643586514 \n"
+    )
+    assert output.gl581.RotPer[-1].value == 94.1999999982625980
+
+    outputs = glob.glob(f"{path}/gl581.*.forward") + glob.glob(f"{path}/gl581.log")
+    for file in outputs:
+        os.remove(file)
@@ -0,0 +1,27 @@
+import glob
+import os
+
+import pytest
+import vplanet
+
+
+def test_TideLockBinary():
+    path = os.path.abspath(os.path.dirname(__file__))
+    infile = os.path.join(path, "vpl.in")
+    output = vplanet.run(infile, quiet=True, clobber=True, C=True)
+
+    with open(os.path.join(path, "gl581.d.forward"), "rb") as f:
+        assert f.readline() == b"VPLANET BINARY 1\n"
+
+    # Columns come back as float64, with the output times and initial
+    # conditions exact
+    assert len(output.d.Time) == 11
+    assert output.d.Time[-1].value == 1.0e8
+    assert output.d.RotPer[0].value == 1.0
+    assert output.d.RotPer[-1].value == pytest.approx(44.6585831280041, rel=1e-6)
+    assert output.d.Obliquity[-1].value == pytest.approx(18.83960756435865, rel=1e-6)
+    assert output.gl581.RotPer[-1].value == pytest.approx(94.1999999982626, rel=1e-6)
+
+    outputs = glob.glob(f"{path}/gl581.*.forward") + glob.glob(f"{path}/gl581.log")
+    for file in outputs:
+        os.remove(file)
@@ -0,0 +1,79 @@
+import glob
+import os
+import re
+
+import vplanet
+
+
+def run_and_restart(path, infile, sysname):
+    # Resuming from the last checkpoint must reproduce the run exactly
+    outfiles = [
+        os.path.join(path, "%s.log" % sysname),
+        os.path.join(path, "%s.d.forward" % sysname),
+    ]
+    vplanet.run(infile, quiet=True, clobber=True, C=True)
+    full = []
+    for file in outfiles:
+        with open(file, "rb") as f:
+            full.append(f.read())
+
+    vplanet.run(infile, quiet=True, restart=True, C=True)
+    for file, contents in zip(outfiles, full):
+        with open(file, "rb") as f:
+            assert f.read() == contents
+
+    outputs = glob.glob(f"{path}/{sysname}.*.forward")
+    outputs += glob.glob(f"{path}/{sysname}.log")
+    outputs += glob.glob(f"{path}/{sysname}.checkpoint")
+    for file in outputs:
+        os.remove(file)
+
+
+def test_TideLockCheckpoint():
+    # The checkpoint at 80 Myr is written before d's spin locks
+    path = os.path.abspath(os.path.dirname(__file__))
+    run_and_restart(path, os.path.join(path, "vpl.in"), "gl581")
+
+
+def test_TideLockCheckpointLocked():
+    # The checkpoint at 120 Myr is written after the lock has swapped d's
+    # spin derivative, which the restart must swap again
+    path = os.path.abspath(os.path.dirname(__file__))
+    infile = os.path.join(path, "locked.in")
+    with open(os.path.join(path, "vpl.in")) as f:
+        text = f.read()
+    text = text.replace("sSystemName\tgl581", "sSystemName\tlocked")
+    text = text.replace("dStopTime\t1e8", "dStopTime\t1.5e8")
+    with open(infile, "w") as f:
+        f.write(text)
+    try:
+        run_and_restart(path, infile, "locked")
+    finally:
+        os.remove(infile)
+
+
+def pointer_members(header, struct):
+    # Names of the members of struct that are declared with a *
+    header = re.sub(r"/\*.*?\*/", "", header, flags=re.S)
+    header = re.sub(r"//[^\n]*", "", header)
+    start = header.index("struct %s {" % struct)
+    members = header[header.index("{", start) + 1 : header.index("\n};", start)]
+    names = []
+    for decl in members.split(";"):
+        for declarator in decl.split(","):
+            if "*" in declarator:
+                names.append(re.findall(r"\w+", declarator.split("*")[-1])[0])
+    return set(names)
+
+
+def test_CheckpointPointers():
+    # A BODY or SYSTEM pointer missing from checkpoint.c would be overwritten
+    # by the address saved in the checkpoint
+    src = os.path.join(os.path.dirname(__file__), "..", "..", "src")
+    with open(os.path.join(src, "vplanet.h")) as f:
+        header = f.read()
+    with open(os.path.join(src, "checkpoint.c")) as f:
+        checkpoint = f.read()
+    for struct in ["BODY", "SYSTEM"]:
+        listed = set(re.findall(r"offsetof\(%s, (\w+)\)" % struct, checkpoint))
+        assert pointer_members(header, struct) == listed
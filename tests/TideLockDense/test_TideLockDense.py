@@ -0,0 +1,26 @@
+import glob
+import os
+
+import vplanet
+
+
+def test_TideLockDense():
+    path = os.path.abspath(os.path.dirname(__file__))
+    infile = os.path.join(path, "vpl.in")
+    vplanet.run(infile, quiet=True, clobber=True, C=True)
+
+    with open(os.path.join(path, "gl581.d.forward")) as f:
+        rows = [[float(x) for x in line.split()] for line in f]
+
+    # Every output is written at its exact time, although the steps are free
+    assert len(rows) == 1001
+    for i, row in enumerate(rows):
+        assert row[0] == i * 1e5
+
+    # The final state agrees with the run whose steps end on the outputs
+    assert abs(rows[-1][1] / 44.6585831126257418 - 1) < 1e-6
+    assert abs(rows[-1][2] / 18.8396303005089578 - 1) < 1e-4
+
+    outputs = glob.glob(f"{path}/gl581.*.forward") + glob.glob(f"{path}/gl581.log")
+    for file in outputs:
+        os.remove(file)
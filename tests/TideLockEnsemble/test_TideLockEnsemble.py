@@ -0,0 +1,99 @@
+import glob
+import os
+import shutil
+import subprocess
+
+
+def read_output(file):
+    # The run time and executable path differ from run to run
+    with open(file) as f:
+        return [
+            line
+            for line in f
+            if "runtime" not in line.lower() and "executable" not in line.lower()
+        ]
+
+
+def test_TideLockEnsemble():
+    path = os.path.abspath(os.path.dirname(__file__))
+    exe = os.path.join(path, "..", "..", "bin", "vplanet")
+    outputs = ["gl581.log", "gl581.d.forward", "gl581.gl581.forward"]
+
+    # Each row of members.txt is one member, run two at a time
+    subprocess.check_output(
+        [exe, "vpl.in", "-e", "members.txt", "-j", "2", "-q"], cwd=path
+    )
+
+    # A plain run of the template with the member's options must match. The
+    # template's saOutputOrder continues onto a second line with $.
+    with open(os.path.join(path, "d.in")) as f:
+        lines = f.readlines()
+    with open(os.path.join(path, "vpl.in")) as f:
+        primary = f.readlines()
+    members = [("0.2", "10", "1e8"), ("0.23", "40", "5e7")]
+    for member, (semi, obliq, stop) in enumerate(members):
+        plain = os.path.join(path, "plain%d" % member)
+        os.makedirs(plain, exist_ok=True)
+        with open(os.path.join(plain, "vpl.in"), "w") as f:
+            for line in primary:
+                if line.startswith("dStopTime"):
+                    line = "dStopTime %s\n" % stop
+                f.write(line)
+        shutil.copy(os.path.join(path, "gl581.in"), plain)
+        with open(os.path.join(plain, "d.in"), "w") as f:
+            for line in lines:
+                if line.startswith("dSemi"):
+                    line = "dSemi %s\n" % semi
+                elif line.startswith("dObliquity"):
+                    line = "dObliquity %s\n" % obliq
+                elif line.startswith("saOutputOrder"):
+                    line = "saOutputOrder Time\n"
+                elif line.strip().startswith("Obliq"):
+                    continue
+                f.write(line)
+        subprocess.check_output([exe, "vpl.in", "-q"], cwd=plain)
+
+        ensemble = os.path.join(path, "members_ensemble", "%d" % member)
+        # The member's input files are only built in memory
+        assert not os.path.exists(os.path.join(ensemble, "d.in"))
+        for file in outputs:
+            assert read_output(os.path.join(ensemble, file)) == read_output(
+                os.path.join(plain, file)
+            )
+
+    for directory in glob.glob(f"{path}/plain*") + glob.glob(
+        f"{path}/members_ensemble"
+    ):
+        shutil.rmtree(directory)
+
+
+def test_TideLockEnsembleLockstep():
+    path = os.path.abspath(os.path.dirname(__file__))
+    exe = os.path.join(path, "..", "..", "bin", "vplanet")
+    outputs = ["gl581.log", "gl581.d.forward", "gl581.gl581.forward"]
+
+    # The same members, forked one at a time and integrated in lockstep. Each
+    # run moves its members to its own directory.
+    runs = {"fork": ["-j", "2"], "lockstep": ["-j", "1", "-l"]}
+    for run, flags in runs.items():
+        result = subprocess.run(
+            [exe, "vpl.in", "-e", "lanes.txt", "-q"] + flags,
+            cwd=path,
+            capture_output=True,
+        )
+        # Member 4 fails on its eccentricity
+        assert result.returncode != 0
+        shutil.rmtree(os.path.join(path, run), ignore_errors=True)
+        os.rename(
+            os.path.join(path, "lanes_ensemble"), os.path.join(path, run)
+        )
+
+    for member in [0, 1, 2, 3, 5]:
+        for file in outputs:
+            assert read_output(
+                os.path.join(path, "fork", "%d" % member, file)
+            ) == read_output(os.path.join(path, "lockstep", "%d" % member, file))
+    assert not os.path.exists(os.path.join(path, "lockstep", "4", outputs[1]))
+
+    for run in runs:
+        shutil.rmtree(os.path.join(path, run))
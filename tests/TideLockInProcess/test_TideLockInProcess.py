@@ -0,0 +1,40 @@
+import glob
+import os
+import pathlib
+
+import numpy as np
+import pytest
+
+import vplanet
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+
+def test_TideLockInProcess():
+    # TideLockCPL, run in this process a few times, with a run that fails in
+    # between, then by the executable
+    bad = path / "bad.in"
+    bad.write_text("sSystemName bad\nsaBodyFiles missing.in\n")
+    try:
+        outputs = []
+        for i in range(3):
+            outputs.append(
+                vplanet.run(path / "vpl.in", quiet=True, clobber=True, units=False)
+            )
+            with pytest.raises(vplanet.VPLANETError):
+                vplanet.run(bad, quiet=True, clobber=True)
+        expected = vplanet.run(
+            path / "vpl.in", quiet=True, clobber=True, units=False, C=True
+        )
+    finally:
+        bad.unlink()
+        for file in glob.glob(f"{path}/*.log") + glob.glob(f"{path}/*.forward"):
+            os.remove(file)
+
+    # Every run gives the same output as the executable
+    for output in outputs:
+        assert output.log.final.d.RotPer == expected.log.final.d.RotPer
+        assert output.log.final.gl581.RotPer == expected.log.final.gl581.RotPer
+        assert np.array_equal(output.d.RotPer, expected.d.RotPer)
+        assert np.array_equal(output.d.Obliquity, expected.d.Obliquity)
+    assert np.isclose(expected.log.final.d.RotPer, 44.6585830732782796)
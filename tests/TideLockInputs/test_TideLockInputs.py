@@ -0,0 +1,82 @@
+import pathlib
+
+import numpy as np
+import pytest
+
+import vplanet
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+
+def test_TideLockInputs():
+    # TideLockCPL, without any input files
+    inputs = {
+        "vpl.in": {
+            "sSystemName": "gl581",
+            "iVerbose": 5,
+            "bOverwrite": True,
+            "saBodyFiles": ["gl581.in", "d.in"],
+            "sUnitMass": "solar",
+            "sUnitLength": "AU",
+            "sUnitTime": "yr",
+            "sUnitAngle": "d",
+            "sUnitTemp": "K",
+            "bDoLog": True,
+            "iDigits": 16,
+            "bDoForward": True,
+            "bVarDt": True,
+            "dEta": 0.01,
+            "dOutputTime": 1e7,
+            "dStopTime": 1e8,
+        },
+        "gl581.in": {
+            "sName": "gl581",
+            "saModules": "eqtide",
+            "dMass": 0.31,
+            "dRadius": 0.00131,
+            "dObliquity": 0,
+            "dRotPeriod": -94.2,
+            "dRadGyra": 0.5,
+            "dTidalQ": 1e6,
+            "dK2": 0.5,
+            "sTideModel": "p2",
+            "saTidePerts": "d",
+            "saOutputOrder": ["Time", "-RotPer"],
+        },
+        "d.in": {
+            "sName": "d",
+            "saModules": "eqtide",
+            "dMass": -5.6,
+            "sMassRad": "sotin07",
+            "dRadGyra": 0.5,
+            "dRotPeriod": -1,
+            "dObliquity": 23.5,
+            "dEcc": 0.38,
+            "dSemi": 0.21847,
+            "dTidalQ": 100,
+            "dK2": 0.3,
+            "saTidePerts": "gl581",
+            "dMaxLockDiff": 0.01,
+            "saOutputOrder": ["Time", "-RotPer", "Obliq"],
+        },
+    }
+    output = vplanet.run_inputs(inputs, path=path, quiet=True)
+
+    # No file is written
+    assert not (path / "gl581.log").exists()
+    assert not (path / "gl581.d.forward").exists()
+    assert not (path / "vpl.in").exists()
+
+    # The output is the same as TideLockCPL's
+    assert np.isclose(output.log.final.gl581.RotPer.value, 94.1999999982625980)
+    assert np.isclose(output.log.final.d.RotPer.value, 44.6585830732782796)
+    assert np.isclose(output.d.RotPer[-1].value, 44.6585831280041035)
+
+    # An option that is not recognized fails the run, and the next run is
+    # not affected by it
+    inputs["d.in"]["dNotAnOption"] = 1
+    with pytest.raises(vplanet.VPLANETError):
+        vplanet.run_inputs(inputs, path=path, quiet=True)
+    del inputs["d.in"]["dNotAnOption"]
+    again = vplanet.run_inputs(inputs, path=path, quiet=True)
+    assert np.array_equal(again.d.RotPer, output.d.RotPer)
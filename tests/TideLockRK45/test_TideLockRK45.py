@@ -0,0 +1,57 @@
+import glob
+import os
+
+import astropy.units as u
+import numpy as np
+import pytest
+import vplanet
+from benchmark import Benchmark, benchmark
+
+
+@benchmark(
+    {
+        "log.final.system.TotAngMom": {
+            "value": 4.0439749932306130e40,
+            "unit": (u.kg * u.m ** 2) / u.sec,
+        },
+        "log.final.gl581.RotPer": {"value": 94.1999999982626974, "unit": u.day},
+        "log.final.d.Obliquity": {"value": 0.3288147131988096, "unit": u.rad},
+        "log.final.d.RotPer": {"value": 44.6585829982956213, "unit": u.day},
+        "log.final.d.Eccentricity": {"value": 0.3800013459072742},
+        "log.final.d.SemiMajorAxis": {"value": 3.2682782519183022e10, "unit": u.m},
+    }
+)
+class TestTideLockRK45(Benchmark):
+    pass
+
+
+def run_tolerance(path, tol):
+    # Run vpl.in with another dRelTol under its own system name
+    with open(os.path.join(path, "vpl.in")) as f:
+        lines = f.readlines()
+    name = "tol%d" % round(-np.log10(tol))
+    infile = os.path.join(path, name + ".in")
+    with open(infile, "w") as f:
+        for line in lines:
+            if line.startswith("sSystemName"):
+                line = "sSystemName %s\n" % name
+            elif line.startswith("dRelTol"):
+                line = "dRelTol %g\n" % tol
+            f.write(line)
+    output = vplanet.run(infile, quiet=True, clobber=True, C=True)
+    for file in glob.glob(os.path.join(path, name + ".*")):
+        os.remove(file)
+    return output
+
+
+def test_TideLockRK45Tolerance():
+    # A tighter tolerance takes smaller steps and lands closer to the answer
+    path = os.path.abspath(os.path.dirname(__file__))
+    ref = run_tolerance(path, 1e-12).log.final
+    loose = run_tolerance(path, 1e-4).log.final
+    tight = run_tolerance(path, 1e-8).log.final
+
+    assert tight.system.DeltaTime < loose.system.DeltaTime / 2
+    err_loose = abs(loose.d.Obliquity - ref.d.Obliquity)
+    err_tight = abs(tight.d.Obliquity - ref.d.Obliquity)
+    assert err_tight < err_loose / 10
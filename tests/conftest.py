@@ -28,6 +28,7 @@ def vplanet_output(request):
             + glob.glob(f"{path}/*.forward")
             + glob.glob(f"{path}/*.backward")
             + glob.glob(f"{path}/*.Climate")
+            + glob.glob(f"{path}/*.container")
         ):
             os.remove(file)
         for directory in glob.glob(f"{path}/SeasonalClimateFiles"):
@@ -17,4 +17,4 @@ from .output import Body, Output, get_output
 from .quantity import VPLANETQuantity as Quantity
 
 # Import the main interface
-from .wrapper import VPLANETError, help, run
+from .wrapper import VPLANETError, help, run, run_inputs, stream
@@ -227,14 +227,16 @@ class LogBody(object):
         return [key for key in keys if not key.startswith("_")]
 
 
-def get_log(path=".", sysname=None, ext="log", units=True):
+def get_log(path=".", sysname=None, ext="log", units=True, text=None):
     """ """
     # Just in case!
     if ext.startswith("."):
         ext = ext[1:]
 
-    # Look for the log file
-    if sysname is None:
+    # Look for the log file, unless a streamed run sent its text
+    if text is not None:
+        lf = os.path.join(path, "%s.%s" % (sysname, ext))
+    elif sysname is None:
         lf = glob(os.path.abspath(os.path.join(path, "*.%s" % (ext))))
         if len(lf) > 1:
             raise Exception(
@@ -263,8 +265,11 @@ def get_log(path=".", sysname=None, ext="log", units=True):
             lf = lf[0]
 
     # Grab the contents
-    with open(lf, "r") as f:
-        lines = f.readlines()
+    if text is not None:
+        lines = text.splitlines(keepends=True)
+    else:
+        with open(lf, "r") as f:
+            lines = f.readlines()
 
     # Shorten the file name for logging
     lf = os.path.basename(lf)
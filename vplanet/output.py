@@ -1,4 +1,5 @@
 # -*- coding: utf-8 -*-
+import json
 import os
 import re
 import warnings
@@ -12,6 +13,10 @@ from .logger import logger
 from .quantity import NumpyQuantity
 from .quantity import VPLANETQuantity as Quantity
 
+# First line of an output file written with sOutputFormat = Binary
+BINARY_MAGIC = b"VPLANET BINARY 1\n"
+CONTAINER_MAGIC = b"VPLANET CONTAINER 1\n"
+
 
 class Output(object):
     """A class containing all of the information of a ``vplanet`` run."""
@@ -125,9 +130,12 @@ def get_params(outputorder, file, units=True, body=None):
     for j, param in enumerate(params_and_units):
 
         # Grab the array in the fwfile/bwfile
-        array = []
-        for line in file:
-            array.append(float(line.split()[j]))
+        if isinstance(file, np.ndarray):
+            array = file[:, j]
+        else:
+            array = []
+            for line in file:
+                array.append(float(line.split()[j]))
 
         # Get the name and units
         name = param[0].replace(" ", "")
@@ -158,7 +166,7 @@ def get_params(outputorder, file, units=True, body=None):
                     unit = u.Unit("")
 
             # Make it into an astropy quantity with units
-            array = Quantity(np.array(array), unit=unit)
+            array = Quantity(np.asarray(array), unit=unit)
             physical_type = unit.physical_type
 
         else:
@@ -166,7 +174,7 @@ def get_params(outputorder, file, units=True, body=None):
             # Keep it as a numpy array with tags. We'll
             # still keep track of the unit, but it's only
             # a passive tag!
-            array = NumpyQuantity(np.array(array))
+            array = NumpyQuantity(np.asarray(array))
             array.unit = unit_str
             physical_type = None
 
@@ -184,7 +192,140 @@ def get_params(outputorder, file, units=True, body=None):
     return params
 
 
-def get_arrays(log, units=True):
+def get_binary(file):
+    """Map a binary ``.forward`` or ``.backward`` file into memory.
+
+    Returns the output order, in the format of the log's ``OutputOrder``, and
+    the rows as a 2d array, or ``(None, None)`` if the file is not binary.
+    """
+    with open(file, "rb") as f:
+        if f.readline() != BINARY_MAGIC:
+            return None, None
+        header = json.loads(f.readline().decode("utf-8"))
+        offset = f.tell()
+
+    columns = header["columns"]
+    outputorder = " ".join(
+        "%s[%s]" % (column["name"], column["unit"]) for column in columns
+    )
+    dtype = np.dtype(header["dtype"])
+    nrows = (os.path.getsize(file) - offset) // (dtype.itemsize * len(columns))
+    if nrows == 0:
+        return outputorder, np.empty((0, len(columns)), dtype=dtype)
+    data = np.memmap(
+        file, dtype=dtype, mode="r", offset=offset, shape=(nrows, len(columns))
+    )
+    return outputorder, data
+
+
+def get_container(file):
+    """Read the datasets of a ``.container`` file.
+
+    Returns a dictionary from the name of the file each dataset replaces to
+    its output order (None for a seasonal climate file) and its rows as a 2d
+    array. The chunks are mapped into memory, and only copied if a dataset
+    spans more than one.
+    """
+    datasets = {}
+    if not os.path.exists(file):
+        return datasets
+    size = os.path.getsize(file)
+    with open(file, "rb") as f:
+        if f.readline() != CONTAINER_MAGIC:
+            return datasets
+        while f.tell() < size:
+            header = json.loads(f.readline().decode("utf-8"))
+            offset = f.tell()
+            dtype = np.dtype(header["dtype"])
+            shape = tuple(header["shape"])
+            f.seek(offset + dtype.itemsize * shape[0] * shape[1])
+            chunk = np.memmap(file, dtype=dtype, mode="r", offset=offset, shape=shape)
+            if header["dataset"] not in datasets:
+                datasets[header["dataset"]] = (_column_order(header), [])
+            datasets[header["dataset"]][1].append(chunk)
+
+    return {
+        name: (outputorder, chunks[0] if len(chunks) == 1 else np.concatenate(chunks))
+        for name, (outputorder, chunks) in datasets.items()
+    }
+
+
+def _column_order(header):
+    """The output order of a container chunk, or None if it has no columns."""
+    if "columns" not in header:
+        return None
+    return " ".join(
+        "%s[%s]" % (column["name"], column["unit"]) for column in header["columns"]
+    )
+
+
+def read_container_stream(stream, callback=None):
+    """Read the datasets of a container from a stream, such as the pipe of a
+    run started with ``vplanet -s``, as its chunks arrive.
+
+    Returns the same dictionary as `get_container`. If `callback` is set, it
+    is called as ``callback(dataset, row)`` for every row, in the order the
+    rows were written, where `dataset` is the name of the file the row would
+    otherwise have been written to.
+    """
+    datasets = {}
+    if stream.readline() != CONTAINER_MAGIC:
+        return datasets
+    while True:
+        line = stream.readline()
+        if not line:
+            break
+        header = json.loads(line.decode("utf-8"))
+        dtype = np.dtype(header["dtype"])
+        shape = tuple(header["shape"])
+        size = dtype.itemsize * shape[0] * shape[1]
+        buffer = bytearray(size)
+        view = memoryview(buffer)
+        read = 0
+        while read < size:
+            n = stream.readinto(view[read:])
+            if not n:
+                raise EOFError("Truncated chunk of %s." % header["dataset"])
+            read += n
+        chunk = np.frombuffer(buffer, dtype=dtype).reshape(shape)
+        if header["dataset"] not in datasets:
+            datasets[header["dataset"]] = (_column_order(header), [])
+        datasets[header["dataset"]][1].append(chunk)
+        if callback is not None:
+            for row in chunk:
+                callback(header["dataset"], row)
+
+    return {
+        name: (outputorder, chunks[0] if len(chunks) == 1 else np.concatenate(chunks))
+        for name, (outputorder, chunks) in datasets.items()
+    }
+
+
+def read_output_file(file, container=None):
+    """Read a ``.forward`` or ``.backward`` file in any format.
+
+    Returns the output order stored in a binary file or container (None for a
+    text file) and the rows: a 2d array for a binary file or a dataset of
+    `container`, or the lines of a text file.
+    """
+    if container and os.path.basename(file) in container:
+        return container[os.path.basename(file)]
+    try:
+        outputorder, data = get_binary(file)
+        if data is not None:
+            return outputorder, data
+        with open(file, "r") as f:
+            return None, f.readlines()
+    except IOError:
+        return None, [""]
+
+
+def has_rows(data):
+    """Did `read_output_file` find the file?"""
+    return isinstance(data, np.ndarray) or data != [""]
+
+
+def get_arrays(log, units=True, container=None):
     """ """
     # Initialize
     output = Output()
@@ -194,6 +335,13 @@ def get_arrays(log, units=True):
     output.sysname = log.sysname
     output.path = log.path
 
+    # With sOutputFormat Container, all of the output files are datasets of
+    # a single file. A streamed run passes the datasets it read.
+    if container is None:
+        container = get_container(
+            os.path.join(output.path, "%s.container" % output.sysname)
+        )
+
     # Grab body properties
     for i, body_name in enumerate(log._body_names):
 
@@ -208,55 +356,65 @@ def get_arrays(log, units=True):
         # Grab the output file names
         body.fwfile = "%s.%s.forward" % (output.sysname, body._name)
         if not os.path.exists(os.path.join(output.path, body.fwfile)):
-            body.fwfile = ""
+            if body.fwfile not in container:
+                body.fwfile = ""
         body.bwfile = "%s.%s.backward" % (output.sysname, body._name)
         if not os.path.exists(os.path.join(output.path, body.bwfile)):
-            body.bwfile = ""
+            if body.bwfile not in container:
+                body.bwfile = ""
         body.climfile = "%s.%s.Climate" % (output.sysname, body._name)
         if not os.path.exists(os.path.join(output.path, body.climfile)):
-            body.climfile = ""
+            if body.climfile not in container:
+                body.climfile = ""
 
         # Grab the forward arrays. Note that they may not exist for this body
-        try:
-            with open(os.path.join(output.path, body.fwfile), "r") as f:
-                fwfile = f.readlines()
-        except IOError:
-            fwfile = [""]
+        fworder, fwfile = read_output_file(
+            os.path.join(output.path, body.fwfile), container
+        )
 
         # Grab the backward arrays. Note that they may not exist for this body
-        try:
-            with open(os.path.join(output.path, body.bwfile), "r") as f:
-                bwfile = f.readlines()
-        except IOError:
-            bwfile = [""]
+        bworder, bwfile = read_output_file(
+            os.path.join(output.path, body.bwfile), container
+        )
 
         # TODO: Add support for *both* fwfile and bwfile at the same time?
-        if fwfile != [""] and bwfile != [""]:
+        if has_rows(fwfile) and has_rows(bwfile):
             logger.error(
                 "Both a fwfile and a bwfile were detected. "
                 + "Currently, vplanet can only handle one at a time. "
                 + "Continuing, but ignoring the bwfile..."
             )
 
-        # Now grab the output order and the params
+        # Now grab the output order and the params. Binary files carry their
+        # own output order.
         outputorder = getattr(log.initial, body._name).OutputOrder
-        if fwfile != [""]:
-            body._params = get_params(outputorder, fwfile, units=units, body=body._name)
-        elif bwfile != [""]:
-            body._params = get_params(outputorder, bwfile, units=units, body=body._name)
+        if has_rows(fwfile):
+            body._params = get_params(
+                fworder or outputorder, fwfile, units=units, body=body._name
+            )
+        elif has_rows(bwfile):
+            body._params = get_params(
+                bworder or outputorder, bwfile, units=units, body=body._name
+            )
 
         # Climate file
         if body.climfile != "":
             # Grab the climate arrays...
-            try:
-                with open(os.path.join(output.path, body.climfile), "r") as f:
-                    climfile = f.readlines()
-            except IOError:
-                raise Exception("Unable to open %s." % body.climfile)
+            if body.climfile in container:
+                climorder, climfile = container[body.climfile]
+            else:
+                climorder = None
+                try:
+                    with open(os.path.join(output.path, body.climfile), "r") as f:
+                        climfile = f.readlines()
+                except IOError:
+                    raise Exception("Unable to open %s." % body.climfile)
 
             # ... and the grid order
             try:
-                gridorder = getattr(log.initial, body._name).GridOutputOrder
+                gridorder = climorder or getattr(
+                    log.initial, body._name
+                ).GridOutputOrder
                 body._gridparams = get_params(
                     gridorder, climfile, units=units, body=body._name
                 )
@@ -274,7 +432,7 @@ def get_arrays(log, units=True):
     return output
 
 
-def get_output(path=".", sysname=None, units=True):
+def get_output(path=".", sysname=None, units=True, container=None):
     """Parse all of the output from a :py:obj:`vplanet` run.
 
     Args:
@@ -285,14 +443,21 @@ def get_output(path=".", sysname=None, units=True):
             the :py:obj:`vplanet` run. Defaults to the current directory.
         units (bool, optional): Whether or not the quantities returned by this
             method have astropy units. Default is True.
+        container (dict, optional): Datasets already read from a streamed
+            run, as returned by `read_container_stream`, used instead of the
+            output files and the log. Defaults to None.
 
     Returns:
         A :py:class:`Output` instance containing all the information from the
         ``.log``, ``.forward``, and ``.backward`` output files.
     """
-    # Get the log file and the arrays
-    log = get_log(sysname=sysname, path=path, units=units)
-    output = get_arrays(log, units=units)
+    # Get the log and the arrays. A streamed run sends its log as the bytes of
+    # a dataset named after the log file.
+    text = None
+    if container and "%s.log" % sysname in container:
+        text = container["%s.log" % sysname][1].tobytes().decode("utf-8")
+    log = get_log(sysname=sysname, path=path, units=units, text=text)
+    output = get_arrays(log, units=units, container=container)
 
     for body in output.bodies:
 
@@ -3,9 +3,10 @@ import os
 import re
 import subprocess
 import sys
+import threading
 
 from . import vplanet_core as core
-from .output import get_output
+from .output import get_output, read_container_stream
 
 
 class VPLANETError(RuntimeError):
@@ -25,8 +26,49 @@ def _entry_point():
     return core.run(*sys.argv)
 
 
+# A run reads its inputs from and writes its outputs to the working
+# directory, which is shared by all threads, so runs in this process take turns
+_run_lock = threading.Lock()
+
+
+def _run_core(path, args, verbose=False, inputs=None):
+    """
+    Run ``vplanet_core.run`` with the options ``args`` in the directory
+    ``path`` and return its exit code. The messages the run prints to
+    standard output are discarded unless ``verbose`` is set. If ``inputs`` is
+    set, it gives the options of every input file, as in
+    :py:func:`run_inputs`, and ``vplanet_core.run_inputs`` runs them instead.
+
+    """
+    with _run_lock:
+        cwd = os.getcwd()
+        stdout = None
+        if not verbose:
+            sys.stdout.flush()
+            stdout = os.dup(1)
+            devnull = os.open(os.devnull, os.O_WRONLY)
+            os.dup2(devnull, 1)
+            os.close(devnull)
+        try:
+            os.chdir(path)
+            if inputs is not None:
+                return core.run_inputs(inputs, *args)
+            return core.run(*args)
+        finally:
+            os.chdir(cwd)
+            if stdout is not None:
+                os.dup2(stdout, 1)
+                os.close(stdout)
+
+
 def run(
-    infile="vpl.in", verbose=False, quiet=False, clobber=False, units=True, C=False
+    infile="vpl.in",
+    verbose=False,
+    quiet=False,
+    clobber=False,
+    units=True,
+    C=False,
+    restart=False,
 ):
     """
     Run `vplanet` and return the output.
@@ -39,6 +81,10 @@ def run(
             Default False.
         units (bool, optional): If True, returns unit-ful output. If False, the
             output arrays are standard ``numpy`` arrays. Default True.
+        C (bool, optional): Run the executable in ``bin`` as a subprocess
+            instead of the installed extension. Default False.
+        restart (bool, optional): Resume the run from the checkpoint written
+            by an earlier run with ``dCheckpointTime`` set. Default False.
 
     Returns:
         A ``vplanet.Output`` object containing the full output from the run.
@@ -48,10 +94,10 @@ def run(
 
     .. note::
 
-        We need to change the way vplanet exits on error in order to
-        return to the Python interpreter when it terminates. The current
-        hack is to spawn a subprocess so we don't terminate the current
-        Python session.
+        `vplanet` runs in the current Python session: an error returns its
+        exit code instead of terminating the session, and a run frees all of
+        the memory it allocates. Runs in different threads take turns, as
+        each one runs in the directory of its input file.
 
     """
     # Determine the system name from the infile
@@ -70,25 +116,28 @@ def run(
     log_exists = os.path.exists(os.path.join(path, "{}.log".format(sysname)))
 
     # Run vplanet
-    if clobber or not log_exists:
+    if clobber or restart or not log_exists:
 
         # Parse kwargs
-        if C:
-            exe = "../../bin/vplanet"
-        else:
-            exe = "vplanet"
-        args = [exe, infile]
+        args = []
         if verbose:
             args += ["-v"]
         if quiet:
             args += ["-q"]
+        if restart:
+            args += ["-r"]
 
-        # Spawn `vplanet` as a subprocess
-        error = False
-        try:
-            subprocess.check_output(args, cwd=path)
-        except subprocess.CalledProcessError as e:
-            error = True
+        if C:
+            # Spawn the executable as a subprocess
+            error = False
+            try:
+                subprocess.check_output(["../../bin/vplanet", infile] + args, cwd=path)
+            except subprocess.CalledProcessError as e:
+                error = True
+        else:
+            # Run `vplanet` in this process, from the directory of the infile
+            args = ["vplanet", os.path.basename(infile)] + args
+            error = _run_core(path, args, verbose=verbose) != 0
         if error:
             raise VPLANETError("Error running VPLANET.")
 
@@ -99,6 +148,226 @@ def run(
     return output
 
 
+def _stream_core(path, args, callback=None, verbose=False, inputs=None):
+    """
+    Run `vplanet` as :py:func:`_run_core` does, on another thread, with its
+    outputs and log sent by ``-s`` to a pipe that this thread reads. Returns
+    the datasets read from the pipe, or None if the run failed.
+
+    """
+    fdRead, fdWrite = os.pipe()
+    code = []
+
+    def target():
+        try:
+            code.append(
+                _run_core(
+                    path, args + ["-s", "/dev/fd/%d" % fdWrite], verbose, inputs
+                )
+            )
+        finally:
+            os.close(fdWrite)
+
+    thread = threading.Thread(target=target)
+    thread.start()
+    with os.fdopen(fdRead, "rb") as pipe:
+        try:
+            container = read_container_stream(pipe, callback)
+        except EOFError:
+            container = None
+        except BaseException:
+            # A run cannot be stopped, so let it finish writing to the pipe
+            while pipe.read(1 << 16):
+                pass
+            thread.join()
+            raise
+    thread.join()
+    if code != [0]:
+        return None
+    return container
+
+
+def stream(
+    infile="vpl.in",
+    callback=None,
+    verbose=False,
+    quiet=False,
+    units=True,
+    C=False,
+    restart=False,
+):
+    """
+    Run `vplanet` and return the output without writing output files.
+
+    The outputs and the log are streamed through a pipe, in the format of
+    ``sOutputFormat Container``, and read as the run produces them, so no
+    ``.log``, ``.forward``, ``.backward`` or ``.Climate`` file is written or
+    read.
+
+    Args:
+        infile (str, optional): The path to the input file. Default ``vpl.in``.
+        callback (callable, optional): Called as ``callback(dataset, row)``
+            for every output row, where ``dataset`` is the name of the file
+            the row replaces, e.g. ``earth.earth.forward``, and ``row`` is a
+            ``numpy`` array of the row's values in output units. Rows arrive
+            in chunks while the run continues. Default None.
+        verbose (bool, optional): Enable verbose output? Default False.
+        quiet (bool, optional): Suppress all output? Default False.
+        units (bool, optional): If True, returns unit-ful output. If False, the
+            output arrays are standard ``numpy`` arrays. Default True.
+        C (bool, optional): Run the executable in ``bin`` as a subprocess
+            instead of the installed extension. Default False.
+        restart (bool, optional): Resume the run from the checkpoint written
+            by an earlier run with ``dCheckpointTime`` set. Only the rows after
+            the checkpoint are streamed, but the log is complete. Default
+            False.
+
+    Returns:
+        A ``vplanet.Output`` object containing the full output from the run.
+
+    Raises:
+        ``vplanet.VPLANETError``: If something goes wrong in the C extension.
+
+    .. note::
+
+        As in :py:func:`run`, `vplanet` runs in the current Python session,
+        on a thread of its own, while the calling thread reads the pipe and
+        calls ``callback``. It is not available on Windows.
+
+    """
+    # Determine the system name from the infile
+    sysname = None
+    with open(infile, "r") as f:
+        for line in f.readlines():
+            match = re.match("sSystemName[ \t\n]+(.*?)[ \t\n#]", line)
+            if match:
+                sysname = match.groups()[0]
+                break
+    path = os.path.abspath(os.path.dirname(infile))
+
+    args = []
+    if verbose:
+        args += ["-v"]
+    if quiet:
+        args += ["-q"]
+    if restart:
+        args += ["-r"]
+
+    if C:
+        # The executable writes its outputs to a pipe that is passed to it by
+        # name
+        fdRead, fdWrite = os.pipe()
+        try:
+            process = subprocess.Popen(
+                ["../../bin/vplanet", infile, "-s", "/dev/fd/%d" % fdWrite] + args,
+                cwd=path,
+                pass_fds=(fdWrite,),
+                stdout=subprocess.DEVNULL,
+            )
+        finally:
+            os.close(fdWrite)
+
+        with os.fdopen(fdRead, "rb") as pipe:
+            try:
+                container = read_container_stream(pipe, callback)
+            except EOFError:
+                container = None
+            except BaseException:
+                # Don't leave the run writing to a closed pipe
+                process.kill()
+                process.wait()
+                raise
+        if process.wait() != 0:
+            container = None
+    else:
+        args = ["vplanet", os.path.basename(infile)] + args
+        container = _stream_core(path, args, callback, verbose=verbose)
+    if container is None:
+        raise VPLANETError("Error running VPLANET.")
+
+    return get_output(path=path, sysname=sysname, units=units, container=container)
+
+
+def _format_value(value):
+    """
+    Format the value of an option as it would appear in an input file.
+
+    """
+    if isinstance(value, bool):
+        return "1" if value else "0"
+    elif isinstance(value, (list, tuple)):
+        return " ".join(_format_value(v) for v in value)
+    elif isinstance(value, float):
+        return repr(value)
+    else:
+        return str(value)
+
+
+def run_inputs(
+    inputs,
+    path=".",
+    callback=None,
+    verbose=False,
+    quiet=False,
+    units=True,
+):
+    """
+    Run `vplanet` on inputs given as dicts instead of input files.
+
+    No input file is written or read: the options of each file are handed
+    to the run, which reads them as it would read the lines of the file. The
+    outputs and the log are streamed as in :py:func:`stream`, so the run
+    writes no files.
+
+    Args:
+        inputs (dict): The input files, as a dict of file names to dicts of
+            options, e.g. ``{"vpl.in": {"sSystemName": "earth", ...},
+            "earth.in": {...}}``. The primary file is the one that sets
+            ``saBodyFiles``, whose values name the other files. Lists become
+            space separated values and bools 1 or 0.
+        path (str, optional): The directory the run runs in. Default ``.``.
+        callback (callable, optional): Called for every output row as in
+            :py:func:`stream`. Default None.
+        verbose (bool, optional): Enable verbose output? Default False.
+        quiet (bool, optional): Suppress all output? Default False.
+        units (bool, optional): If True, returns unit-ful output. If False, the
+            output arrays are standard ``numpy`` arrays. Default True.
+
+    Returns:
+        A ``vplanet.Output`` object containing the full output from the run.
+
+    Raises:
+        ``vplanet.VPLANETError``: If something goes wrong in the C extension.
+
+    .. note::
+
+        As in :py:func:`stream`, `vplanet` runs in the current Python
+        session. It is not available on Windows.
+
+    """
+    primary = [name for name in inputs if "saBodyFiles" in inputs[name]]
+    if len(primary) != 1:
+        raise VPLANETError("Exactly one input must set saBodyFiles.")
+    primary = primary[0]
+    sysname = str(inputs[primary].get("sSystemName"))
+    values = {
+        name: {option: _format_value(value) for option, value in options.items()}
+        for name, options in inputs.items()
+    }
+    path = os.path.abspath(path)
+
+    args = ["vplanet", primary]
+    if verbose:
+        args += ["-v"]
+    if quiet:
+        args += ["-q"]
+    container = _stream_core(path, args, callback, verbose=verbose, inputs=values)
+    if container is None:
+        raise VPLANETError("Error running VPLANET.")
+
+    return get_output(path=path, sysname=sysname, units=units, container=container)
+
+
 def help(verbose=False):
     from .vplanet_help import VPLANETHelp
 